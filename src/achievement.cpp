@@ -372,7 +372,7 @@ class requirement_watcher : stat_watcher
     public:
         requirement_watcher( achievement_tracker &tracker, const achievement_requirement &req,
                              stats_tracker &stats ) :
-            current_value_( req.statistic->value( stats ) ),
+            current_value_( stats.value_of( req.statistic ) ),
             tracker_( &tracker ),
             requirement_( &req ) {
             stats.add_watcher( req.statistic, this );
@@ -389,7 +389,7 @@ class requirement_watcher : stat_watcher
         void new_value( const cata_variant &new_value, stats_tracker & ) override;
 
         bool is_satisfied( stats_tracker &stats ) {
-            return requirement_->satisifed_by( requirement_->statistic->value( stats ) );
+            return requirement_->satisifed_by( stats.value_of( requirement_->statistic ) );
         }
 
         std::string ui_text() const {
@@ -658,6 +658,11 @@ void achievements_tracker::clear()
     achievements_status_.clear();
 }
 
+bool achievements_tracker::wants( const event_type type ) const
+{
+    return type == event_type::game_start;
+}
+
 void achievements_tracker::notify( const cata::event &e )
 {
     if( e.type() == event_type::game_start ) {
@@ -1,17 +1,28 @@
 #include "active_item_cache.h"
 
 #include <algorithm>
+#include <functional>
 #include <utility>
 
 #include "item.h"
 #include "safe_reference.h"
 
+void active_item_cache::erase( bucket &b, size_t index )
+{
+    positions.erase( b.entries[index].target );
+    if( index + 1 != b.entries.size() ) {
+        b.entries[index] = b.entries.back();
+        positions[b.entries[index].target].index = index;
+    }
+    b.entries.pop_back();
+}
+
 void active_item_cache::remove( const item *it )
 {
-    active_items[it->processing_speed()].remove_if( [it]( const item_reference & active_item ) {
-        item *const target = active_item.item_ref.get();
-        return !target || target == it;
-    } );
+    const auto found = positions.find( it );
+    if( found != positions.end() ) {
+        erase( active_items[found->second.speed], found->second.index );
+    }
     if( it->can_revive() ) {
         special_items[ special_item_type::corpse ].remove_if( [it]( const item_reference & active_item ) {
             item *const target = active_item.item_ref.get();
@@ -29,13 +40,15 @@ void active_item_cache::remove( const item *it )
 
 void active_item_cache::add( item &it, point location )
 {
-    // If the item is alread in the cache for some reason, don't add a second reference
-    std::list<item_reference> &target_list = active_items[it.processing_speed()];
-    if( std::find_if( target_list.begin(),
-    target_list.end(), [&it]( const item_reference & active_item_ref ) {
-    return &it == active_item_ref.item_ref.get();
-    } ) != target_list.end() ) {
-        return;
+    const auto found = positions.find( &it );
+    if( found != positions.end() ) {
+        bucket &b = active_items[found->second.speed];
+        // If the item is alread in the cache for some reason, don't add a second reference
+        if( b.entries[found->second.index].ref.item_ref.get() == &it ) {
+            return;
+        }
+        // Otherwise this is a destroyed item that happened to have the same address.
+        erase( b, found->second.index );
     }
     if( it.can_revive() ) {
         special_items[ special_item_type::corpse ].push_back( item_reference{ location, it.get_safe_reference() } );
@@ -43,57 +56,69 @@ void active_item_cache::add( item &it, point location )
     if( it.get_use( "explosion" ) ) {
         special_items[ special_item_type::explosive ].push_back( item_reference{ location, it.get_safe_reference() } );
     }
-    target_list.push_back( item_reference{ location, it.get_safe_reference() } );
+    const int speed = it.processing_speed();
+    bucket &b = active_items[speed];
+    positions[&it] = position{ speed, b.entries.size() };
+    b.entries.push_back( entry{ item_reference{ location, it.get_safe_reference() }, &it } );
 }
 
 bool active_item_cache::empty() const
 {
-    for( std::pair<int, std::list<item_reference>> active_queue : active_items ) {
-        if( !active_queue.second.empty() ) {
-            return false;
-        }
-    }
-    return true;
+    return positions.empty();
+}
+
+size_t active_item_cache::size() const
+{
+    return positions.size();
 }
 
 std::vector<item_reference> active_item_cache::get()
 {
     std::vector<item_reference> all_cached_items;
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        for( std::list<item_reference>::iterator it = kv.second.begin(); it != kv.second.end(); ) {
-            if( it->item_ref ) {
-                all_cached_items.emplace_back( *it );
-                ++it;
+    all_cached_items.reserve( positions.size() );
+    for( std::pair<const int, bucket> &kv : active_items ) {
+        std::vector<entry> &entries = kv.second.entries;
+        for( size_t i = 0; i < entries.size(); ) {
+            if( entries[i].ref.item_ref ) {
+                all_cached_items.emplace_back( entries[i].ref );
+                ++i;
             } else {
-                it = kv.second.erase( it );
+                // moves the last entry to i, which is looked at next
+                erase( kv.second, i );
             }
         }
     }
     return all_cached_items;
 }
 
-std::vector<item_reference> active_item_cache::get_for_processing()
+std::vector<item_reference> &active_item_cache::get_for_processing()
 {
-    std::vector<item_reference> items_to_process;
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        // Rely on iteration logic to make sure the number is sane.
-        int num_to_process = kv.second.size() / kv.first;
-        std::list<item_reference>::iterator it = kv.second.begin();
-        for( ; it != kv.second.end() && num_to_process >= 0; ) {
-            if( it->item_ref ) {
-                items_to_process.push_back( *it );
+    processing.clear();
+    for( std::pair<const int, bucket> &kv : active_items ) {
+        bucket &b = kv.second;
+        const size_t size = b.entries.size();
+        size_t num_to_process = std::min( size, size / kv.first + 1 );
+        broken.clear();
+        for( size_t visited = 0; visited < size && num_to_process > 0; ++visited ) {
+            if( b.next >= size ) {
+                b.next = 0;
+            }
+            const size_t index = b.next++;
+            if( b.entries[index].ref.item_ref ) {
+                processing.push_back( b.entries[index].ref );
                 --num_to_process;
-                ++it;
             } else {
-                // The item has been destroyed, so remove the reference from the cache
-                it = kv.second.erase( it );
+                broken.push_back( index );
             }
         }
-        // Rotate the returned items to the end of their list so that the items that weren't
-        // returned this time will be first in line on the next call
-        kv.second.splice( kv.second.end(), kv.second, kv.second.begin(), it );
+        // The item has been destroyed, so remove the reference from the cache.
+        // Erasing moves the last entry, so go from the back to keep the other indices valid.
+        std::sort( broken.begin(), broken.end(), std::greater<size_t>() );
+        for( const size_t index : broken ) {
+            erase( b, index );
+        }
     }
-    return items_to_process;
+    return processing;
 }
 
 std::vector<item_reference> active_item_cache::get_special( special_item_type type )
@@ -107,18 +132,18 @@ std::vector<item_reference> active_item_cache::get_special( special_item_type ty
 
 void active_item_cache::subtract_locations( const point &delta )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
-            ir.location -= delta;
+    for( std::pair<const int, bucket> &pair : active_items ) {
+        for( entry &e : pair.second.entries ) {
+            e.ref.location -= delta;
         }
     }
 }
 
 void active_item_cache::rotate_locations( int turns, const point &dim )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
-            ir.location = ir.location.rotate( turns, dim );
+    for( std::pair<const int, bucket> &pair : active_items ) {
+        for( entry &e : pair.second.entries ) {
+            e.ref.location = e.ref.location.rotate( turns, dim );
         }
     }
 }
@@ -37,8 +37,32 @@ struct hash<special_item_type> {
 class active_item_cache
 {
     private:
-        std::unordered_map<int, std::list<item_reference>> active_items;
+        struct entry {
+            item_reference ref;
+            // The item the reference was created for, even if it has been destroyed since.
+            const item *target;
+        };
+        struct bucket {
+            std::vector<entry> entries;
+            // Index of the entry get_for_processing starts with next time.
+            size_t next = 0;
+        };
+        struct position {
+            int speed;
+            size_t index;
+        };
+        /** Active items by processing speed, in no particular order. */
+        std::unordered_map<int, bucket> active_items;
+        /** Where each item is in @ref active_items, for removing it in constant time. */
+        std::unordered_map<const item *, position> positions;
         std::unordered_map<special_item_type, std::list<item_reference>> special_items;
+        /** Result of get_for_processing, kept around to reuse its memory. */
+        std::vector<item_reference> processing;
+        /** Scratch space for get_for_processing. */
+        std::vector<size_t> broken;
+
+        /** Removes an entry by moving the last one of the bucket in its place. */
+        void erase( bucket &b, size_t index );
 
     public:
         /**
@@ -59,6 +83,12 @@ class active_item_cache
          */
         bool empty() const;
 
+        /**
+         * Returns the number of cached items, including references to items that have been
+         * destroyed but not removed yet.
+         */
+        size_t size() const;
+
         /**
          * Returns a vector of all cached active item references.
          * Broken references are removed from the cache.
@@ -66,14 +96,15 @@ class active_item_cache
         std::vector<item_reference> get();
 
         /**
-         * Returns the first size() / processing_speed() elements of each list, rounded up.
-         * Items returned are rotated to the back of their respective lists, otherwise only the
-         * first n items will ever be processed.
+         * Returns size() / processing_speed() + 1 items of each processing speed (or all of them
+         * if there are fewer). Each call continues where the previous one stopped, so that all
+         * items get processed in turn.
          * Broken references encountered when collecting the items to be processed are removed from
          * the cache.
          * Relies on the fact that item::processing_speed() is a constant.
+         * The returned vector belongs to the cache and stays valid until the next call.
          */
-        std::vector<item_reference> get_for_processing();
+        std::vector<item_reference> &get_for_processing();
 
         /**
          * Returns the currently tracked list of special active items.
@@ -10,6 +10,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -2187,8 +2188,8 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
 
         // the boolean in this pair being true indicates the item is from a vehicle storage space
         auto items = std::vector<std::pair<item *, bool>>();
-        vehicle *src_veh, *dest_veh;
-        int src_part, dest_part;
+        vehicle *src_veh;
+        int src_part;
 
         //Check source for cargo part
         //map_stack and vehicle_stack are different types but inherit from item_stack
@@ -2208,6 +2209,11 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
             items.push_back( std::make_pair( &it, false ) );
         }
 
+        // Destination tiles that can't take items, and the free volume of the ones that can.
+        // Both stay valid until an item is moved onto that tile.
+        std::unordered_set<tripoint> unusable_dests;
+        std::unordered_map<tripoint, units::volume> dest_free_space;
+
         //Skip items that have already been processed
         for( auto it = items.begin() + num_processed; it < items.end(); ++it ) {
             ++num_processed;
@@ -2235,34 +2241,36 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
             const std::unordered_set<tripoint> &dest_set = mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE,
                     &thisitem );
             for( const tripoint &dest : dest_set ) {
-                const tripoint &dest_loc = g->m.getlocal( dest );
-
-                //Check destination for cargo part
-                if( const cata::optional<vpart_reference> vp = g->m.veh_at( dest_loc ).part_with_feature( "CARGO",
-                        false ) ) {
-                    dest_veh = &vp->vehicle();
-                    dest_part = vp->part_index();
-                } else {
-                    dest_veh = nullptr;
-                    dest_part = -1;
-                }
-
-                // skip tiles with inaccessible furniture, like filled charcoal kiln
-                if( !g->m.can_put_items_ter_furn( dest_loc ) ||
-                    static_cast<int>( g->m.i_at( dest_loc ).size() ) >= MAX_ITEM_IN_SQUARE ) {
+                if( unusable_dests.count( dest ) ) {
                     continue;
                 }
+                const tripoint &dest_loc = g->m.getlocal( dest );
 
-                units::volume free_space;
-                // if there's a vehicle with space do not check the tile beneath
-                if( dest_veh ) {
-                    free_space = dest_veh->free_volume( dest_part );
-                } else {
-                    free_space = g->m.free_volume( dest_loc );
+                auto cached_space = dest_free_space.find( dest );
+                if( cached_space == dest_free_space.end() ) {
+                    // skip tiles with inaccessible furniture, like filled charcoal kiln
+                    if( !g->m.can_put_items_ter_furn( dest_loc ) ||
+                        static_cast<int>( g->m.i_at( dest_loc ).size() ) >= MAX_ITEM_IN_SQUARE ) {
+                        unusable_dests.insert( dest );
+                        continue;
+                    }
+
+                    units::volume free_space;
+                    //Check destination for cargo part
+                    // if there's a vehicle with space do not check the tile beneath
+                    if( const cata::optional<vpart_reference> vp = g->m.veh_at( dest_loc ).part_with_feature( "CARGO",
+                            false ) ) {
+                        free_space = vp->vehicle().free_volume( vp->part_index() );
+                    } else {
+                        free_space = g->m.free_volume( dest_loc );
+                    }
+                    cached_space = dest_free_space.emplace( dest, free_space ).first;
                 }
+                const units::volume free_space = cached_space->second;
                 // check free space at destination
                 if( free_space >= thisitem.volume() ) {
                     move_item( p, thisitem, thisitem.count(), src_loc, dest_loc, this_veh, this_part );
+                    dest_free_space.erase( cached_space );
 
                     // moved item away from source so decrement
                     if( num_processed > 0 ) {
@@ -2478,11 +2486,9 @@ static std::unordered_set<tripoint> generic_multi_activity_locations( player &p,
         src_set = mgr.get_near( zone_type_id( zone_type ), abspos, ACTIVITY_SEARCH_DISTANCE );
         // multiple construction will form a list of targets based on blueprint zones and unfinished constructions
         if( act_id == ACT_MULTIPLE_CONSTRUCTION ) {
-            for( const tripoint &elem : g->m.points_in_radius( localpos, ACTIVITY_SEARCH_DISTANCE ) ) {
-                partial_con *pc = g->m.partial_con_at( elem );
-                if( pc ) {
-                    src_set.insert( g->m.getabs( elem ) );
-                }
+            for( const tripoint &elem : g->m.partial_cons_in_radius( localpos,
+                    ACTIVITY_SEARCH_DISTANCE ) ) {
+                src_set.insert( g->m.getabs( elem ) );
             }
             // farming activities encompass tilling, planting, harvesting.
         } else if( act_id == ACT_MULTIPLE_FARM ) {
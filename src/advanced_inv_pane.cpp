@@ -69,15 +69,13 @@ bool advanced_inventory_pane::is_filtered( const item &it ) const
         return false;
     }
 
-    const std::string str = it.tname();
-    if( filtercache.find( str ) == filtercache.end() ) {
-        const auto filter_fn = item_filter_from_string( filter );
-        filtercache[str] = filter_fn;
-
-        return !filter_fn( it );
+    // The filter only depends on the filter string, so parse it once instead of per item.
+    if( !filter_fn || filter_fn_str != filter ) {
+        filter_fn = item_filter_from_string( filter );
+        filter_fn_str = filter;
     }
 
-    return !filtercache[str]( it );
+    return !filter_fn( it );
 }
 
 void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
@@ -276,6 +274,5 @@ void advanced_inventory_pane::set_filter( const std::string &new_filter )
         return;
     }
     filter = new_filter;
-    filtercache.clear();
     recalc = true;
 }
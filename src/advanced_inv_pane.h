@@ -5,7 +5,6 @@
 #include <array>
 #include <cstddef>
 #include <functional>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -126,6 +125,9 @@ class advanced_inventory_pane
         /** Only add offset to index, but wrap around! */
         void mod_index( int offset );
 
-        mutable std::map<std::string, std::function<bool( const item & )>> filtercache;
+        /** Filter function compiled from @ref filter, built on first use. */
+        mutable std::function<bool( const item & )> filter_fn;
+        /** The filter string @ref filter_fn was compiled from. */
+        mutable std::string filter_fn_str;
 };
 #endif // CATA_SRC_ADVANCED_INV_PANE_H
@@ -3,6 +3,7 @@
 #include <set>
 
 #include "assign.h"
+#include "cached_options.h"
 #include "catacharset.h"
 #include "debug.h"
 #include "generic_factory.h"
@@ -35,9 +36,19 @@ void ascii_art::reset()
 
 void ascii_art::load_ascii_art( const JsonObject &jo, const std::string &src )
 {
+    // Most pictures are never looked at in a session, they are loaded when first displayed.
+    ascii_art_factory.set_lazy_loading( true );
     ascii_art_factory.load( jo, src );
 }
 
+void ascii_art::check_consistency()
+{
+    // Loading reports all the errors in the JSON data, which the tests should see.
+    if( test_mode ) {
+        ascii_art_factory.load_all();
+    }
+}
+
 void ascii_art::load( const JsonObject &jo, const std::string & )
 {
     assign( jo, "id", id );
@@ -15,6 +15,7 @@ class ascii_art
     public:
         static void reset();
         static void load_ascii_art( const JsonObject &jo, const std::string &src );
+        static void check_consistency();
         void load( const JsonObject &jo, const std::string & );
         bool was_loaded = false;
 
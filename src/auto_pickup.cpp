@@ -540,6 +540,7 @@ bool player_settings::has_rule( const item *it )
 void player_settings::add_rule( const item *it )
 {
     character_rules.push_back( rule( it->tname( 1, false ), true, false ) );
+    map_items.erase( it->tname( 1, false ) );
     create_rule( it );
 
     if( !get_option<bool>( "AUTO_PICKUP" ) &&
@@ -619,6 +620,13 @@ void rule_list::create_rule( cache &map_items, const std::string &to_match )
 void player_settings::create_rule( const item *it )
 {
     // TODO: change it to be a reference
+    const std::string to_match = it->tname( 1, false );
+    if( map_items.count( to_match ) != 0 ) {
+        return;
+    }
+    // Remember names no rule matches too, so they are not checked against
+    // every rule again each time the item is seen.
+    map_items[ to_match ] = RULE_NONE;
     global_rules.create_rule( map_items, *it );
     character_rules.create_rule( map_items, *it );
 }
@@ -683,6 +691,11 @@ void rule_list::refresh_map_items( cache &map_items ) const
 }
 
 rule_state base_settings::check_item( const std::string &sItemName ) const
+{
+    return find_item( sItemName ).value_or( RULE_NONE );
+}
+
+cata::optional<rule_state> base_settings::find_item( const std::string &sItemName ) const
 {
     if( !map_items.ready ) {
         recreate();
@@ -693,7 +706,7 @@ rule_state base_settings::check_item( const std::string &sItemName ) const
         return iter->second;
     }
 
-    return RULE_NONE;
+    return cata::nullopt;
 }
 
 void player_settings::clear_character_rules()
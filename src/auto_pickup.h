@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "enums.h"
+#include "optional.h"
 
 class JsonIn;
 class JsonOut;
@@ -23,6 +24,8 @@ namespace auto_pickup
  * lookup. When this is filled (by @ref auto_pickup::create_rule()), every
  * item existing in the game that matches a rule (either white- or blacklist)
  * is added as the key, with RULE_WHITELISTED or RULE_BLACKLISTED as the values.
+ * Items checked later by @ref player_settings::create_rule() are added too,
+ * with RULE_NONE if no rule matches them.
  */
 class cache : public std::unordered_map<std::string, rule_state>
 {
@@ -108,6 +111,9 @@ class base_settings
     public:
         virtual ~base_settings() = default;
         rule_state check_item( const std::string &sItemName ) const;
+        /** Like @ref check_item, but tells names that were never checked (empty) apart from
+         * names no rule matched (RULE_NONE). */
+        cata::optional<rule_state> find_item( const std::string &sItemName ) const;
 };
 
 class player_settings : public base_settings
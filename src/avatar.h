@@ -87,6 +87,8 @@ class avatar : public player
         void toggle_map_memory();
         bool should_show_map_memory();
         void prepare_map_memory_region( const tripoint &p1, const tripoint &p2 );
+        /** Approximate bytes held by the map memory. */
+        size_t map_memory_usage() const;
         /** Memorizes a given tile in tiles mode; finalize_tile_memory needs to be called after it */
         void memorize_tile( const tripoint &pos, const std::string &ter, int subtile,
                             int rotation );
@@ -631,7 +631,8 @@ void basecamp::form_crafting_inventory( map &target_map )
 
     // find available fuel
     for( const tripoint &pt : target_map.points_in_radius( origin, inv_range ) ) {
-        if( target_map.accessible_items( pt ) ) {
+        // has_items first, accessible_items does two flag lookups by name.
+        if( target_map.has_items( pt ) && target_map.accessible_items( pt ) ) {
             for( const item &i : target_map.i_at( pt ) ) {
                 for( basecamp_fuel &bcp_f : fuels ) {
                     if( bcp_f.ammo_id == i.typeId() ) {
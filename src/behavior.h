@@ -58,7 +58,7 @@ class node_t
         node_t();
         // Entry point for tree traversal.
         behavior_return tick( const oracle_t *subject ) const;
-        std::string goal() const;
+        const std::string &goal() const;
 
         // Interface to construct a node.
         void set_strategy( const strategy_t *new_strategy );
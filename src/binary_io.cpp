@@ -0,0 +1,127 @@
+#include "binary_io.h"
+
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+template<typename T>
+static void write_le( std::ostream &out, const T value )
+{
+    char bytes[sizeof( T )];
+    for( size_t i = 0; i < sizeof( T ); ++i ) {
+        bytes[i] = static_cast<char>( ( value >> ( 8 * i ) ) & 0xFF );
+    }
+    out.write( bytes, sizeof( T ) );
+}
+
+template<typename T>
+static T read_le( std::istream &in )
+{
+    unsigned char bytes[sizeof( T )];
+    if( !in.read( reinterpret_cast<char *>( bytes ), sizeof( T ) ) ) {
+        throw std::runtime_error( "unexpected end of binary data" );
+    }
+    T value = 0;
+    for( size_t i = 0; i < sizeof( T ); ++i ) {
+        value |= static_cast<T>( bytes[i] ) << ( 8 * i );
+    }
+    return value;
+}
+
+void binary_writer::write_u8( const uint8_t value )
+{
+    write_le( out, value );
+}
+
+void binary_writer::write_u16( const uint16_t value )
+{
+    write_le( out, value );
+}
+
+void binary_writer::write_u32( const uint32_t value )
+{
+    write_le( out, value );
+}
+
+void binary_writer::write_i32( const int32_t value )
+{
+    write_le( out, static_cast<uint32_t>( value ) );
+}
+
+void binary_writer::write_i64( const int64_t value )
+{
+    write_le( out, static_cast<uint64_t>( value ) );
+}
+
+void binary_writer::write_short_string( const std::string &value )
+{
+    if( value.size() > std::numeric_limits<uint16_t>::max() ) {
+        throw std::runtime_error( "string too long for binary data: " + value.substr( 0, 32 ) );
+    }
+    write_u16( static_cast<uint16_t>( value.size() ) );
+    write_bytes( value.data(), value.size() );
+}
+
+void binary_writer::write_string( const std::string &value )
+{
+    write_u32( static_cast<uint32_t>( value.size() ) );
+    write_bytes( value.data(), value.size() );
+}
+
+void binary_writer::write_bytes( const char *const data, const size_t size )
+{
+    out.write( data, size );
+}
+
+uint8_t binary_reader::read_u8()
+{
+    return read_le<uint8_t>( in );
+}
+
+uint16_t binary_reader::read_u16()
+{
+    return read_le<uint16_t>( in );
+}
+
+uint32_t binary_reader::read_u32()
+{
+    return read_le<uint32_t>( in );
+}
+
+int32_t binary_reader::read_i32()
+{
+    return static_cast<int32_t>( read_le<uint32_t>( in ) );
+}
+
+int64_t binary_reader::read_i64()
+{
+    return static_cast<int64_t>( read_le<uint64_t>( in ) );
+}
+
+std::string binary_reader::read_short_string()
+{
+    std::string result( read_u16(), '\0' );
+    read_bytes( &result[0], result.size() );
+    return result;
+}
+
+std::string binary_reader::read_string()
+{
+    const uint32_t size = read_u32();
+    // Guards against allocating gigabytes because of a corrupted length.
+    static constexpr uint32_t max_size = 1 << 28;
+    if( size > max_size ) {
+        throw std::runtime_error( "corrupted binary data, string of length " + std::to_string( size ) );
+    }
+    std::string result( size, '\0' );
+    read_bytes( &result[0], result.size() );
+    return result;
+}
+
+void binary_reader::read_bytes( char *const data, const size_t size )
+{
+    if( size > 0 && !in.read( data, size ) ) {
+        throw std::runtime_error( "unexpected end of binary data" );
+    }
+}
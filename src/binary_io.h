@@ -0,0 +1,56 @@
+#pragma once
+#ifndef CATA_SRC_BINARY_IO_H
+#define CATA_SRC_BINARY_IO_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/**
+ * Minimal helpers for the binary save formats.
+ * All values are stored little endian with a fixed width, independent of the platform.
+ * Strings are stored as their length followed by their bytes.
+ */
+class binary_writer
+{
+    public:
+        explicit binary_writer( std::ostream &out ) : out( out ) {}
+
+        void write_u8( uint8_t value );
+        void write_u16( uint16_t value );
+        void write_u32( uint32_t value );
+        void write_i32( int32_t value );
+        void write_i64( int64_t value );
+        /** Length as u16, throws if the string is longer than that. */
+        void write_short_string( const std::string &value );
+        /** Length as u32. */
+        void write_string( const std::string &value );
+        void write_bytes( const char *data, size_t size );
+
+    private:
+        std::ostream &out;
+};
+
+/**
+ * Counterpart of @ref binary_writer.
+ * All functions throw std::runtime_error when the input ends prematurely.
+ */
+class binary_reader
+{
+    public:
+        explicit binary_reader( std::istream &in ) : in( in ) {}
+
+        uint8_t read_u8();
+        uint16_t read_u16();
+        uint32_t read_u32();
+        int32_t read_i32();
+        int64_t read_i64();
+        std::string read_short_string();
+        std::string read_string();
+        void read_bytes( char *data, size_t size );
+
+    private:
+        std::istream &in;
+};
+
+#endif // CATA_SRC_BINARY_IO_H
@@ -369,6 +369,15 @@ std::string get_body_part_id( body_part bp )
     return get_bp( bp ).legacy_id;
 }
 
+bodypart::bodypart() : id( bodypart_str_id( "num_bp" ) ), hp_cur( 0 ), hp_max( 0 )
+{
+}
+
+bodypart::bodypart( const bodypart_str_id &id ) : id( id ), hp_cur( id->base_hp ),
+    hp_max( id->base_hp )
+{
+}
+
 bodypart_id bodypart::get_id() const
 {
     return id;
@@ -462,7 +471,7 @@ void bodypart::mod_damage_disinfected( int mod )
 void bodypart::serialize( JsonOut &json ) const
 {
     json.start_object();
-    json.member( "id", id );
+    json.member( "id", id.id() );
     json.member( "hp_cur", hp_cur );
     json.member( "hp_max", hp_max );
     json.member( "damage_bandaged", damage_bandaged );
@@ -473,7 +482,9 @@ void bodypart::serialize( JsonOut &json ) const
 void bodypart::deserialize( JsonIn &jsin )
 {
     JsonObject jo = jsin.get_object();
-    jo.read( "id", id, true );
+    bodypart_str_id str_id;
+    jo.read( "id", str_id, true );
+    id = str_id;
     jo.read( "hp_cur", hp_cur, true );
     jo.read( "hp_max", hp_max, true );
     jo.read( "damage_bandaged", damage_bandaged, true );
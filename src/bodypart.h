@@ -142,7 +142,7 @@ struct body_part_type {
 class bodypart
 {
     private:
-        bodypart_str_id id;
+        bodypart_id id;
 
         int hp_cur;
         int hp_max;
@@ -153,8 +153,8 @@ class bodypart
         int damage_disinfected = 0;
 
     public:
-        bodypart(): id( bodypart_str_id( "num_bp" ) ), hp_cur( 0 ), hp_max( 0 ) {}
-        bodypart( bodypart_str_id id ): id( id ), hp_cur( id->base_hp ), hp_max( id->base_hp )  {}
+        bodypart();
+        bodypart( const bodypart_str_id &id );
 
         bodypart_id get_id() const;
 
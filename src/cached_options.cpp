@@ -12,4 +12,6 @@ bool fov_3d;
 int fov_3d_z_range;
 bool tile_iso;
 bool pixel_minimap_option = false;
+bool item_health_bar;
+bool ammo_in_names;
 int PICKUP_RANGE;
@@ -58,6 +58,12 @@ extern bool tile_iso;
  */
 extern bool pixel_minimap_option;
 
+/** Item condition is shown as a colored bar instead of a word, for every item name. */
+extern bool item_health_bar;
+
+/** Names of guns and magazines include their current ammo. */
+extern bool ammo_in_names;
+
 /**
  * Items on the map with at most this distance to the player are considered
  * available for crafting, see inventory::form_from_map
@@ -194,11 +194,18 @@ double current_daylight_level( const time_point &p )
 
 float sunlight( const time_point &p, const bool vision )
 {
+    // Same tests as is_night, is_dawn and is_dusk, but with sunrise and sunset computed once,
+    // this is called for every tick of a weather sum.
     const time_duration now = time_past_midnight( p );
     const time_duration sunrise = time_past_midnight( ::sunrise( p ) );
     const time_duration sunset = time_past_midnight( ::sunset( p ) );
 
-    const double daylight_level = current_daylight_level( p );
+    const bool night = now >= sunset + twilight_duration || now <= sunrise;
+    const bool dawn = now >= sunrise && now <= sunrise + twilight_duration;
+    const bool dusk = now >= sunset && now <= sunset + twilight_duration;
+    if( !night && !dawn && !dusk ) {
+        return current_daylight_level( p );
+    }
 
     int current_phase = static_cast<int>( get_moon_phase( p ) );
     if( current_phase > static_cast<int>( MOON_PHASE_MAX ) / 2 ) {
@@ -208,16 +215,16 @@ float sunlight( const time_point &p, const bool vision )
     const int moonlight = vision ? 1 + static_cast<int>( current_phase * moonlight_per_quarter ) :
                           0;
 
-    if( is_night( p ) ) {
+    if( night ) {
         return moonlight;
-    } else if( is_dawn( p ) ) {
+    }
+    const double daylight_level = current_daylight_level( p );
+    if( dawn ) {
         const double percent = ( now - sunrise ) / twilight_duration;
         return static_cast<double>( moonlight ) * ( 1. - percent ) + daylight_level * percent;
-    } else if( is_dusk( p ) ) {
+    } else {
         const double percent = ( now - sunset ) / twilight_duration;
         return daylight_level * ( 1. - percent ) + static_cast<double>( moonlight ) * percent;
-    } else {
-        return daylight_level;
     }
 }
 
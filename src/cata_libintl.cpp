@@ -716,19 +716,30 @@ const char *trans_catalogue::get_nth_pl_translation( u32 n, size_t num ) const
 // Translation library
 // ===============================================================================================
 
+// FNV-1a
+static u32 hash_string( const char *str )
+{
+    u32 hash = 2166136261u;
+    for( ; *str; str++ ) {
+        hash ^= static_cast<unsigned char>( *str );
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
 std::vector<trans_library::library_string_descr>::const_iterator trans_library::find_entry(
     const char *id ) const
 {
-    auto it = std::lower_bound( strings.begin(), strings.end(),
-    id, [this]( const library_string_descr & a_descr, const char *b ) -> bool {
-        const char *a = this->catalogues[a_descr.catalogue].get_nth_orig_string( a_descr.entry );
-        return strcmp( a, b ) < 0;
-    } );
+    if( string_index.empty() ) {
+        return strings.end();
+    }
 
-    if( it != strings.end() ) {
-        const char *found = catalogues[it->catalogue].get_nth_orig_string( it->entry );
-        if( strcmp( id, found ) == 0 ) {
-            return it;
+    const size_t mask = string_index.size() - 1;
+    for( size_t slot = hash_string( id ) & mask; string_index[slot] != 0;
+         slot = ( slot + 1 ) & mask ) {
+        const library_string_descr &descr = strings[string_index[slot] - 1];
+        if( strcmp( catalogues[descr.catalogue].get_nth_orig_string( descr.entry ), id ) == 0 ) {
+            return strings.begin() + ( string_index[slot] - 1 );
         }
     }
 
@@ -739,30 +750,44 @@ void trans_library::build_string_table()
 {
     assert( strings.empty() );
 
+    size_t total = 0;
+    for( const trans_catalogue &cat : catalogues ) {
+        total += cat.get_num_strings();
+    }
+    // Power of two size with load factor at most 1/2 keeps the probe sequences short
+    size_t table_size = 1;
+    while( table_size < total * 2 ) {
+        table_size *= 2;
+    }
+    string_index.assign( table_size, 0 );
+    strings.reserve( total );
+    const size_t mask = table_size - 1;
+
     for( size_t i_cat = 0; i_cat < catalogues.size(); i_cat++ ) {
         const trans_catalogue &cat = catalogues[i_cat];
         u32 num = cat.get_num_strings();
         // 0th entry is the metadata, we skip it
-        strings.reserve( num - 1 );
         for( u32 i = 1; i < num; i++ ) {
             const char *i_cstr = cat.get_nth_orig_string( i );
 
-            auto it = std::lower_bound( strings.begin(), strings.end(),
-            i_cstr, [this]( const library_string_descr & a_descr, const char *b ) -> bool {
-                const char *a = this->catalogues[a_descr.catalogue].get_nth_orig_string( a_descr.entry );
-                return strcmp( a, b ) < 0;
-            } );
-
-            library_string_descr desc = { static_cast<u32>( i_cat ), i };
-            if( it == strings.end() ) {
-                // Not found, or all elements are greater
-                strings.push_back( desc );
-            } else if( strcmp( catalogues[it->catalogue].get_nth_orig_string( it->entry ), i_cstr ) == 0 ) {
+            size_t slot = hash_string( i_cstr ) & mask;
+            bool exists = false;
+            for( ; string_index[slot] != 0; slot = ( slot + 1 ) & mask ) {
+                const library_string_descr &descr = strings[string_index[slot] - 1];
+                const char *existing = catalogues[descr.catalogue].get_nth_orig_string( descr.entry );
+                if( strcmp( existing, i_cstr ) == 0 ) {
+                    exists = true;
+                    break;
+                }
+            }
+            if( exists ) {
                 // Don't overwrite existing strings
                 continue;
-            } else {
-                strings.insert( it, desc );
             }
+
+            library_string_descr desc = { static_cast<u32>( i_cat ), i };
+            strings.push_back( desc );
+            string_index[slot] = static_cast<u32>( strings.size() );
         }
     }
 }
@@ -188,6 +188,9 @@ class trans_library
         // Full index of loaded strings
         std::vector<library_string_descr> strings;
 
+        // Open-addressed hash table over @ref strings, holds index + 1 or 0 for empty slots
+        std::vector<u32> string_index;
+
         // Full index of loaded catalogues
         std::vector<trans_catalogue> catalogues;
 
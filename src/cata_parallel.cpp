@@ -0,0 +1,62 @@
+#include "cata_parallel.h"
+
+#include <algorithm>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+static int default_thread_count()
+{
+    // hardware_concurrency is allowed to return 0 when it can't tell
+    return std::max( 1, static_cast<int>( std::thread::hardware_concurrency() ) );
+}
+
+static int thread_count = default_thread_count();
+
+int cata::parallel_thread_count()
+{
+    return thread_count;
+}
+
+void cata::set_parallel_thread_count( const int count )
+{
+    thread_count = std::max( 1, count );
+}
+
+void cata::parallel_for( const int begin, const int end, const std::function<void( int )> &f )
+{
+    const int threads = std::min( end - begin, thread_count );
+    if( threads <= 1 ) {
+        for( int i = begin; i < end; ++i ) {
+            f( i );
+        }
+        return;
+    }
+
+    // Interleave the indices so that neighbouring (and similarly expensive) items
+    // end up on different threads.
+    const auto run_slice = [&]( const int slice ) {
+        for( int i = begin + slice; i < end; i += threads ) {
+            f( i );
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve( threads - 1 );
+    for( int slice = 1; slice < threads; ++slice ) {
+        try {
+            workers.emplace_back( run_slice, slice );
+        } catch( std::system_error & ) {
+            // Out of threads, do this slice ourselves.
+            run_slice( slice );
+        }
+    }
+    run_slice( 0 );
+    for( std::thread &worker : workers ) {
+        worker.join();
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+#ifndef CATA_SRC_CATA_PARALLEL_H
+#define CATA_SRC_CATA_PARALLEL_H
+
+#include <functional>
+
+namespace cata
+{
+
+/**
+ * Number of threads parallel_for spreads its work over, including the calling thread.
+ * Defaults to the number of hardware threads. A value of 1 runs everything serially.
+ */
+int parallel_thread_count();
+void set_parallel_thread_count( int count );
+
+/**
+ * Calls `f( i )` for every `i` in [begin, end), spreading the calls over up to
+ * parallel_thread_count() threads, and returns once all of them have finished.
+ *
+ * `f` must be safe to call concurrently for different values of `i` and must not throw.
+ * Most of the game state is not thread-safe, so `f` should only read shared data and
+ * write to data owned by its own index. In particular it must not call debugmsg,
+ * add_msg or anything else that touches the UI.
+ */
+void parallel_for( int begin, int end, const std::function<void( int )> &f );
+
+} // namespace cata
+
+#endif // CATA_SRC_CATA_PARALLEL_H
@@ -13,6 +13,7 @@
 #include <stdexcept>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 
 #include "action.h"
 #include "avatar.h"
@@ -52,6 +53,7 @@
 #include "path_info.h"
 #include "pixel_minimap.h"
 #include "player.h"
+#include "profiler.h"
 #include "rect_range.h"
 #include "scent_map.h"
 #include "sdl_utils.h"
@@ -802,7 +804,7 @@ void tileset_loader::process_variations_after_loading( weighted_int_list<std::ve
         std::remove_if(
             vs.begin(),
             vs.end(),
-    [&]( weighted_object<int, std::vector<int>> o ) {
+    [&]( const weighted_object<int, std::vector<int>> &o ) {
         return o.obj.empty();
     }
         ),
@@ -1100,6 +1102,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                        std::multimap<point, formatted_text> &overlay_strings,
                        color_block_overlay_container &color_blocks )
 {
+    profiler::scoped_zone zone( "cata_tiles::draw" );
     if( !g ) {
         return;
     }
@@ -1582,12 +1585,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         };
 
         const auto is_mapbuffer = []( const tripoint & p ) {
-            for( const auto &it : MAPBUFFER ) {
-                if( it.first == p ) {
-                    return true;
-                }
-            }
-            return false;
+            return MAPBUFFER.is_submap_loaded( p );
         };
 
         constexpr int THICC = 1; // line thickness
@@ -2301,22 +2299,28 @@ bool cata_tiles::apply_vision_effects( const tripoint &pos,
     if( !would_apply_vision_effects( visibility ) ) {
         return false;
     }
-    std::string light_name;
+    // Static so that darkened tiles don't build a new id string on every redraw
+    static const std::string lighting_hidden = "lighting_hidden";
+    static const std::string lighting_lowlight_light = "lighting_lowlight_light";
+    static const std::string lighting_boomered_light = "lighting_boomered_light";
+    static const std::string lighting_boomered_dark = "lighting_boomered_dark";
+    static const std::string lighting_lowlight_dark = "lighting_lowlight_dark";
+    const std::string *light_name = &empty_string;
     switch( visibility ) {
         case VIS_HIDDEN:
-            light_name = "lighting_hidden";
+            light_name = &lighting_hidden;
             break;
         case VIS_LIT:
-            light_name = "lighting_lowlight_light";
+            light_name = &lighting_lowlight_light;
             break;
         case VIS_BOOMER:
-            light_name = "lighting_boomered_light";
+            light_name = &lighting_boomered_light;
             break;
         case VIS_BOOMER_DARK:
-            light_name = "lighting_boomered_dark";
+            light_name = &lighting_boomered_dark;
             break;
         case VIS_DARK:
-            light_name = "lighting_lowlight_dark";
+            light_name = &lighting_lowlight_dark;
             break;
         case VIS_CLEAR:
             // should never happen
@@ -2324,7 +2328,7 @@ bool cata_tiles::apply_vision_effects( const tripoint &pos,
     }
 
     // lighting is never rotated, though, could possibly add in random rotation?
-    draw_from_id_string( light_name, C_LIGHTING, empty_string, pos, 0, 0, LL_LIT, false );
+    draw_from_id_string( *light_name, C_LIGHTING, empty_string, pos, 0, 0, LL_LIT, false );
 
     return true;
 }
@@ -3636,78 +3640,32 @@ void cata_tiles::get_terrain_orientation( const tripoint &p, int &rota, int &sub
 
 void cata_tiles::get_rotation_and_subtile( const char val, int &rotation, int &subtile )
 {
-    switch( val ) {
-        // no connections
-        case 0:
-            subtile = unconnected;
-            rotation = 0;
-            break;
-        // all connections
-        case 15:
-            subtile = center;
-            rotation = 0;
-            break;
-        // end pieces
-        case 8:
-            subtile = end_piece;
-            rotation = 2;
-            break;
-        case 4:
-            subtile = end_piece;
-            rotation = 3;
-            break;
-        case 2:
-            subtile = end_piece;
-            rotation = 1;
-            break;
-        case 1:
-            subtile = end_piece;
-            rotation = 0;
-            break;
-        // edges
-        case 9:
-            subtile = edge;
-            rotation = 0;
-            break;
-        case 6:
-            subtile = edge;
-            rotation = 1;
-            break;
-        // corners
-        case 12:
-            subtile = corner;
-            rotation = 2;
-            break;
-        case 10:
-            subtile = corner;
-            rotation = 1;
-            break;
-        case 3:
-            subtile = corner;
-            rotation = 0;
-            break;
-        case 5:
-            subtile = corner;
-            rotation = 3;
-            break;
-        // all t_connections
-        case 14:
-            subtile = t_connection;
-            rotation = 2;
-            break;
-        case 11:
-            subtile = t_connection;
-            rotation = 1;
-            break;
-        case 7:
-            subtile = t_connection;
-            rotation = 0;
-            break;
-        case 13:
-            subtile = t_connection;
-            rotation = 3;
-            break;
+    // Subtile and rotation for each combination of connections, indexed by the
+    // connection bits: 1 = south, 2 = east, 4 = west, 8 = north.
+    static constexpr std::array<std::pair<MULTITILE_TYPE, int>, 16> connection_table = {{
+            { unconnected, 0 }, // no connections
+            { end_piece, 0 },
+            { end_piece, 1 },
+            { corner, 0 },
+            { end_piece, 3 },
+            { corner, 3 },
+            { edge, 1 },
+            { t_connection, 0 },
+            { end_piece, 2 },
+            { edge, 0 },
+            { corner, 1 },
+            { t_connection, 1 },
+            { corner, 2 },
+            { t_connection, 3 },
+            { t_connection, 2 },
+            { center, 0 } // all connections
+        }
+    };
+    if( val < 0 || val >= static_cast<int>( connection_table.size() ) ) {
+        return;
     }
+    subtile = connection_table[val].first;
+    rotation = connection_table[val].second;
 }
 
 void cata_tiles::get_connect_values( const tripoint &p, int &subtile, int &rotation,
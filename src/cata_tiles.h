@@ -107,10 +107,14 @@ class texture
         }
         /// Interface to @ref SDL_RenderCopyEx, using this as the texture, and
         /// null as source rectangle (render the whole texture). Other parameters
-        /// are simply passed through.
+        /// are simply passed through. Unrotated, unflipped sprites (most of them)
+        /// go through the cheaper @ref SDL_RenderCopy instead.
         int render_copy_ex( const SDL_Renderer_Ptr &renderer, const SDL_Rect *const dstrect,
                             const double angle,
                             const SDL_Point *const center, const SDL_RendererFlip flip ) const {
+            if( angle == 0 && flip == SDL_FLIP_NONE ) {
+                return SDL_RenderCopy( renderer.get(), sdl_texture_ptr.get(), &srcrect, dstrect );
+            }
             return SDL_RenderCopyEx( renderer.get(), sdl_texture_ptr.get(), &srcrect, dstrect, angle, center,
                                      flip );
         }
@@ -24,6 +24,15 @@
 #if defined (_WIN32) && !defined (_MSC_VER)
 #include <ext/stdio_filebuf.h>
 #endif
+#if defined(__GLIBC__)
+#   include <malloc.h>
+#endif
+
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#  if __GLIBC_PREREQ( 2, 33 )
+#    define CATA_HAS_MALLINFO2
+#  endif
+#endif
 
 static double pow10( unsigned int n )
 {
@@ -153,25 +162,13 @@ double clamp_to_width( double value, int width, int &scale, bool *out_truncated
     return value;
 }
 
-float multi_lerp( const std::vector<std::pair<float, float>> &points, float x )
+int64_t heap_in_use()
 {
-    size_t i = 0;
-    while( i < points.size() && points[i].first <= x ) {
-        i++;
-    }
-
-    if( i == 0 ) {
-        return points.front().second;
-    } else if( i >= points.size() ) {
-        return points.back().second;
-    }
-
-    // How far are we along the way from last threshold to current one
-    const float t = ( x - points[i - 1].first ) /
-                    ( points[i].first - points[i - 1].first );
-
-    // Linear interpolation of values at relevant thresholds
-    return ( t * points[i].second ) + ( ( 1 - t ) * points[i - 1].second );
+#if defined(CATA_HAS_MALLINFO2)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
 }
 
 static std::ios_base::openmode cata_ios_mode_to_std( std::ios_base::openmode dir, cata_ios_mode m )
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_CATA_UTILITY_H
 #define CATA_SRC_CATA_UTILITY_H
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <utility>
@@ -169,8 +170,32 @@ constexpr T lerp_clamped( const T &min, const T &max, float t )
  * Then linearly interpolates between p1.second and p2.second and returns the result.
  * `points` should be sorted by first elements of the pairs.
  * If x is outside range, returns second value of the first (if x < points[0].first) or last point.
+ * Any random access container of pairs works, so fixed tables can live in a std::array.
  */
-float multi_lerp( const std::vector<std::pair<float, float>> &points, float x );
+template<typename Points>
+float multi_lerp( const Points &points, float x )
+{
+    size_t i = 0;
+    while( i < points.size() && points[i].first <= x ) {
+        i++;
+    }
+
+    if( i == 0 ) {
+        return points.front().second;
+    } else if( i >= points.size() ) {
+        return points.back().second;
+    }
+
+    // How far are we along the way from last threshold to current one
+    const float t = ( x - points[i - 1].first ) /
+                    ( points[i].first - points[i - 1].first );
+
+    // Linear interpolation of values at relevant thresholds
+    return ( t * points[i].second ) + ( ( 1 - t ) * points[i - 1].second );
+}
+
+/** Bytes currently allocated through malloc, or 0 where that can not be queried. */
+int64_t heap_in_use();
 
 /**
  * @brief Class used to access a list as if it were circular.
@@ -141,12 +141,18 @@ std::string utf32_to_utf8( uint32_t ch )
 //CJK characters have a width of 2, etc
 int utf8_width( const char *s, const bool ignore_tags )
 {
-    if( ignore_tags ) {
+    // Color tags always start with '<', so there's nothing to remove without one
+    if( ignore_tags && strchr( s, '<' ) != nullptr ) {
         return utf8_width( remove_color_tags( s ) );
     }
-    int len = strlen( s );
     const char *ptr = s;
     int w = 0;
+    // Printable ASCII is one column wide, skip decoding for it
+    while( *ptr >= 0x20 && *ptr < 0x7f ) {
+        ++ptr;
+        ++w;
+    }
+    int len = strlen( ptr );
     while( len > 0 ) {
         uint32_t ch = UTF8_getch( &ptr, &len );
         if( ch == UNKNOWN_UNICODE ) {
@@ -159,7 +165,10 @@ int utf8_width( const char *s, const bool ignore_tags )
 
 int utf8_width( const std::string &str, const bool ignore_tags )
 {
-    return utf8_width( str.c_str(), ignore_tags );
+    if( ignore_tags && str.find( '<' ) != std::string::npos ) {
+        return utf8_width( remove_color_tags( str ) );
+    }
+    return utf8_width( str.c_str() );
 }
 
 int utf8_width( const utf8_wrapper &str, const bool ignore_tags )
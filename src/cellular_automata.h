@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_CELLULAR_AUTOMATA_H
 #define CATA_SRC_CELLULAR_AUTOMATA_H
 
+#include <algorithm>
 #include <vector>
 
 #include "point.h"
@@ -70,29 +71,33 @@ inline std::vector<std::vector<int>> generate_cellular_automaton( const point &s
 
     for( int iteration = 0; iteration < iterations; iteration++ ) {
         for( int i = 0; i < size.x; i++ ) {
+            std::vector<int> &out = next[i];
+            // Skip the edges--no need to complicate this with more complex neighbor
+            // calculations, just keep them constant.
+            if( i == 0 || i == size.x - 1 ) {
+                std::fill( out.begin(), out.end(), 0 );
+                continue;
+            }
+            // Every cell off the edges has all of its neighbors in bounds.
+            const std::vector<int> &left = current[i - 1];
+            const std::vector<int> &here = current[i];
+            const std::vector<int> &right = current[i + 1];
             for( int j = 0; j < size.y; j++ ) {
-                // Skip the edges--no need to complicate this with more complex neighbor
-                // calculations, just keep them constant.
-                if( i == 0 || i == size.x - 1 || j == 0 || j == size.y - 1 ) {
-                    next[i][j] = 0;
+                if( j == 0 || j == size.y - 1 ) {
+                    out[j] = 0;
                     continue;
                 }
 
                 // Count our neighors.
-                const int neighbors = neighbor_count( current, size, point( i, j ) );
+                const int neighbors = left[j - 1] + left[j] + left[j + 1] +
+                                      here[j - 1] + here[j + 1] +
+                                      right[j - 1] + right[j] + right[j + 1];
 
                 // Dead and > birth_limit neighbors, so become alive.
-                if( ( current[i][j] == 0 ) && ( neighbors > birth_limit ) ) {
-                    next[i][j] = 1;
-                }
                 // Alive and > statis_limit neighbors, so stay alive.
-                else if( ( current[i][j] == 1 ) && ( neighbors > stasis_limit ) ) {
-                    next[i][j] = 1;
-                }
                 // Else, die.
-                else {
-                    next[i][j] = 0;
-                }
+                const int limit = here[j] == 0 ? birth_limit : stasis_limit;
+                out[j] = neighbors > limit ? 1 : 0;
             }
         }
 
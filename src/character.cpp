@@ -1639,11 +1639,11 @@ void Character::recalc_hp()
 
 void Character::calc_all_parts_hp( float hp_mod, float hp_adjustment, int str_max )
 {
-    for( const std::pair<const bodypart_str_id, bodypart> &part : get_body() ) {
-        bodypart &bp = *get_part( part.first );
-        int new_max = ( part.first->base_hp + str_max * 3 + hp_adjustment ) * hp_mod;
+    for( const bodypart &part : get_body() ) {
+        bodypart &bp = *get_part( part.get_id() );
+        int new_max = ( part.get_id()->base_hp + str_max * 3 + hp_adjustment ) * hp_mod;
 
-        if( has_trait( trait_id( "GLASSJAW" ) ) && part.first == bodypart_str_id( "head" ) ) {
+        if( has_trait( trait_id( "GLASSJAW" ) ) && part.get_id() == bodypart_str_id( "head" ) ) {
             new_max *= 0.8;
         }
 
@@ -3319,14 +3319,17 @@ void Character::do_skill_rust()
     static const std::string PRED2( "PRED2" );
     static const std::string PRED3( "PRED3" );
     static const std::string PRED4( "PRED4" );
+    // Same for every skill, so check the traits and bionics once instead of per skill
+    const bool predator_memory =
+        ( has_trait_flag( PRED2 ) && calendar::once_every( 8_hours ) ) ||
+        ( has_trait_flag( PRED3 ) && calendar::once_every( 4_hours ) ) ||
+        ( has_trait_flag( PRED4 ) && calendar::once_every( 3_hours ) );
+    const bool has_bio_memory = has_active_bionic( bio_memory );
     for( std::pair<const skill_id, SkillLevel> &pair : *_skills ) {
         const Skill &aSkill = *pair.first;
         SkillLevel &skill_level_obj = pair.second;
 
-        if( aSkill.is_combat_skill() &&
-            ( ( has_trait_flag( PRED2 ) && calendar::once_every( 8_hours ) ) ||
-              ( has_trait_flag( PRED3 ) && calendar::once_every( 4_hours ) ) ||
-              ( has_trait_flag( PRED4 ) && calendar::once_every( 3_hours ) ) ) ) {
+        if( aSkill.is_combat_skill() && predator_memory ) {
             // Their brain is optimized to remember this
             if( one_in( 13 ) ) {
                 // They've already passed the roll to avoid rust at
@@ -3344,7 +3347,7 @@ void Character::do_skill_rust()
             continue;
         }
 
-        const bool charged_bio_mem = get_power_level() > 25_J && has_active_bionic( bio_memory );
+        const bool charged_bio_mem = has_bio_memory && get_power_level() > 25_J;
         const int oldSkillLevel = skill_level_obj.level();
         if( skill_level_obj.rust( charged_bio_mem, rust_rate_tmp ) ) {
             add_msg_if_player( m_warning,
@@ -3697,6 +3700,49 @@ int Character::get_wind_resistance( const bodypart_id &bp ) const
     return totalCoverage;
 }
 
+std::array<int, num_bp> Character::get_wind_resistance_all() const
+{
+    std::array<int, num_bp> ret;
+    // Your shell provides complete wind protection if you're inside it
+    if( has_active_mutation( trait_SHELL2 ) ) {
+        ret.fill( 100 );
+        return ret;
+    }
+
+    std::array<float, num_bp> totalExposed;
+    totalExposed.fill( 1.0 );
+    const std::vector<bodypart_id> all_parts = get_all_body_parts();
+    for( const item &i : worn ) {
+        // Same material penalties as get_wind_resistance, looked up once per item
+        int penalty = -1;
+        for( const bodypart_id &bp : all_parts ) {
+            if( !i.covers( bp->token ) ) {
+                continue;
+            }
+            if( penalty < 0 ) {
+                if( i.made_of( material_id( "leather" ) ) || i.made_of( material_id( "plastic" ) ) ||
+                    i.made_of( material_id( "bone" ) ) ||
+                    i.made_of( material_id( "chitin" ) ) || i.made_of( material_id( "nomex" ) ) ) {
+                    penalty = 10;
+                } else if( i.made_of( material_id( "cotton" ) ) ) {
+                    penalty = 30;
+                } else if( i.made_of( material_id( "wool" ) ) ) {
+                    penalty = 40;
+                } else {
+                    penalty = 1;
+                }
+            }
+            const int coverage = std::max( 0, i.get_coverage() - penalty );
+            totalExposed[bp->token] *= ( 1.0 - coverage / 100.0 );
+        }
+    }
+
+    for( size_t bp = 0; bp < num_bp; ++bp ) {
+        ret[bp] = 100 - totalExposed[bp] * 100;
+    }
+    return ret;
+}
+
 void layer_details::reset()
 {
     *this = layer_details();
@@ -4527,8 +4573,10 @@ void Character::update_body( const time_point &from, const time_point &to )
         update_health( has_trait( trait_RADIOGENIC ) ? 0 : -get_rad() );
     }
 
+    // Look the mutations up once rather than once per vitamin
+    const std::vector<trait_id> mutations = get_mutations();
     for( const auto &v : vitamin::all() ) {
-        const time_duration rate = vitamin_rate( v.first );
+        const time_duration rate = vitamin_rate( v.first, mutations );
         if( rate > 0_turns ) {
             int qty = ticks_between( from, to, rate );
             if( qty > 0 ) {
@@ -5097,6 +5145,10 @@ void Character::update_bodytemp( const map &m, weather_manager &weather )
     temp_equalizer( bodypart_id( "leg_l" ), bodypart_id( "foot_l" ) );
     temp_equalizer( bodypart_id( "leg_r" ), bodypart_id( "foot_r" ) );
 
+    // Clothing doesn't change during the update, so resolve it for all parts in one pass
+    const std::array<int, num_bp> bp_warmth = warmth_all();
+    const std::array<int, num_bp> bp_wind_resistance = get_wind_resistance_all();
+
     // Current temperature and converging temperature calculations
     for( const bodypart_id &bp : get_all_body_parts() ) {
         // Skip eyes
@@ -5120,11 +5172,12 @@ void Character::update_bodytemp( const map &m, weather_manager &weather )
                                     temp_cur[bp->token] );
         // Produces a smooth curve between 30.0 and 60.0.
         double homeostasis_adjustement = 30.0 * ( 1.0 + scaled_temperature );
-        int clothing_warmth_adjustement = static_cast<int>( homeostasis_adjustement * warmth( bp ) );
+        int clothing_warmth_adjustement = static_cast<int>( homeostasis_adjustement *
+                                          bp_warmth[bp->token] );
         int clothing_warmth_adjusted_bonus = static_cast<int>( homeostasis_adjustement * bonus_item_warmth(
                 bp ) );
         // WINDCHILL
-        double bp_windpower = total_windpower * ( 1 - get_wind_resistance( bp ) / 100.0 );
+        double bp_windpower = total_windpower * ( 1 - bp_wind_resistance[bp->token] / 100.0 );
         // Calculate windchill
         int windchill = submerged_bp
                         ? 0
@@ -5297,11 +5350,11 @@ void Character::update_bodytemp( const map &m, weather_manager &weather )
             int wetness_percentage = 100 * body_wetness[bp->token] / drench_capacity[bp->token]; // 0 - 100
             // Warmth gives a slight buff to temperature resistance
             // Wetness gives a heavy nerf to temperature resistance
-            double adjusted_warmth = warmth( bp ) - wetness_percentage;
+            double adjusted_warmth = bp_warmth[bp->token] - wetness_percentage;
             int Ftemperature = static_cast<int>( player_local_temp + 0.2 * adjusted_warmth );
             // Windchill reduced by your armor
             int FBwindPower = static_cast<int>(
-                                  total_windpower * ( 1 - get_wind_resistance( bp ) / 100.0 ) );
+                                  total_windpower * ( 1 - bp_wind_resistance[bp->token] / 100.0 ) );
 
             int intense = get_effect_int( effect_frostbite, bp->token );
 
@@ -6463,7 +6516,8 @@ float calc_mutation_value_multiplicative( const std::vector<const mutation_branc
     return ret;
 }
 
-static const std::map<std::string, std::function <float( std::vector<const mutation_branch *> )>>
+static const
+std::map<std::string, std::function <float( const std::vector<const mutation_branch *> & )>>
 mutation_value_map = {
     { "healing_awake", calc_mutation_value<&mutation_branch::healing_awake> },
     { "healing_resting", calc_mutation_value<&mutation_branch::healing_resting> },
@@ -6503,15 +6557,21 @@ mutation_value_map = {
 
 float Character::mutation_value( const std::string &val ) const
 {
+    const auto cached = cached_mutation_values.find( val );
+    if( cached != cached_mutation_values.end() ) {
+        return cached->second;
+    }
+
     // Syntax similar to tuple get<n>()
     const auto found = mutation_value_map.find( val );
 
     if( found == mutation_value_map.end() ) {
         debugmsg( "Invalid mutation value name %s", val );
         return 0.0f;
-    } else {
-        return found->second( cached_mutations );
     }
+    const float result = found->second( cached_mutations );
+    cached_mutation_values.emplace( val, result );
+    return result;
 }
 
 float Character::healing_rate( float at_rest_quality ) const
@@ -7564,21 +7624,26 @@ void Character::build_mut_dependency_map( const trait_id &mut,
 
 void Character::set_highest_cat_level()
 {
+    static const std::string flag_NON_THRESH( "NON_THRESH" );
     mutation_category_level.clear();
 
+    // One map reused for all mutations, it is cleared rather than reallocated each time.
+    std::unordered_map<trait_id, int> dependency_map;
     // For each of our mutations...
     for( const trait_id &mut : get_mutations() ) {
         // ...build up a map of all prerequisite/replacement mutations along the tree, along with their distance from the current mutation
-        std::unordered_map<trait_id, int> dependency_map;
+        dependency_map.clear();
         build_mut_dependency_map( mut, dependency_map, 0 );
 
         // Then use the map to set the category levels
         for( const std::pair<const trait_id, int> &i : dependency_map ) {
+            // Decay category strength based on how far it is from the current mutation,
+            // halving it with each step: 8, 4, 2, 1 and nothing from 4 steps away.
+            const int strength = i.second < 4 ? 8 >> i.second : 0;
             const mutation_branch &mdata = i.first.obj();
-            if( !mdata.flags.count( "NON_THRESH" ) ) {
+            if( !mdata.flags.count( flag_NON_THRESH ) ) {
                 for( const std::string &cat : mdata.category ) {
-                    // Decay category strength based on how far it is from the current mutation
-                    mutation_category_level[cat] += 8 / static_cast<int>( std::pow( 2, i.second ) );
+                    mutation_category_level[cat] += strength;
                 }
             }
         }
@@ -7588,23 +7653,19 @@ void Character::set_highest_cat_level()
 void Character::drench_mut_calc()
 {
     for( const body_part bp : all_body_parts ) {
-        int ignored = 0;
-        int neutral = 0;
-        int good = 0;
-
-        for( const trait_id &iter : get_mutations() ) {
-            const mutation_branch &mdata = iter.obj();
-            const auto wp_iter = mdata.protection.find( bp );
-            if( wp_iter != mdata.protection.end() ) {
-                ignored += wp_iter->second.x;
-                neutral += wp_iter->second.y;
-                good += wp_iter->second.z;
+        mut_drench[bp].fill( 0 );
+    }
+    // Few mutations protect anything, so walk their protection maps once rather than
+    // looking every body part up in every mutation.
+    for( const trait_id &iter : get_mutations() ) {
+        for( const std::pair<const body_part, tripoint> &wp : iter->protection ) {
+            if( wp.first >= num_bp ) {
+                continue;
             }
+            mut_drench[wp.first][WT_GOOD] += wp.second.z;
+            mut_drench[wp.first][WT_NEUTRAL] += wp.second.y;
+            mut_drench[wp.first][WT_IGNORED] += wp.second.x;
         }
-
-        mut_drench[bp][WT_GOOD] = good;
-        mut_drench[bp][WT_NEUTRAL] = neutral;
-        mut_drench[bp][WT_IGNORED] = ignored;
     }
 }
 
@@ -7667,12 +7728,18 @@ void Character::recalculate_enchantment_cache()
 
 void Character::rebuild_mutation_cache()
 {
-    cached_mutations.clear();
+    std::vector<const mutation_branch *> mutations;
+    mutations.reserve( cached_mutations.size() );
     for( const std::pair<const trait_id, trait_data> &mut : my_mutations ) {
-        cached_mutations.push_back( &mut.first.obj() );
+        mutations.push_back( &mut.first.obj() );
     }
     for( const trait_id &mut : enchantment_cache->get_mutations() ) {
-        cached_mutations.push_back( &mut.obj() );
+        mutations.push_back( &mut.obj() );
+    }
+    // This runs every turn with the enchantment cache, keep the values unless something changed
+    if( mutations != cached_mutations ) {
+        cached_mutations = std::move( mutations );
+        cached_mutation_values.clear();
     }
 }
 
@@ -8961,6 +9028,41 @@ int Character::warmth( const bodypart_id &bp ) const
     return ret;
 }
 
+std::array<int, num_bp> Character::warmth_all() const
+{
+    std::array<int, num_bp> ret;
+    ret.fill( 0 );
+    const std::vector<bodypart_id> all_parts = get_all_body_parts();
+    for( const item &i : worn ) {
+        // Same as warmth(), but the item's warmth and wet resistance are looked up once
+        bool looked_up = false;
+        int warmth = 0;
+        float max_wet_resistance = 0.0f;
+        for( const bodypart_id &bp : all_parts ) {
+            if( !i.covers( bp->token ) ) {
+                continue;
+            }
+            if( !looked_up ) {
+                looked_up = true;
+                warmth = i.get_warmth();
+                const auto &materials = i.made_of();
+                max_wet_resistance = std::accumulate( materials.begin(), materials.end(), 0.0f,
+                []( float best, const material_id & mat ) {
+                    return std::max( best, mat->warmth_when_wet() );
+                } );
+            }
+            // Warmth reduced linearly with wetness
+            float wet_mult = 1.0f - max_wet_resistance * body_wetness[bp->token] /
+                             drench_capacity[bp->token];
+            ret[bp->token] += warmth * wet_mult;
+        }
+    }
+    for( const bodypart_id &bp : all_parts ) {
+        ret[bp->token] += get_effect_int( effect_heating_bionic, bp->token );
+    }
+    return ret;
+}
+
 static int bestwarmth( const std::list< item > &its, const std::string &flag )
 {
     int best = 0;
@@ -9908,8 +10010,8 @@ int Character::get_lowest_hp() const
 {
     // Set lowest_hp to an arbitrarily large number.
     int lowest_hp = 999;
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-        const int cur_hp = elem.second.get_hp_cur();
+    for( const bodypart &elem : get_body() ) {
+        const int cur_hp = elem.get_hp_cur();
         if( cur_hp < lowest_hp ) {
             lowest_hp = cur_hp;
         }
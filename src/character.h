@@ -549,6 +549,8 @@ class Character : public Creature, public visitable<Character>
 
         /** Returns wind resistance provided by armor, etc **/
         int get_wind_resistance( const bodypart_id &bp ) const;
+        /** Same as @ref get_wind_resistance for every body part, indexed by body part token */
+        std::array<int, num_bp> get_wind_resistance_all() const;
 
         /** Returns true if the player isn't able to see */
         bool is_blind() const;
@@ -1859,6 +1861,8 @@ class Character : public Creature, public visitable<Character>
         void clear_destination_activity();
         /** Returns warmth provided by armor, etc. */
         int warmth( const bodypart_id &bp ) const;
+        /** Same as @ref warmth for every body part, indexed by body part token */
+        std::array<int, num_bp> warmth_all() const;
         /** Returns warmth provided by an armor's bonus, like hoods, pockets, etc. */
         int bonus_item_warmth( const bodypart_id &bp ) const;
         /** Can the player lie down and cover self with blankets etc. **/
@@ -1915,6 +1919,9 @@ class Character : public Creature, public visitable<Character>
         void vitamins_mod( const std::map<vitamin_id, int> &, bool capped = true );
         /** Get vitamin usage rate (minutes per unit) accounting for bionics, mutations and effects */
         time_duration vitamin_rate( const vitamin_id &vit ) const;
+        /** Same as above, with the result of @ref get_mutations already at hand */
+        time_duration vitamin_rate( const vitamin_id &vit,
+                                    const std::vector<trait_id> &mutations ) const;
 
         /** Handles the nutrition value for a comestible **/
         int nutrition_for( const item &comest ) const;
@@ -2160,6 +2167,8 @@ class Character : public Creature, public visitable<Character>
          * Pointers to mutation branches in @ref my_mutations.
          */
         std::vector<const mutation_branch *> cached_mutations;
+        /** Results of @ref mutation_value for @ref cached_mutations, filled on demand. */
+        mutable std::map<std::string, float> cached_mutation_values;
 
         void store( JsonOut &json ) const;
         void load( const JsonObject &data );
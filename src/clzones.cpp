@@ -631,12 +631,14 @@ void zone_manager::cache_vzones()
     }
 }
 
-std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type,
+static const std::unordered_set<tripoint> no_zone_points;
+
+const std::unordered_set<tripoint> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_zone_points;
     }
 
     return type_iter->second;
@@ -666,13 +668,13 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
     return res;
 }
 
-std::unordered_set<tripoint> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_zone_points;
     }
 
     return type_iter->second;
@@ -686,15 +688,29 @@ bool zone_manager::has( const zone_type_id &type, const tripoint &where,
     return point_set.find( where ) != point_set.end() || vzone_set.find( where ) != vzone_set.end();
 }
 
+// Zones are boxes, so the queries below measure the distance to each box instead of
+// going through every point in the area cache, which holds each tile of every zone.
+
+/** The point of @p zone closest to @p where. */
+static tripoint closest_point( const zone_data &zone, const tripoint &where )
+{
+    const tripoint start = zone.get_start_point();
+    const tripoint end = zone.get_end_point();
+    return tripoint( clamp( where.x, start.x, end.x ), clamp( where.y, start.y, end.y ),
+                     clamp( where.z, start.z, end.z ) );
+}
+
 bool zone_manager::has_near( const zone_type_id &type, const tripoint &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( auto &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    for( const zone_data &zone : zones ) {
+        if( !zone.get_enabled() || zone.get_type_hash() != type_hash ) {
+            continue;
+        }
+        const tripoint point = closest_point( zone, where );
+        if( point.z == where.z && square_dist( point, where ) <= range ) {
+            return true;
         }
     }
 
@@ -759,19 +775,33 @@ bool zone_manager::custom_loot_has( const tripoint &where, const item *it ) cons
 std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
         const tripoint &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
     auto near_point_set = std::unordered_set<tripoint>();
 
-    for( auto &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_LOOT_CUSTOM, point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
+    for( const zone_data &zone : zones ) {
+        if( !zone.get_enabled() || zone.get_type_hash() != type_hash ) {
+            continue;
+        }
+        const tripoint start = zone.get_start_point();
+        const tripoint end = zone.get_end_point();
+        if( where.z < start.z || where.z > end.z ) {
+            continue;
+        }
+        // Only the part of the zone within range.
+        const tripoint minp( std::max( start.x, where.x - range ),
+                             std::max( start.y, where.y - range ), where.z );
+        const tripoint maxp( std::min( end.x, where.x + range ),
+                             std::min( end.y, where.y + range ), where.z );
+        if( minp.x > maxp.x || minp.y > maxp.y ) {
+            continue;
+        }
+        for( const tripoint &point : tripoint_range( minp, maxp ) ) {
+            if( it && has( zone_LOOT_CUSTOM, point ) ) {
+                if( custom_loot_has( point, it ) ) {
                     near_point_set.insert( point );
                 }
+            } else {
+                near_point_set.insert( point );
             }
         }
     }
@@ -803,8 +833,12 @@ cata::optional<tripoint> zone_manager::get_nearest( const zone_type_id &type, co
 
     tripoint nearest_pos = tripoint( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint> &point_set = get_point_set( type, fac );
-    for( const tripoint &p : point_set ) {
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    for( const zone_data &zone : zones ) {
+        if( !zone.get_enabled() || zone.get_type_hash() != type_hash ) {
+            continue;
+        }
+        const tripoint p = closest_point( zone, where );
         int cur_dist = square_dist( p, where );
         if( cur_dist < nearest_dist ) {
             nearest_dist = cur_dist;
@@ -197,20 +197,19 @@ static void load_available_constructions( std::vector<std::string> &available,
         debugmsg( "load_available_constructions called before finalization" );
         return;
     }
+    const inventory &total_inv = g->u.crafting_inventory();
     for( auto &it : constructions ) {
-        if( it.on_display && ( !hide_unconstructable ||
-                               ( can_construct( it ) && player_can_build( g->u, g->u.crafting_inventory(), it ) ) ) ) {
-            bool already_have_it = false;
-            for( auto &avail_it : available ) {
-                if( avail_it == it.description ) {
-                    already_have_it = true;
-                    break;
-                }
-            }
-            if( !already_have_it ) {
-                available.push_back( it.description );
-                cat_available[it.category].push_back( it.description );
-            }
+        if( !it.on_display ) {
+            continue;
+        }
+        // Several constructions share a description, skip the checks once one of them passed.
+        if( std::find( available.begin(), available.end(), it.description ) != available.end() ) {
+            continue;
+        }
+        if( !hide_unconstructable ||
+            ( can_construct( it ) && player_can_build( g->u, total_inv, it ) ) ) {
+            available.push_back( it.description );
+            cat_available[it.category].push_back( it.description );
         }
     }
 }
@@ -846,26 +845,34 @@ bool can_construct( const std::string &desc )
 
 bool can_construct( const construction &con, const tripoint &p )
 {
-    // see if the special pre-function checks out
-    bool place_okay = con.pre_special( p );
+    // All checks are pure, so the cheapest go first and the first failure ends the test.
     // see if the terrain type checks out
-    place_okay &= has_pre_terrain( con, p );
-    // see if the flags check out
-    place_okay &= std::all_of( con.pre_flags.begin(), con.pre_flags.end(),
-    [&p]( const std::string & flag ) {
-        return g->m.has_flag( flag, p );
-    } );
+    if( !has_pre_terrain( con, p ) ) {
+        return false;
+    }
     // make sure the construction would actually do something
     if( !con.post_terrain.empty() ) {
         if( con.post_is_furniture ) {
             furn_id f = furn_id( con.post_terrain );
-            place_okay &= g->m.furn( p ) != f;
+            if( g->m.furn( p ) == f ) {
+                return false;
+            }
         } else {
             ter_id t = ter_id( con.post_terrain );
-            place_okay &= g->m.ter( p ) != t;
+            if( g->m.ter( p ) == t ) {
+                return false;
+            }
         }
     }
-    return place_okay;
+    // see if the flags check out
+    const auto has_flag = [&p]( const std::string & flag ) {
+        return g->m.has_flag( flag, p );
+    };
+    if( !std::all_of( con.pre_flags.begin(), con.pre_flags.end(), has_flag ) ) {
+        return false;
+    }
+    // see if the special pre-function checks out
+    return con.pre_special( p );
 }
 
 bool can_construct( const construction &con )
@@ -882,11 +889,17 @@ void place_construction( const std::string &desc )
 {
     const inventory &total_inv = g->u.crafting_inventory();
 
-    std::vector<construction *> cons = constructions_by_desc( desc );
+    const std::vector<construction *> cons = constructions_by_desc( desc );
+    // The requirements don't depend on the location, check them once instead of per tile.
+    std::vector<construction *> buildable;
+    std::copy_if( cons.begin(), cons.end(), std::back_inserter( buildable ),
+    [&total_inv]( const construction * con ) {
+        return player_can_build( g->u, total_inv, *con );
+    } );
     std::map<tripoint, const construction *> valid;
     for( const tripoint &p : g->m.points_in_radius( g->u.pos(), 1 ) ) {
-        for( const auto *con : cons ) {
-            if( p != g->u.pos() && can_construct( *con, p ) && player_can_build( g->u, total_inv, *con ) ) {
+        for( const auto *con : buildable ) {
+            if( p != g->u.pos() && can_construct( *con, p ) ) {
                 valid[ p ] = con;
             }
         }
@@ -523,10 +523,16 @@ std::pair<int, int> Character::fun_for( const item &comest ) const
 }
 
 time_duration Character::vitamin_rate( const vitamin_id &vit ) const
+{
+    return vitamin_rate( vit, get_mutations() );
+}
+
+time_duration Character::vitamin_rate( const vitamin_id &vit,
+                                       const std::vector<trait_id> &mutations ) const
 {
     time_duration res = vit.obj().rate();
 
-    for( const auto &m : get_mutations() ) {
+    for( const auto &m : mutations ) {
         const auto &mut = m.obj();
         auto iter = mut.vitamin_rates.find( vit );
         if( iter != mut.vitamin_rates.end() ) {
@@ -8,6 +8,8 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -19,7 +21,9 @@
 #include "crafting.h"
 #include "cursesdef.h"
 #include "game.h"
+#include "hash_utils.h"
 #include "input.h"
+#include "inventory.h"
 #include "item.h"
 #include "item_contents.h"
 #include "itype.h"
@@ -39,10 +43,14 @@
 #include "ui_manager.h"
 #include "uistate.h"
 
+static const itype_id itype_adv_UPS_off( "adv_UPS_off" );
+static const itype_id itype_UPS_off( "UPS_off" );
+
+static const trait_id trait_DEBUG_HS( "DEBUG_HS" );
+
 static const std::string flag_BLIND_EASY( "BLIND_EASY" );
 static const std::string flag_BLIND_HARD( "BLIND_HARD" );
 
-class inventory;
 class npc;
 
 enum TAB_MODE {
@@ -121,10 +129,191 @@ static void translate_all()
     }
 }
 
+struct availability {
+    availability( const recipe *r, int batch_size, bool known ) {
+        this->known = known;
+        const inventory &inv = get_avatar().crafting_inventory();
+        auto all_items_filter = r->get_component_filter( recipe_filter_flags::none );
+        auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
+        const deduped_requirement_data &req = r->deduped_requirements();
+        could_craft_if_knew = req.can_make_with_inventory(
+                                  inv, all_items_filter, batch_size, craft_flags::start_only );
+        can_craft = known && could_craft_if_knew;
+        can_craft_non_rotten = req.can_make_with_inventory(
+                                   inv, no_rotten_filter, batch_size, craft_flags::start_only );
+        const requirement_data &simple_req = r->simple_requirements();
+        apparently_craftable = simple_req.can_make_with_inventory(
+                                   inv, all_items_filter, batch_size, craft_flags::start_only );
+    }
+    bool can_craft;
+    bool can_craft_non_rotten;
+    bool could_craft_if_knew;
+    bool apparently_craftable;
+    bool known;
+
+    nc_color selected_color() const {
+        return can_craft
+               ? ( can_craft_non_rotten ? h_white : h_brown )
+               : ( could_craft_if_knew ? h_yellow : h_dark_gray );
+    }
+
+    nc_color color() const {
+        return can_craft
+               ? ( can_craft_non_rotten ? c_white : c_brown )
+               : ( could_craft_if_knew ? c_yellow : c_dark_gray );
+    }
+};
+
+/**
+ * Availability of recipes in the crafting menu, kept between openings of the menu.
+ * Each evaluated recipe is listed under the item types and qualities its requirements mention,
+ * so when the crafting inventory changes only the recipes listed under changed types are
+ * evaluated again.
+ */
+class availability_index
+{
+    public:
+        /** Forgets the recipes that may be affected by the changes in @p inv since the last call. */
+        void update( const inventory &inv );
+        /** Returns the cached availability of @p r, evaluating it if needed. */
+        const availability &get( const recipe *r, bool known );
+        void clear();
+
+    private:
+        void add_dependencies( const recipe *r, const requirement_data &req );
+        void forget_type( const itype_id &id );
+
+        std::unordered_map<const recipe *, availability> cache;
+        std::unordered_set<const recipe *> indexed;
+        std::unordered_map<itype_id, std::vector<const recipe *>> by_type;
+        std::unordered_map<quality_id, std::vector<const recipe *>> by_quality;
+        /** Order independent hash of the relevant state of all items of each type. */
+        std::unordered_map<itype_id, size_t> fingerprints;
+        bool debug_hammerspace = false;
+};
+
+static availability_index recipe_availability;
+
+void availability_index::update( const inventory &inv )
+{
+    const bool hammerspace = get_avatar().has_trait( trait_DEBUG_HS );
+    if( hammerspace != debug_hammerspace ) {
+        debug_hammerspace = hammerspace;
+        cache.clear();
+    }
+
+    std::unordered_map<itype_id, size_t> current;
+    inv.visit_items( [&current]( const item * it ) {
+        size_t hash = 0;
+        cata::hash_combine( hash, it->charges );
+        cata::hash_combine( hash, it->damage() );
+        cata::hash_combine( hash, it->rotten() );
+        cata::hash_combine( hash, it->ammo_remaining() );
+        cata::hash_combine( hash, is_crafting_component( *it ) );
+        // What a container holds changes its qualities, BOIL for example needs it empty.
+        if( !it->contents.empty() ) {
+            for( const item *content : it->contents.all_items_top() ) {
+                cata::hash_combine( hash, content->typeId() );
+                cata::hash_combine( hash, content->charges );
+            }
+        }
+        current[it->typeId()] += hash;
+        return VisitResponse::NEXT;
+    } );
+
+    for( const auto &e : current ) {
+        const auto iter = fingerprints.find( e.first );
+        if( iter == fingerprints.end() || iter->second != e.second ) {
+            forget_type( e.first );
+        }
+    }
+    for( const auto &e : fingerprints ) {
+        if( current.count( e.first ) == 0 ) {
+            forget_type( e.first );
+        }
+    }
+    fingerprints = std::move( current );
+}
+
+void availability_index::forget_type( const itype_id &id )
+{
+    // UPS charges count towards every tool using them, so there's no single type to look up.
+    if( id == itype_UPS_off || id == itype_adv_UPS_off ) {
+        cache.clear();
+        return;
+    }
+    const auto type_iter = by_type.find( id );
+    if( type_iter != by_type.end() ) {
+        for( const recipe *r : type_iter->second ) {
+            cache.erase( r );
+        }
+    }
+    for( const auto &qual : item::find_type( id )->qualities ) {
+        const auto qual_iter = by_quality.find( qual.first );
+        if( qual_iter != by_quality.end() ) {
+            for( const recipe *r : qual_iter->second ) {
+                cache.erase( r );
+            }
+        }
+    }
+}
+
+void availability_index::add_dependencies( const recipe *r, const requirement_data &req )
+{
+    for( const std::vector<tool_comp> &alternatives : req.get_tools() ) {
+        for( const tool_comp &comp : alternatives ) {
+            by_type[comp.type].push_back( r );
+        }
+    }
+    for( const std::vector<item_comp> &alternatives : req.get_components() ) {
+        for( const item_comp &comp : alternatives ) {
+            by_type[comp.type].push_back( r );
+        }
+    }
+    for( const std::vector<quality_requirement> &alternatives : req.get_qualities() ) {
+        for( const quality_requirement &qual : alternatives ) {
+            by_quality[qual.type].push_back( r );
+        }
+    }
+}
+
+const availability &availability_index::get( const recipe *r, bool known )
+{
+    auto iter = cache.find( r );
+    if( iter == cache.end() ) {
+        iter = cache.emplace( r, availability( r, 1, known ) ).first;
+        if( indexed.insert( r ).second ) {
+            add_dependencies( r, r->simple_requirements() );
+            for( const requirement_data &req : r->deduped_requirements().alternatives() ) {
+                add_dependencies( r, req );
+            }
+        }
+    } else if( iter->second.known != known ) {
+        iter->second.known = known;
+        iter->second.can_craft = known && iter->second.could_craft_if_knew;
+    }
+    return iter->second;
+}
+
+void availability_index::clear()
+{
+    cache.clear();
+    indexed.clear();
+    by_type.clear();
+    by_quality.clear();
+    fingerprints.clear();
+}
+
 void reset_recipe_categories()
 {
     craft_cat_list.clear();
     craft_subcat_list.clear();
+    recipe_availability.clear();
+}
+
+void reset_recipe_availability()
+{
+    recipe_availability.clear();
 }
 
 static int print_items( const recipe &r, const catacurses::window &w, point pos,
@@ -239,41 +428,6 @@ const recipe *select_crafting_recipe( int &batch_size )
     list_circularizer<std::string> subtab( craft_subcat_list[tab.cur()] );
     std::vector<const recipe *> current;
 
-    struct availability {
-        availability( const recipe *r, int batch_size, bool known ) {
-            this->known = known;
-            const inventory &inv = get_avatar().crafting_inventory();
-            auto all_items_filter = r->get_component_filter( recipe_filter_flags::none );
-            auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
-            const deduped_requirement_data &req = r->deduped_requirements();
-            could_craft_if_knew = req.can_make_with_inventory(
-                                      inv, all_items_filter, batch_size, craft_flags::start_only );
-            can_craft = known && could_craft_if_knew;
-            can_craft_non_rotten = req.can_make_with_inventory(
-                                       inv, no_rotten_filter, batch_size, craft_flags::start_only );
-            const requirement_data &simple_req = r->simple_requirements();
-            apparently_craftable = simple_req.can_make_with_inventory(
-                                       inv, all_items_filter, batch_size, craft_flags::start_only );
-        }
-        bool can_craft;
-        bool can_craft_non_rotten;
-        bool could_craft_if_knew;
-        bool apparently_craftable;
-        bool known;
-
-        nc_color selected_color() const {
-            return can_craft
-                   ? ( can_craft_non_rotten ? h_white : h_brown )
-                   : ( could_craft_if_knew ? h_yellow : h_dark_gray );
-        }
-
-        nc_color color() const {
-            return can_craft
-                   ? ( can_craft_non_rotten ? c_white : c_brown )
-                   : ( could_craft_if_knew ? c_yellow : c_dark_gray );
-        }
-    };
-
     std::vector<availability> available;
     //preserves component color printout between mode rotations
     nc_color rotated_color = c_white;
@@ -318,6 +472,7 @@ const recipe *select_crafting_recipe( int &batch_size )
 
     const auto &available_recipes = u.get_available_recipes( crafting_inv, &helpers );
     std::unordered_map<const recipe *, availability> availability_cache( available_recipes.size() );
+    recipe_availability.update( crafting_inv );
 
     std::vector<const recipe *> all_recipes_flat;
     for( const auto &pr : recipe_dict ) {
@@ -733,7 +888,7 @@ const recipe *select_crafting_recipe( int &batch_size )
                 // cache recipe availability on first display
                 for( const recipe *e : current ) {
                     if( availability_cache.count( e ) == 0 ) {
-                        availability_cache.emplace( e, availability( e, 1,
+                        availability_cache.emplace( e, recipe_availability.get( e,
                                                     !show_unavailable || available_recipes.contains( *e ) ) );
                     }
                 }
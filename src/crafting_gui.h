@@ -9,5 +9,7 @@ const recipe *select_crafting_recipe( int &batch_size );
 
 void load_recipe_category( const JsonObject &jsobj );
 void reset_recipe_categories();
+/** Forgets what was cached about the recipes the current character can craft. */
+void reset_recipe_availability();
 
 #endif // CATA_SRC_CRAFTING_GUI_H
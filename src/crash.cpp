@@ -57,6 +57,8 @@ extern "C" {
         // reasons, including the memory allocations and the SDL message box.
         // But it should usually work in practice, unless for example the
         // program segfaults inside malloc.
+        // Get the last buffered log lines to disk before anything else goes wrong.
+        flushDebugLog();
 #if defined(_WIN32)
         dump_to( ".core" );
 #endif
@@ -255,17 +255,21 @@ bool Creature::sees( const tripoint &t, bool is_avatar, int range_mod ) const
         return false;
     }
 
-    const int range_cur = sight_range( g->m.ambient_light_at( t ) );
     const int range_day = sight_range( default_daylight_level() );
     const int range_night = sight_range( 0 );
     const int range_max = std::max( range_day, range_night );
-    const int range_min = std::min( range_cur, range_max );
     const int wanted_range = rl_dist( pos(), t );
-    if( wanted_range <= range_min ||
-        ( wanted_range <= range_max &&
-          g->m.ambient_light_at( t ) > g->natural_light_level( t.z ) ) ) {
+    if( wanted_range > range_max ) {
+        // Beyond what we could see in any light, skip the lighting lookups.
+        return false;
+    }
+    const float light_at_t = g->m.ambient_light_at( t );
+    const bool lit_above_natural = light_at_t > g->natural_light_level( t.z );
+    const int range_cur = sight_range( light_at_t );
+    const int range_min = std::min( range_cur, range_max );
+    if( wanted_range <= range_min || lit_above_natural ) {
         int range = 0;
-        if( g->m.ambient_light_at( t ) > g->natural_light_level( t.z ) ) {
+        if( lit_above_natural ) {
             range = MAX_VIEW_DISTANCE;
         } else {
             range = range_min;
@@ -351,6 +355,25 @@ Creature *Creature::auto_find_hostile_target( int range, int &boo_hoo, int area
         return false;
     } );
     for( auto &m : targets ) {
+        int dist = rl_dist( pos(), m->pos() ) + 1; // rl_dist can be 0
+        if( dist > range + 1 || dist < area ) {
+            // Too near or too far
+            continue;
+        }
+        // Prioritize big, armed and hostile stuff
+        float mon_rating = m->power_rating();
+        float target_rating = mon_rating / dist;
+        if( mon_rating + hostile_adj <= 0 ) {
+            // We wouldn't attack it even if it was hostile
+            continue;
+        }
+
+        if( in_veh != nullptr && veh_pointer_or_null( g->m.veh_at( m->pos() ) ) == in_veh ) {
+            // No shooting stuff on vehicle we're a part of
+            continue;
+        }
+        // Line of sight is by far the most expensive check, so it only runs for creatures
+        // that the cheap ones above haven't already ruled out
         if( !sees( *m ) ) {
             // can't see nor sense it
             if( is_fake() && in_veh ) {
@@ -384,23 +407,6 @@ Creature *Creature::auto_find_hostile_target( int range, int &boo_hoo, int area
                 continue;
             }
         }
-        int dist = rl_dist( pos(), m->pos() ) + 1; // rl_dist can be 0
-        if( dist > range + 1 || dist < area ) {
-            // Too near or too far
-            continue;
-        }
-        // Prioritize big, armed and hostile stuff
-        float mon_rating = m->power_rating();
-        float target_rating = mon_rating / dist;
-        if( mon_rating + hostile_adj <= 0 ) {
-            // We wouldn't attack it even if it was hostile
-            continue;
-        }
-
-        if( in_veh != nullptr && veh_pointer_or_null( g->m.veh_at( m->pos() ) ) == in_veh ) {
-            // No shooting stuff on vehicle we're a part of
-            continue;
-        }
         if( area_iff && rl_dist( u.pos(), m->pos() ) <= area ) {
             // Player in AoE
             boo_hoo++;
@@ -1390,37 +1396,53 @@ void Creature::set_anatomy( anatomy_id anat )
     creature_anatomy = anat;
 }
 
-const std::map<bodypart_str_id, bodypart> &Creature::get_body() const
+const std::vector<bodypart> &Creature::get_body() const
 {
     return body;
 }
 
 void Creature::set_body()
 {
-    body.clear();
+    std::map<bodypart_str_id, bodypart> parts;
     for( const bodypart_id &bp : get_anatomy()->get_bodyparts() ) {
-        body.emplace( bp.id(), bodypart( bp.id() ) );
+        parts.emplace( bp.id(), bodypart( bp.id() ) );
+    }
+    set_body( parts );
+}
+
+void Creature::set_body( const std::map<bodypart_str_id, bodypart> &parts )
+{
+    body.clear();
+    body_index.clear();
+    body.reserve( parts.size() );
+    for( const std::pair<const bodypart_str_id, bodypart> &elem : parts ) {
+        const size_t id = bodypart_id( elem.first ).to_i();
+        if( id >= body_index.size() ) {
+            body_index.resize( id + 1, -1 );
+        }
+        body_index[id] = body.size();
+        body.push_back( elem.second );
     }
 }
 
 bodypart *Creature::get_part( const bodypart_id &id )
 {
-    auto found = body.find( id.id() );
-    if( found == body.end() ) {
+    const size_t index = id.to_i();
+    if( index >= body_index.size() || body_index[index] < 0 ) {
         debugmsg( "Could not find bodypart %s in %s's body", id.id().c_str(), get_name() );
         return nullptr;
     }
-    return &found->second;
+    return &body[body_index[index]];
 }
 
 bodypart Creature::get_part( const bodypart_id &id ) const
 {
-    auto found = body.find( id.id() );
-    if( found == body.end() ) {
+    const size_t index = id.to_i();
+    if( index >= body_index.size() || body_index[index] < 0 ) {
         debugmsg( "Could not find bodypart %s in %s's body", id.id().c_str(), get_name() );
         return bodypart();
     }
-    return found->second;
+    return body[body_index[index]];
 }
 
 int Creature::get_part_hp_cur( const bodypart_id &id ) const
@@ -1470,15 +1492,15 @@ void Creature::mod_part_healed_total( const bodypart_id &id, int mod )
 
 void Creature::set_all_parts_hp_cur( const int set )
 {
-    for( std::pair<const bodypart_str_id, bodypart> &elem : body ) {
-        elem.second.set_hp_cur( set );
+    for( bodypart &elem : body ) {
+        elem.set_hp_cur( set );
     }
 }
 
 void Creature::set_all_parts_hp_to_max()
 {
-    for( std::pair<const bodypart_str_id, bodypart> &elem : body ) {
-        elem.second.set_hp_to_max();
+    for( bodypart &elem : body ) {
+        elem.set_hp_to_max();
     }
 }
 
@@ -1493,11 +1515,12 @@ bodypart_id Creature::get_random_body_part( bool main ) const
 std::vector<bodypart_id> Creature::get_all_body_parts( bool only_main ) const
 {
     std::vector<bodypart_id> all_bps;
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : body ) {
-        if( only_main && elem.first->main_part != elem.first ) {
+    for( const bodypart &elem : body ) {
+        const bodypart_id bp = elem.get_id();
+        if( only_main && bp->main_part != bp.id() ) {
             continue;
         }
-        all_bps.push_back( elem.first );
+        all_bps.push_back( bp );
     }
 
     return  all_bps;
@@ -1509,8 +1532,8 @@ int Creature::get_hp( const bodypart_id &bp ) const
         return get_part_hp_cur( bp );
     }
     int hp_total = 0;
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-        hp_total += elem.second.get_hp_cur();
+    for( const bodypart &elem : get_body() ) {
+        hp_total += elem.get_hp_cur();
     }
     return hp_total;
 }
@@ -1526,8 +1549,8 @@ int Creature::get_hp_max( const bodypart_id &bp ) const
         return get_part_hp_max( bp );
     }
     int hp_total = 0;
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-        hp_total += elem.second.get_hp_max();
+    for( const bodypart &elem : get_body() ) {
+        hp_total += elem.get_hp_max();
     }
     return hp_total;
 }
@@ -459,8 +459,10 @@ class Creature
     private:
         /**anatomy is the plan of the creature's body*/
         anatomy_id creature_anatomy = anatomy_id( "default_anatomy" );
-        /**this is the actual body of the creature*/
-        std::map<bodypart_str_id, bodypart> body;
+        /**this is the actual body of the creature, ordered by body part id*/
+        std::vector<bodypart> body;
+        /** Position in @ref body of each part, indexed by bodypart_id::to_i(), -1 when absent. */
+        std::vector<int> body_index;
     public:
         anatomy_id get_anatomy() const;
         void set_anatomy( anatomy_id anat );
@@ -472,8 +474,10 @@ class Creature
          */
         std::vector<bodypart_id> get_all_body_parts( bool only_main = false ) const;
 
-        const std::map<bodypart_str_id, bodypart> &get_body() const;
+        const std::vector<bodypart> &get_body() const;
         void set_body();
+        /** Replaces the body with @p parts, as stored in save files. */
+        void set_body( const std::map<bodypart_str_id, bodypart> &parts );
         bodypart *get_part( const bodypart_id &id );
         bodypart get_part( const bodypart_id &id ) const;
 
@@ -2,11 +2,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <utility>
 
+#include "coordinate_conversions.h"
 #include "debug.h"
+#include "line.h"
 #include "mongroup.h"
 #include "monster.h"
 #include "mtype.h"
@@ -32,6 +35,82 @@ shared_ptr_fast<monster> Creature_tracker::find( const tripoint &pos ) const
     return nullptr;
 }
 
+std::vector<shared_ptr_fast<monster>> Creature_tracker::find_in_radius( const tripoint &center,
+                                   const int radius ) const
+{
+    std::vector<shared_ptr_fast<monster>> result;
+    if( radius < 0 || locations_by_submap.empty() ) {
+        return result;
+    }
+    const tripoint min_sm = ms_to_sm_copy( center - tripoint( radius, radius, radius ) );
+    const tripoint max_sm = ms_to_sm_copy( center + tripoint( radius, radius, radius ) );
+    const auto collect = [&]( const std::vector<tripoint> &locations ) {
+        for( const tripoint &p : locations ) {
+            if( square_dist( center, p ) > radius ) {
+                continue;
+            }
+            const shared_ptr_fast<monster> &mon_ptr = monsters_by_location.find( p )->second;
+            if( !mon_ptr->is_dead() ) {
+                result.push_back( mon_ptr );
+            }
+        }
+    };
+
+    const int64_t cell_count = static_cast<int64_t>( max_sm.x - min_sm.x + 1 ) *
+                               ( max_sm.y - min_sm.y + 1 ) * ( max_sm.z - min_sm.z + 1 );
+    if( cell_count > static_cast<int64_t>( locations_by_submap.size() ) ) {
+        // Fewer occupied submaps than covered ones, walking the index is cheaper.
+        for( const auto &cell : locations_by_submap ) {
+            const tripoint &sm = cell.first;
+            if( sm.x >= min_sm.x && sm.x <= max_sm.x && sm.y >= min_sm.y && sm.y <= max_sm.y &&
+                sm.z >= min_sm.z && sm.z <= max_sm.z ) {
+                collect( cell.second );
+            }
+        }
+        return result;
+    }
+
+    tripoint sm;
+    for( sm.z = min_sm.z; sm.z <= max_sm.z; sm.z++ ) {
+        for( sm.x = min_sm.x; sm.x <= max_sm.x; sm.x++ ) {
+            for( sm.y = min_sm.y; sm.y <= max_sm.y; sm.y++ ) {
+                const auto iter = locations_by_submap.find( sm );
+                if( iter != locations_by_submap.end() ) {
+                    collect( iter->second );
+                }
+            }
+        }
+    }
+    return result;
+}
+
+void Creature_tracker::set_location( const tripoint &pos, const shared_ptr_fast<monster> &critter )
+{
+    shared_ptr_fast<monster> &entry = monsters_by_location[pos];
+    if( !entry ) {
+        locations_by_submap[ms_to_sm_copy( pos )].push_back( pos );
+    }
+    entry = critter;
+}
+
+void Creature_tracker::erase_location( std::unordered_map<tripoint, shared_ptr_fast<monster>>::iterator
+                                       iter )
+{
+    const auto cell = locations_by_submap.find( ms_to_sm_copy( iter->first ) );
+    if( cell != locations_by_submap.end() ) {
+        std::vector<tripoint> &locations = cell->second;
+        const auto loc_iter = std::find( locations.begin(), locations.end(), iter->first );
+        if( loc_iter != locations.end() ) {
+            *loc_iter = locations.back();
+            locations.pop_back();
+        }
+        if( locations.empty() ) {
+            locations_by_submap.erase( cell );
+        }
+    }
+    monsters_by_location.erase( iter );
+}
+
 int Creature_tracker::temporary_id( const monster &critter ) const
 {
     const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
@@ -86,7 +165,7 @@ bool Creature_tracker::add( shared_ptr_fast<monster> critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.pos()] = critter_ptr;
+    set_location( critter.pos(), critter_ptr );
     add_to_faction_map( critter_ptr );
     return true;
 }
@@ -136,8 +215,11 @@ bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_p
         return ptr.get() == &critter;
     } );
     if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( critter.pos() );
-        monsters_by_location[new_pos] = *iter;
+        const auto old_iter = monsters_by_location.find( critter.pos() );
+        if( old_iter != monsters_by_location.end() ) {
+            erase_location( old_iter );
+        }
+        set_location( new_pos, *iter );
         return true;
     } else {
         const tripoint &old_pos = critter.pos();
@@ -156,7 +238,7 @@ void Creature_tracker::remove_from_location_map( const monster &critter )
 {
     const auto pos_iter = monsters_by_location.find( critter.pos() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+        erase_location( pos_iter );
         return;
     }
 
@@ -167,7 +249,7 @@ void Creature_tracker::remove_from_location_map( const monster &critter )
         return v.second.get() == &critter;
     } );
     if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+        erase_location( iter );
     }
 }
 
@@ -200,6 +282,7 @@ void Creature_tracker::clear()
 {
     monsters_list.clear();
     monsters_by_location.clear();
+    locations_by_submap.clear();
     monster_faction_map_.clear();
     removed_.clear();
 }
@@ -207,9 +290,10 @@ void Creature_tracker::clear()
 void Creature_tracker::rebuild_cache()
 {
     monsters_by_location.clear();
+    locations_by_submap.clear();
     monster_faction_map_.clear();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->pos()] = mon_ptr;
+        set_location( mon_ptr->pos(), mon_ptr );
         add_to_faction_map( mon_ptr );
     }
 }
@@ -228,13 +312,13 @@ void Creature_tracker::swap_positions( monster &first, monster &second )
     shared_ptr_fast<monster> first_ptr;
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
+        erase_location( first_iter );
     }
 
     shared_ptr_fast<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
+        erase_location( second_iter );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
@@ -244,10 +328,10 @@ void Creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.pos()] = first_ptr;
+        set_location( first.pos(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.pos()] = second_ptr;
+        set_location( second.pos(), second_ptr );
     }
 }
 
@@ -256,6 +340,14 @@ bool Creature_tracker::kill_marked_for_death()
     // Important: `Creature::die` must not be called after creature objects (NPCs, monsters) have
     // been removed, the dying creature could still have a pointer (the killer) to another creature.
     bool monster_is_dead = false;
+    // This runs several times per turn, don't copy the list when nothing has died.
+    const bool any_dead = std::any_of( monsters_list.begin(), monsters_list.end(),
+    []( const shared_ptr_fast<monster> & mon_ptr ) {
+        return mon_ptr->is_dead();
+    } );
+    if( !any_dead ) {
+        return monster_is_dead;
+    }
     // Copy the list so we can iterate the copy safely *and* add new monsters from within monster::die
     // This happens for example with blob monsters (they split into two smaller monsters).
     const auto copy = monsters_list;
@@ -278,15 +370,16 @@ bool Creature_tracker::kill_marked_for_death()
 void Creature_tracker::remove_dead()
 {
     // Can't use game::all_monsters() as it would not contain *dead* monsters.
-    for( auto iter = monsters_list.begin(); iter != monsters_list.end(); ) {
-        const monster &critter = **iter;
-        if( critter.is_dead() ) {
-            remove_from_location_map( critter );
-            iter = monsters_list.erase( iter );
-        } else {
-            ++iter;
+    for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
+        if( mon_ptr->is_dead() ) {
+            remove_from_location_map( *mon_ptr );
         }
     }
+    // Compact in a single pass, a big explosion can kill dozens of monsters at once.
+    monsters_list.erase( std::remove_if( monsters_list.begin(), monsters_list.end(),
+    []( const shared_ptr_fast<monster> & mon_ptr ) {
+        return mon_ptr->is_dead();
+    } ), monsters_list.end() );
 
     removed_.clear();
 }
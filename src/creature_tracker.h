@@ -49,6 +49,13 @@ class Creature_tracker
          * Dead monsters are ignored and not returned.
          */
         shared_ptr_fast<monster> find( const tripoint &pos ) const;
+        /**
+         * Returns all living monsters whose square distance to @p center is at most @p radius
+         * (on every axis, z included). The order of the result is unspecified.
+         * This only looks at the submaps covered by the radius, so it is much cheaper than
+         * scanning @ref get_monsters_list when the radius is small compared to the map.
+         */
+        std::vector<shared_ptr_fast<monster>> find_in_radius( const tripoint &center, int radius ) const;
         /**
          * Returns a temporary id of the given monster (which must exist in the tracker).
          * The id is valid until monsters are added or removed from the tracker.
@@ -94,6 +101,17 @@ class Creature_tracker
     private:
         std::vector<shared_ptr_fast<monster>> monsters_list;
         std::unordered_map<tripoint, shared_ptr_fast<monster>> monsters_by_location;
+        /**
+         * Spatial index over @ref monsters_by_location: the keys are submap coordinates
+         * (see @ref ms_to_sm_copy), the values are the occupied locations inside that submap.
+         * Kept in sync by @ref set_location and @ref erase_location, never modify
+         * @ref monsters_by_location directly.
+         */
+        std::unordered_map<tripoint, std::vector<tripoint>> locations_by_submap;
+        /** Stores @p critter at @p pos in @ref monsters_by_location, replacing any previous entry. */
+        void set_location( const tripoint &pos, const shared_ptr_fast<monster> &critter );
+        /** Removes the given entry from @ref monsters_by_location. */
+        void erase_location( std::unordered_map<tripoint, shared_ptr_fast<monster>>::iterator iter );
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
 };
@@ -1,8 +1,10 @@
 #include "debug.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cctype>
+#include <chrono>
 #include <cerrno>
 #include <cmath>
 #include <cstdint>
@@ -135,6 +137,27 @@ capture_debugmsg::~capture_debugmsg()
     capturing = false;
 }
 
+/** Where debugmsg calls of the current thread go if set, see defer_debugmsgs_during. */
+static thread_local std::vector<deferred_debugmsg> *deferred_debugmsgs = nullptr;
+
+void defer_debugmsgs_during( std::vector<deferred_debugmsg> &messages,
+                             const std::function<void()> &func )
+{
+    std::vector<deferred_debugmsg> *const previous = deferred_debugmsgs;
+    deferred_debugmsgs = &messages;
+    on_out_of_scope restore( [previous]() {
+        deferred_debugmsgs = previous;
+    } );
+    func();
+}
+
+void report_deferred_debugmsgs( const std::vector<deferred_debugmsg> &messages )
+{
+    for( const deferred_debugmsg &msg : messages ) {
+        realDebugmsg( msg.filename.c_str(), msg.line.c_str(), msg.funcname.c_str(), msg.text );
+    }
+}
+
 bool debug_has_error_been_observed()
 {
     return error_observed;
@@ -288,6 +311,11 @@ void realDebugmsg( const char *filename, const char *line, const char *funcname,
     assert( line != nullptr );
     assert( funcname != nullptr );
 
+    if( deferred_debugmsgs ) {
+        deferred_debugmsgs->push_back( { filename, line, funcname, text } );
+        return;
+    }
+
     if( capturing ) {
         captured += text;
     } else {
@@ -542,6 +570,13 @@ void deinitDebug()
     debugFile().deinit();
 }
 
+void flushDebugLog()
+{
+    if( debugFile().file ) {
+        debugFile().file->flush();
+    }
+}
+
 // OStream Operators                                                {{{2
 // ---------------------------------------------------------------------
 
@@ -1027,7 +1062,37 @@ void debug_write_backtrace( std::ostream &out )
 
 detail::DebugLogGuard::~DebugLogGuard()
 {
-    *s << std::endl;
+    *s << '\n';
+    if( flush ) {
+        s->flush();
+    }
+}
+
+/** When the log was last flushed, in steady_clock ticks. Logging may happen on any thread. */
+static std::atomic<std::chrono::steady_clock::rep> last_log_flush( 0 );
+
+/**
+ * Flushing after every line makes verbose logging crawl, so only warnings and errors are
+ * flushed right away. Anything else is flushed by the next line logged a second later,
+ * by @ref flushDebugLogIfDue, or on a crash.
+ */
+static bool should_flush_log( const DL lev )
+{
+    const std::chrono::steady_clock::rep now =
+        std::chrono::steady_clock::now().time_since_epoch().count();
+    const std::chrono::steady_clock::duration since_flush( now - last_log_flush.load() );
+    if( lev >= DL::Warn || since_flush >= std::chrono::seconds( 1 ) ) {
+        last_log_flush.store( now );
+        return true;
+    }
+    return false;
+}
+
+void flushDebugLogIfDue()
+{
+    if( should_flush_log( DL::Info ) ) {
+        flushDebugLog();
+    }
 }
 
 detail::DebugLogGuard detail::realDebugLog( DL lev, DC cl, const char *filename,
@@ -1075,12 +1140,12 @@ detail::DebugLogGuard detail::realDebugLog( DL lev, DC cl, const char *filename,
         }
 #endif
 
-        return DebugLogGuard( out );
+        return DebugLogGuard( out, should_flush_log( lev ) );
     }
 
     static NullBuf nullBuf;
     static std::ostream nullStream( &nullBuf );
-    return DebugLogGuard( nullStream );
+    return DebugLogGuard( nullStream, false );
 }
 
 std::string game_info::operating_system()
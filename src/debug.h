@@ -52,6 +52,7 @@
 #include <type_traits>
 #include <utility>
 #include <functional>
+#include <vector>
 
 #include "string_formatter.h"
 template<typename T> struct enum_traits;
@@ -187,6 +188,10 @@ enum class DebugOutput {
 void setupDebug( DebugOutput );
 /** Opposite of setupDebug, shuts the debugging system down. */
 void deinitDebug();
+/** Writes out log lines that are still buffered, see @ref detail::DebugLogGuard. */
+void flushDebugLog();
+/** Flushes the log if that has not happened for a second, called once per turn. */
+void flushDebugLogIfDue();
 
 // Function Declarations                                            {{{1
 // ---------------------------------------------------------------------
@@ -212,6 +217,23 @@ bool debug_has_error_been_observed();
  */
 std::string capture_debugmsg_during( const std::function<void()> &func );
 
+struct deferred_debugmsg {
+    std::string filename;
+    std::string line;
+    std::string funcname;
+    std::string text;
+};
+
+/**
+ * Runs func, but instead of reporting the debug messages it produces on this thread,
+ * appends them to messages (even if func throws) so they can be reported later with
+ * report_deferred_debugmsgs. Allows running code that may report errors on a worker thread.
+ */
+void defer_debugmsgs_during( std::vector<deferred_debugmsg> &messages,
+                             const std::function<void()> &func );
+/** Reports the messages (on the calling thread) as if debugmsg was called now. */
+void report_deferred_debugmsgs( const std::vector<deferred_debugmsg> &messages );
+
 /**
  * Should be called after catacurses::stdscr is initialized.
  * If catacurses::stdscr is available, shows all buffered debugmsg prompts.
@@ -226,14 +248,15 @@ namespace detail
 /**
  * Debug log guard.
  *
- * Appends newline and flushes the log when goes out of scope.
+ * Appends newline when goes out of scope, and flushes the log if asked to.
  * Dereference to get the underlying stream.
  */
 class DebugLogGuard
 {
         std::ostream *s;
+        bool flush;
     public:
-        explicit DebugLogGuard( std::ostream &s ) : s( &s ) {}
+        DebugLogGuard( std::ostream &s, bool flush ) : s( &s ), flush( flush ) {}
         ~DebugLogGuard();
 
         std::ostream &operator*() {
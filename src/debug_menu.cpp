@@ -177,6 +177,8 @@ enum debug_menu_index {
     DEBUG_LEARN_SPELLS,
     DEBUG_LEVEL_SPELLS,
     DEBUG_TEST_MAP_EXTRA_DISTRIBUTION,
+    DEBUG_MAP_EXTRA_PROFILE,
+    DEBUG_MEMORY_USAGE,
     DEBUG_VEHICLE_BATTERY_CHARGE,
     DEBUG_HOUR_TIMER,
     DEBUG_NESTED_MAPGEN
@@ -256,6 +258,8 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( DEBUG_PRINT_NPC_MAGIC, true, 'M', _( "Print NPC magic info to console" ) ) },
             { uilist_entry( DEBUG_TEST_WEATHER, true, 'W', _( "Test weather" ) ) },
             { uilist_entry( DEBUG_TEST_MAP_EXTRA_DISTRIBUTION, true, 'e', _( "Test map extra list" ) ) },
+            { uilist_entry( DEBUG_MAP_EXTRA_PROFILE, true, 'x', _( "Show map extra timings" ) ) },
+            { uilist_entry( DEBUG_MEMORY_USAGE, true, 'k', _( "Show memory usage" ) ) },
         };
         uilist_initializer.insert( uilist_initializer.begin(), debug_only_options.begin(),
                                    debug_only_options.end() );
@@ -1237,6 +1241,23 @@ void benchmark( const int max_difference, bench_kind kind )
              difference / 1000.0, 1000.0 * draw_counter / static_cast<double>( difference ) );
 }
 
+// Lists the memory held by the big containers, and how much that changed since the last time
+// this was shown, to see which of them grow over a long session.
+static void show_memory_usage()
+{
+    static std::map<std::string, int64_t> last_snapshot;
+    uilist usage_menu;
+    usage_menu.text = _( "Approximate memory use (change since last shown):" );
+    for( const std::pair<std::string, int64_t> &usage : g->memory_usage() ) {
+        const auto last = last_snapshot.find( usage.first );
+        const int64_t change = last == last_snapshot.end() ? 0 : usage.second - last->second;
+        usage_menu.addentry( -1, true, -2, string_format( "%s: %d KiB (%+d KiB)", usage.first,
+                             usage.second / 1024, change / 1024 ) );
+        last_snapshot[usage.first] = usage.second;
+    }
+    usage_menu.query();
+}
+
 void debug()
 {
     bool debug_menu_has_hotkey = hotkey_for_action( ACTION_DEBUG, false ) != -1;
@@ -1997,6 +2018,14 @@ void debug()
         case DEBUG_TEST_MAP_EXTRA_DISTRIBUTION:
             MapExtras::debug_spawn_test();
             break;
+
+        case DEBUG_MAP_EXTRA_PROFILE:
+            MapExtras::debug_show_profiles();
+            break;
+
+        case DEBUG_MEMORY_USAGE:
+            show_memory_usage();
+            break;
     }
     m.invalidate_map_cache( g->get_levz() );
 }
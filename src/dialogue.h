@@ -213,6 +213,8 @@ struct talk_response {
 
     talk_data create_option_line( const dialogue &d, char letter );
     std::set<dialogue_consequence> get_consequences( const dialogue &d ) const;
+    /** As above, for a trial chance the caller already calculated. */
+    std::set<dialogue_consequence> get_consequences( const dialogue &d, int chance ) const;
 
     talk_response();
     talk_response( const JsonObject & );
@@ -25,11 +25,20 @@ distribution_grid::distribution_grid( const std::vector<tripoint> &global_submap
             return;
         }
 
+        if( sm->active_furniture.empty() ) {
+            continue;
+        }
+        contents.push_back( { sm_coord, {} } );
         for( auto &active : sm->active_furniture ) {
             const tripoint ms_pos = sm_to_ms_copy( sm_coord );
             const tripoint abs_pos = ms_pos + active.first;
-            contents[sm_coord].emplace_back( active.first, abs_pos );
+            contents.back().tiles.emplace_back( active.first, abs_pos );
             flat_contents.emplace_back( abs_pos );
+            if( dynamic_cast<battery_tile *>( &*active.second ) != nullptr ) {
+                battery_tiles.emplace_back( abs_pos );
+            } else if( dynamic_cast<vehicle_connector_tile *>( &*active.second ) != nullptr ) {
+                connector_tiles.emplace_back( abs_pos );
+            }
         }
     }
 }
@@ -46,13 +55,13 @@ distribution_grid::operator bool() const
 
 void distribution_grid::update( time_point to )
 {
-    for( const std::pair<const tripoint, std::vector<tile_location>> &c : contents ) {
-        submap *sm = mb.lookup_submap( c.first );
+    for( const submap_contents &c : contents ) {
+        submap *sm = mb.lookup_submap( c.sm_coord );
         if( sm == nullptr ) {
             return;
         }
 
-        for( const tile_location &loc : c.second ) {
+        for( const tile_location &loc : c.tiles ) {
             auto &active = sm->active_furniture[loc.on_submap];
             if( !active ) {
                 debugmsg( "No active furniture at %d,%d,%d",
@@ -68,39 +77,45 @@ void distribution_grid::update( time_point to )
 // TODO: Shouldn't be here
 #include "vehicle.h"
 static itype_id itype_battery( "battery" );
-int distribution_grid::mod_resource( int amt, bool recurse )
+
+std::vector<vehicle *> distribution_grid::get_connected_vehicles() const
 {
     std::vector<vehicle *> connected_vehicles;
-    for( const std::pair<const tripoint, std::vector<tile_location>> &c : contents ) {
-        for( const tile_location &loc : c.second ) {
-            battery_tile *battery = active_tiles::furn_at<battery_tile>( loc.absolute );
-            if( battery != nullptr ) {
-                amt = battery->mod_resource( amt );
-                if( amt == 0 ) {
-                    return 0;
-                }
-                continue;
-            }
-
-            if( !recurse ) {
+    for( const tripoint &p : connector_tiles ) {
+        vehicle_connector_tile *connector = active_tiles::furn_at<vehicle_connector_tile>( p );
+        if( connector == nullptr ) {
+            continue;
+        }
+        for( const tripoint &veh_abs : connector->connected_vehicles ) {
+            vehicle *veh = vehicle::find_vehicle( veh_abs );
+            if( veh == nullptr ) {
+                // TODO: Disconnect
+                debugmsg( "lost vehicle at %d,%d,%d", veh_abs.x, veh_abs.y, veh_abs.z );
                 continue;
             }
+            connected_vehicles.push_back( veh );
+        }
+    }
+    return connected_vehicles;
+}
 
-            vehicle_connector_tile *connector = active_tiles::furn_at<vehicle_connector_tile>( loc.absolute );
-            if( connector != nullptr ) {
-                for( const tripoint &veh_abs : connector->connected_vehicles ) {
-                    vehicle *veh = vehicle::find_vehicle( veh_abs );
-                    if( veh == nullptr ) {
-                        // TODO: Disconnect
-                        debugmsg( "lost vehicle at %d,%d,%d", veh_abs.x, veh_abs.y, veh_abs.z );
-                        continue;
-                    }
-                    connected_vehicles.push_back( veh );
-                }
+int distribution_grid::mod_resource( int amt, bool recurse )
+{
+    for( const tripoint &p : battery_tiles ) {
+        battery_tile *battery = active_tiles::furn_at<battery_tile>( p );
+        if( battery != nullptr ) {
+            amt = battery->mod_resource( amt );
+            if( amt == 0 ) {
+                return 0;
             }
         }
     }
 
+    if( !recurse ) {
+        return amt;
+    }
+
+    const std::vector<vehicle *> connected_vehicles = get_connected_vehicles();
     // TODO: Giga ugly. We only charge the first vehicle to get it to use its recursive graph traversal because it's inaccessible from here due to being a template method
     if( !connected_vehicles.empty() ) {
         if( amt > 0 ) {
@@ -116,34 +131,18 @@ int distribution_grid::mod_resource( int amt, bool recurse )
 int distribution_grid::get_resource( bool recurse ) const
 {
     int res = 0;
-    std::vector<vehicle *> connected_vehicles;
-    for( const std::pair<const tripoint, std::vector<tile_location>> &c : contents ) {
-        for( const tile_location &loc : c.second ) {
-            battery_tile *battery = active_tiles::furn_at<battery_tile>( loc.absolute );
-            if( battery != nullptr ) {
-                res += battery->get_resource();
-                continue;
-            }
-
-            if( !recurse ) {
-                continue;
-            }
-
-            vehicle_connector_tile *connector = active_tiles::furn_at<vehicle_connector_tile>( loc.absolute );
-            if( connector != nullptr ) {
-                for( const tripoint &veh_abs : connector->connected_vehicles ) {
-                    vehicle *veh = vehicle::find_vehicle( veh_abs );
-                    if( veh == nullptr ) {
-                        // TODO: Disconnect
-                        debugmsg( "lost vehicle at %d,%d,%d", veh_abs.x, veh_abs.y, veh_abs.z );
-                        continue;
-                    }
-                    connected_vehicles.push_back( veh );
-                }
-            }
+    for( const tripoint &p : battery_tiles ) {
+        battery_tile *battery = active_tiles::furn_at<battery_tile>( p );
+        if( battery != nullptr ) {
+            res += battery->get_resource();
         }
     }
 
+    if( !recurse ) {
+        return res;
+    }
+
+    const std::vector<vehicle *> connected_vehicles = get_connected_vehicles();
     // TODO: Giga ugly. We only charge the first vehicle to get it to use its recursive graph traversal because it's inaccessible from here due to being a template method
     if( !connected_vehicles.empty() ) {
         res = connected_vehicles.front()->fuel_left( itype_battery, true );
@@ -181,6 +180,7 @@ distribution_grid &distribution_grid_tracker::make_distribution_grid_at( const t
     for( const tripoint &smp : submap_positions ) {
         parent_distribution_grids[smp] = dist_grid;
     }
+    grids_to_update_dirty = true;
 
     // This ugly expression + lint suppresion are needed to convince clang-tidy
     // that we are, in fact, NOT leaking memory.
@@ -194,6 +194,7 @@ distribution_grid &distribution_grid_tracker::make_distribution_grid_at( const t
 void distribution_grid_tracker::on_saved()
 {
     parent_distribution_grids.clear();
+    grids_to_update_dirty = true;
     if( !get_option<bool>( "ELECTRIC_GRID" ) ||
         world_generator->active_world == nullptr ) {
         return;
@@ -257,13 +258,18 @@ std::uintptr_t distribution_grid_tracker::debug_grid_id( const tripoint &omp ) c
 
 void distribution_grid_tracker::update( time_point to )
 {
-    // TODO: Don't recalc this every update
-    std::unordered_set<const distribution_grid *> updated;
-    for( auto &pr : parent_distribution_grids ) {
-        if( updated.count( pr.second.get() ) == 0 ) {
-            updated.emplace( pr.second.get() );
-            pr.second->update( to );
+    if( grids_to_update_dirty ) {
+        grids_to_update.clear();
+        std::unordered_set<const distribution_grid *> seen;
+        for( auto &pr : parent_distribution_grids ) {
+            if( !pr.second->empty() && seen.insert( pr.second.get() ).second ) {
+                grids_to_update.push_back( pr.second.get() );
+            }
         }
+        grids_to_update_dirty = false;
+    }
+    for( distribution_grid *grid : grids_to_update ) {
+        grid->update( to );
     }
 }
 
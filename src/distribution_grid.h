@@ -12,6 +12,7 @@
 
 class map;
 class mapbuffer;
+class vehicle;
 
 struct tile_location {
     point on_submap;
@@ -33,16 +34,29 @@ class distribution_grid
     private:
         friend class distribution_grid_tracker;
 
+        struct submap_contents {
+            tripoint sm_coord;
+            /** Points on this submap that contain an active tile. */
+            std::vector<tile_location> tiles;
+        };
+        /** Submaps of the grid that contain at least one active tile. */
+        std::vector<submap_contents> contents;
+        std::vector<tripoint> flat_contents;
         /**
-         * Map of submap coords to points on this submap
-         * that contain an active tile.
+         * Absolute positions of the tiles that store or pass on the resource, so that
+         * charging and discharging doesn't have to look at every producer and consumer.
          */
-        std::map<tripoint, std::vector<tile_location>> contents;
-        std::vector<tripoint> flat_contents;
+        /**@{*/
+        std::vector<tripoint> battery_tiles;
+        std::vector<tripoint> connector_tiles;
+        /**@}*/
         std::vector<tripoint> submap_coords;
 
         mapbuffer &mb;
 
+        /** Vehicles plugged into the connectors of this grid. */
+        std::vector<vehicle *> get_connected_vehicles() const;
+
     public:
         distribution_grid( const std::vector<tripoint> &global_submap_coords, mapbuffer &buffer );
         bool empty() const;
@@ -66,6 +80,15 @@ class distribution_grid_tracker
          */
         std::map<tripoint, shared_ptr_fast<distribution_grid>> parent_distribution_grids;
 
+        /**
+         * Each distinct grid with active tiles, in the order they are updated.
+         * Most submaps in range have a grid with nothing on it, and every grid is
+         * shared by all of its submaps, so this skips both on every update.
+         * Rebuilt on the next update after @ref parent_distribution_grids changes.
+         */
+        std::vector<distribution_grid *> grids_to_update;
+        bool grids_to_update_dirty = true;
+
         /**
          * @param omt_pos Absolute submap position of one of the tiles of the grid.
          */
@@ -876,6 +876,9 @@ std::vector<efftype_id> effect::get_blocks_effects() const
 int effect::get_mod( std::string arg, bool reduced ) const
 {
     auto &mod_data = eff_type->mod_data;
+    if( mod_data.empty() ) {
+        return 0;
+    }
     double min = 0;
     double max = 0;
     // Get the minimum total
@@ -908,6 +911,9 @@ int effect::get_mod( std::string arg, bool reduced ) const
 int effect::get_avg_mod( std::string arg, bool reduced ) const
 {
     auto &mod_data = eff_type->mod_data;
+    if( mod_data.empty() ) {
+        return 0;
+    }
     double min = 0;
     double max = 0;
     // Get the minimum total
@@ -939,6 +945,9 @@ int effect::get_avg_mod( std::string arg, bool reduced ) const
 
 int effect::get_amount( std::string arg, bool reduced ) const
 {
+    if( eff_type->mod_data.empty() ) {
+        return 0;
+    }
     int intensity_capped = eff_type->max_effective_intensity > 0 ? std::min(
                                eff_type->max_effective_intensity, intensity ) : intensity;
     auto &mod_data = eff_type->mod_data;
@@ -957,6 +966,9 @@ int effect::get_amount( std::string arg, bool reduced ) const
 int effect::get_min_val( std::string arg, bool reduced ) const
 {
     auto &mod_data = eff_type->mod_data;
+    if( mod_data.empty() ) {
+        return 0;
+    }
     double ret = 0;
     auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "min_val" ) );
     if( found != mod_data.end() ) {
@@ -972,6 +984,9 @@ int effect::get_min_val( std::string arg, bool reduced ) const
 int effect::get_max_val( std::string arg, bool reduced ) const
 {
     auto &mod_data = eff_type->mod_data;
+    if( mod_data.empty() ) {
+        return 0;
+    }
     double ret = 0;
     auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "max_val" ) );
     if( found != mod_data.end() ) {
@@ -40,6 +40,11 @@ void event_bus::subscribe( event_subscriber *s )
 {
     if( get_option<bool>( "ENABLE_EVENTS" ) ) {
         subscribers.push_back( s );
+        for( size_t i = 0; i < subscribers_by_type.size(); ++i ) {
+            if( s->wants( static_cast<event_type>( i ) ) ) {
+                subscribers_by_type[i].push_back( s );
+            }
+        }
         s->on_subscribe( this );
     }
 }
@@ -52,12 +57,15 @@ void event_bus::unsubscribe( event_subscriber *s )
     } else {
         ( *it )->on_unsubscribe( this );
         subscribers.erase( it );
+        for( std::vector<event_subscriber *> &typed : subscribers_by_type ) {
+            typed.erase( std::remove( typed.begin(), typed.end(), s ), typed.end() );
+        }
     }
 }
 
 void event_bus::send( const cata::event &e ) const
 {
-    for( event_subscriber *s : subscribers ) {
+    for( event_subscriber *s : subscribers_by_type[static_cast<size_t>( e.type() )] ) {
         s->notify( e );
     }
 }
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_EVENT_BUS_H
 #define CATA_SRC_EVENT_BUS_H
 
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -17,6 +18,13 @@ class event_subscriber
         event_subscriber &operator=( const event_subscriber & ) = delete;
         virtual ~event_subscriber();
         virtual void notify( const cata::event & ) = 0;
+        /**
+         * Whether @ref notify should be called for events of the given type. Queried once on
+         * subscription, events that no subscriber wants are not even constructed.
+         */
+        virtual bool wants( event_type ) const {
+            return true;
+        }
     private:
         friend class event_bus;
         void on_subscribe( event_bus * );
@@ -37,10 +45,15 @@ class event_bus
         void send( const cata::event & ) const;
         template<event_type Type, typename... Args>
         void send( Args &&... args ) const {
+            if( subscribers_by_type[static_cast<size_t>( Type )].empty() ) {
+                return;
+            }
             send( cata::event::make<Type>( std::forward<Args>( args )... ) );
         }
     private:
         std::vector<event_subscriber *> subscribers;
+        std::array<std::vector<event_subscriber *>, static_cast<size_t>( event_type::num_event_types )>
+        subscribers_by_type;
 };
 
 event_bus &get_event_bus();
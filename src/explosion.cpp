@@ -318,7 +318,9 @@ static std::map<const Creature *, int> shrapnel( const tripoint &src, const proj
     // TODO: Calculate range based on max effective range for projectiles.
     // Basically bisect between 0 and map diameter using shrapnel_calc().
     // Need to update shadowcasting to support limiting range without adjusting initial distance.
-    const tripoint_range area = g->m.points_on_zlevel( src.z );
+    // Shadowcasting below never looks further than fragment.range + 1 squares from the source,
+    // so only that part of the z-level needs its obstacles cached and its targets checked.
+    const tripoint_range area = g->m.points_in_radius( src, std::max( 0, fragment.range + 1 ) );
 
     g->m.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, obstacle_cache );
 
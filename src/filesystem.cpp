@@ -429,6 +429,37 @@ std::vector<std::string> get_directories_with( const std::vector<std::string> &p
     return files;
 }
 
+std::vector<std::string> get_subdirectories( const std::string &root_path,
+        const bool recursive_search )
+{
+    return find_file_if_bfs( root_path, recursive_search, []( const dirent &, const bool is_dir ) {
+        return is_dir;
+    } );
+}
+
+int64_t get_modification_time( const std::string &path )
+{
+#if defined(_WIN32)
+    struct _stat result;
+    const int stat_ret = _wstat( utf8_to_wstr( path ).c_str(), &result );
+#else
+    struct stat result;
+    const int stat_ret = stat( path.c_str(), &result );
+#endif
+    if( stat_ret != 0 ) {
+        return -1;
+    }
+    static constexpr int64_t ns_per_s = 1000000000;
+#if defined(_WIN32)
+    return static_cast<int64_t>( result.st_mtime ) * ns_per_s;
+#elif defined(__APPLE__)
+    return static_cast<int64_t>( result.st_mtimespec.tv_sec ) * ns_per_s +
+           result.st_mtimespec.tv_nsec;
+#else
+    return static_cast<int64_t>( result.st_mtim.tv_sec ) * ns_per_s + result.st_mtim.tv_nsec;
+#endif
+}
+
 bool copy_file( const std::string &source_path, const std::string &dest_path )
 {
     cata_ifstream source_stream = std::move( cata_ifstream().mode( cata_ios_mode::binary ).open(
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_FILESYSTEM_H
 #define CATA_SRC_FILESYSTEM_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -89,6 +90,16 @@ std::vector<std::string> get_directories_with( const std::vector<std::string> &p
 std::vector<std::string> get_directories_with( const std::string &pattern,
         const std::string &root_path = "", bool recursive_search = false );
 
+/** Returns the directories inside @p root_path, in the order of @ref get_files_from_path. */
+std::vector<std::string> get_subdirectories( const std::string &root_path,
+        bool recursive_search = false );
+
+/**
+ * Last modification time of @p path in nanoseconds since the epoch, or -1 if it can't be read.
+ * The resolution depends on the platform and file system, on Windows it is whole seconds.
+ */
+int64_t get_modification_time( const std::string &path );
+
 /**
  *  Replace invalid characters in a string with a default character; can be used to ensure that a file name is compliant with most file systems.
  *  @param file_name Name of the file to check.
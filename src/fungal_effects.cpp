@@ -1,6 +1,7 @@
 #include "fungal_effects.h"
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -44,17 +45,12 @@ static const species_id FUNGUS( "FUNGUS" );
 static const trait_id trait_TAIL_CATTLE( "TAIL_CATTLE" );
 static const trait_id trait_THRESH_MYCUS( "THRESH_MYCUS" );
 
-static const std::string flag_DIGGABLE( "DIGGABLE" );
-static const std::string flag_FLAMMABLE( "FLAMMABLE" );
-static const std::string flag_FLAT( "FLAT" );
 static const std::string flag_FLOWER( "FLOWER" );
 static const std::string flag_FUNGUS( "FUNGUS" );
 static const std::string flag_ORGANIC( "ORGANIC" );
 static const std::string flag_PLANT( "PLANT" );
 static const std::string flag_SHRUB( "SHRUB" );
-static const std::string flag_THIN_OBSTACLE( "THIN_OBSTACLE" );
 static const std::string flag_TREE( "TREE" );
-static const std::string flag_WALL( "WALL" );
 static const std::string flag_YOUNG( "YOUNG" );
 
 fungal_effects::fungal_effects( game &g, map &mp )
@@ -140,12 +136,12 @@ void fungal_effects::spread_fungus_one_tile( const tripoint &p, const int growth
 {
     bool converted = false;
     // Terrain conversion
-    if( m.has_flag_ter( flag_DIGGABLE, p ) ) {
+    if( m.has_flag_ter( TFLAG_DIGGABLE, p ) ) {
         if( x_in_y( growth * 10, 100 ) ) {
             m.ter_set( p, t_fungus );
             converted = true;
         }
-    } else if( m.has_flag( flag_FLAT, p ) ) {
+    } else if( m.has_flag( TFLAG_FLAT, p ) ) {
         if( m.has_flag( TFLAG_INDOORS, p ) ) {
             if( x_in_y( growth * 10, 500 ) ) {
                 m.ter_set( p, t_fungus_floor_in );
@@ -170,7 +166,7 @@ void fungal_effects::spread_fungus_one_tile( const tripoint &p, const int growth
             m.ter_set( p, t_marloss );
             converted = true;
         }
-    } else if( m.has_flag( flag_THIN_OBSTACLE, p ) ) {
+    } else if( m.has_flag( TFLAG_THIN_OBSTACLE, p ) ) {
         if( x_in_y( growth * 10, 150 ) ) {
             m.ter_set( p, t_fungus_mound );
             converted = true;
@@ -207,7 +203,7 @@ void fungal_effects::spread_fungus_one_tile( const tripoint &p, const int growth
             }
             converted = true;
         }
-    } else if( m.has_flag( flag_WALL, p ) && m.has_flag( flag_FLAMMABLE, p ) ) {
+    } else if( m.has_flag( TFLAG_WALL, p ) && m.has_flag( TFLAG_FLAMMABLE, p ) ) {
         if( x_in_y( growth * 10, 5000 ) ) {
             m.ter_set( p, t_fungus_wall );
             converted = true;
@@ -242,11 +238,12 @@ void fungal_effects::spread_fungus_one_tile( const tripoint &p, const int growth
 void fungal_effects::spread_fungus( const tripoint &p )
 {
     int growth = 1;
+    // Looked up once, the spreading below only ever changes the tile it is looking at.
+    std::array<bool, 9> is_fungus = {};
     for( const tripoint &tmp : g->m.points_in_radius( p, 1 ) ) {
-        if( tmp == p ) {
-            continue;
-        }
-        if( m.has_flag( flag_FUNGUS, tmp ) ) {
+        const bool fungus = m.has_flag( flag_FUNGUS, tmp );
+        is_fungus[( tmp.x - p.x + 1 ) * 3 + tmp.y - p.y + 1] = fungus;
+        if( fungus && tmp != p ) {
             growth += 1;
         }
     }
@@ -260,7 +257,7 @@ void fungal_effects::spread_fungus( const tripoint &p )
         }
         for( const tripoint &dest : g->m.points_in_radius( p, 1 ) ) {
             // One spread on average
-            if( !m.has_flag( flag_FUNGUS, dest ) && one_in( 9 - growth ) ) {
+            if( !is_fungus[( dest.x - p.x + 1 ) * 3 + dest.y - p.y + 1] && one_in( 9 - growth ) ) {
                 //growth chance is 100 in X simplified
                 spread_fungus_one_tile( dest, 10 );
             }
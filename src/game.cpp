@@ -53,6 +53,7 @@
 #include "construction.h"
 #include "coordinate_conversions.h"
 #include "coordinates.h"
+#include "crafting_gui.h"
 #include "creature_tracker.h"
 #include "cursesport.h"
 #include "damage.h"
@@ -125,6 +126,7 @@
 #include "player.h"
 #include "player_activity.h"
 #include "popup.h"
+#include "profiler.h"
 #include "recipe.h"
 #include "recipe_dictionary.h"
 #include "ret_val.h"
@@ -182,6 +184,8 @@ class computer;
 const int core_version = 6;
 static constexpr int DANGEROUS_PROXIMITY = 5;
 
+static const activity_id ACT_OPERATION( "ACT_OPERATION" );
+
 static const mtype_id mon_manhack( "mon_manhack" );
 
 static const skill_id skill_melee( "melee" );
@@ -220,6 +224,7 @@ static const efftype_id effect_stunned( "stunned" );
 static const efftype_id effect_tetanus( "tetanus" );
 static const efftype_id effect_tied( "tied" );
 
+static const bionic_id bio_alarm( "bio_alarm" );
 static const bionic_id bio_remote( "bio_remote" );
 
 static const trait_id trait_BADKNEES( "BADKNEES" );
@@ -587,6 +592,8 @@ void game::setup()
     // reset follower list
     follower_ids.clear();
     scent.reset();
+    // The next character may be a different one
+    reset_recipe_availability();
 
     remoteveh_cache_time = calendar::before_time_starts;
     remoteveh_cache = nullptr;
@@ -1350,6 +1357,13 @@ void game::calc_driving_offset( vehicle *veh )
 // Returns true if game is over (death, saved, quit, etc)
 bool game::do_turn()
 {
+    profiler::scoped_zone zone( "game::do_turn" );
+    const auto turn_start = std::chrono::steady_clock::now();
+    on_out_of_scope turn_metrics( [&]() {
+        if( !profiler::metrics_file.empty() ) {
+            update_metrics( std::chrono::steady_clock::now() - turn_start );
+        }
+    } );
     if( is_game_over() ) {
         return cleanup_at_end();
     }
@@ -1363,6 +1377,7 @@ bool game::do_turn()
 
     // starting a new turn, clear out temperature cache
     weather.clear_temp_cache();
+    flushDebugLogIfDue();
 
     if( npcs_dirty ) {
         load_npcs();
@@ -1536,9 +1551,20 @@ bool game::do_turn()
     update_stair_monsters();
     mon_info_update();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
-        ui_manager::redraw();
-        refresh_display();
+    // While sleeping or busy with an activity that has a progress message the wait popup
+    // below redraws at its own, much slower rate, so don't force a redraw every turn.
+    const bool shows_wait_popup = u.has_effect( effect_sleep ) ||
+                                  ( u.activity && !u.activity.get_verb().empty() );
+    if( u.moves < 0 && !shows_wait_popup && get_option<bool>( "FORCE_REDRAW" ) ) {
+        // Cap forced redraws to roughly the display refresh rate; frames drawn faster
+        // than that are never seen.  The next input prompt redraws unconditionally.
+        static auto last_redraw = std::chrono::steady_clock::now() - std::chrono::seconds( 1 );
+        const auto now = std::chrono::steady_clock::now();
+        if( now - last_redraw >= std::chrono::milliseconds( 16 ) ) {
+            ui_manager::redraw();
+            refresh_display();
+            last_redraw = now;
+        }
     }
 
     if( get_levz() >= 0 && !u.is_underwater() ) {
@@ -1765,25 +1791,43 @@ static int maptile_field_intensity( maptile &mt, field_type_id fld )
 int get_heat_radiation( const tripoint &location, bool direct )
 {
     // Direct heat from fire sources
-    // Cache fires to avoid scanning the map around us bp times
-    // Stored as intensity-distance pairs
-    int temp_mod = 0;
-    int best_fire = 0;
-    for( const tripoint &dest : g->m.points_in_radius( location, 6 ) ) {
-        int heat_intensity = 0;
-
+    // Only fire fields and lava radiate heat, so rather than scanning every square in range
+    // collect those: fires from the field tiles of submaps that have fields, lava from the
+    // map's trap locations.
+    // Stored as position-intensity pairs
+    const tripoint_range range = g->m.points_in_radius( location, 6 );
+    const tripoint &lo = range.min();
+    const tripoint &hi = range.max();
+    const auto in_range = [&]( const tripoint & p ) {
+        return p.z == lo.z && p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y;
+    };
+    std::vector<std::pair<tripoint, int>> sources;
+    for( const tripoint &dest : g->m.points_with_fields( range ) ) {
         maptile mt = g->m.maptile_at( dest );
-
-        int ffire = maptile_field_intensity( mt, fd_fire );
+        const int ffire = maptile_field_intensity( mt, fd_fire );
         if( ffire > 0 ) {
-            heat_intensity = ffire;
-        } else if( g->m.tr_at( dest ).loadid == tr_lava ) {
-            heat_intensity = 3;
+            sources.emplace_back( dest, ffire );
         }
-        if( heat_intensity == 0 ) {
-            // No heat source here
+    }
+    for( const tripoint &dest : g->m.trap_locations( tr_lava ) ) {
+        // Squares on fire radiate by their fire instead, and a square can be listed
+        // both for its terrain and its trap
+        if( !in_range( dest ) || g->m.tr_at( dest ).loadid != tr_lava ) {
             continue;
         }
+        const auto same_square = [&]( const std::pair<tripoint, int> &source ) {
+            return source.first == dest;
+        };
+        if( std::none_of( sources.begin(), sources.end(), same_square ) ) {
+            sources.emplace_back( dest, 3 );
+        }
+    }
+
+    int temp_mod = 0;
+    int best_fire = 0;
+    for( const std::pair<tripoint, int> &source : sources ) {
+        const tripoint &dest = source.first;
+        const int heat_intensity = source.second;
         if( g->u.pos() == location ) {
             if( !g->m.pl_line_of_sight( dest, -1 ) ) {
                 continue;
@@ -2721,6 +2765,7 @@ bool game::load( const save_t &name )
     // Now load up the master game data; factions (and more?)
     load_master();
     u = avatar();
+    reset_recipe_availability();
     u.name = name.player_name();
     // This should be initialized more globally (in player/Character constructor)
     u.weapon = item( "null", calendar::start_of_cataclysm );
@@ -2918,6 +2963,11 @@ bool game::save_maps()
 {
     try {
         m.save();
+        // Keep the overmaps around the player in memory and write out the rest, so that
+        // long journeys don't accumulate every overmap ever visited.
+        static constexpr int overmap_keep_radius = 4;
+        overmap_buffer.unload_distant( omt_to_om_copy( u.global_omt_location().xy() ),
+                                       overmap_keep_radius ); // can throw
         overmap_buffer.save(); // can throw
         MAPBUFFER.save(); // can throw
         return true;
@@ -4088,6 +4138,10 @@ void game::mon_info_update( )
     const time_duration sm_ignored_time = time_duration::from_turns(
             get_option<int>( "SAFEMODEIGNORETURNS" ) );
 
+    safemode &sm = get_safemode();
+    // Without any rules no name can match them, so don't build the names to check
+    const bool safemode_empty = sm.empty();
+
     for( Creature *c : u.get_visible_creatures( MAPSIZE_X ) ) {
         monster *m = dynamic_cast<monster *>( c );
         npc *p = dynamic_cast<npc *>( c );
@@ -4148,7 +4202,6 @@ void game::mon_info_update( )
         }
 
         rule_state safemode_state = RULE_NONE;
-        const bool safemode_empty = get_safemode().empty();
 
         if( m != nullptr ) {
             //Safemode monster check
@@ -4156,7 +4209,10 @@ void game::mon_info_update( )
 
             const monster_attitude matt = critter.attitude( &u );
             const int mon_dist = rl_dist( u.pos(), critter.pos() );
-            safemode_state = get_safemode().check_monster( critter.name(), critter.attitude_to( u ), mon_dist );
+            if( !safemode_empty ) {
+                safemode_state = sm.check_monster( critter.name(), critter.attitude_to( u ),
+                                                   mon_dist );
+            }
 
             if( ( !safemode_empty && safemode_state == RULE_BLACKLISTED ) || ( safemode_empty &&
                     ( MATT_ATTACK == matt || MATT_FOLLOW == matt ) ) ) {
@@ -4192,8 +4248,10 @@ void game::mon_info_update( )
             //Safe mode NPC check
 
             const int npc_dist = rl_dist( u.pos(), p->pos() );
-            safemode_state = get_safemode().check_monster( get_safemode().npc_type_name(), p->attitude_to( u ),
-                             npc_dist );
+            if( !safemode_empty ) {
+                safemode_state = sm.check_monster( sm.npc_type_name(), p->attitude_to( u ),
+                                                   npc_dist );
+            }
 
             if( ( !safemode_empty && safemode_state == RULE_BLACKLISTED ) || ( safemode_empty &&
                     p->get_attitude() == NPCATT_KILL ) ) {
@@ -4288,6 +4346,7 @@ void game::cleanup_dead()
 
 void game::monmove()
 {
+    profiler::scoped_zone zone( "game::monmove" );
     cleanup_dead();
 
     for( monster &critter : all_monsters() ) {
@@ -4335,10 +4394,10 @@ void game::monmove()
         }
 
         if( !critter.is_dead() &&
-            u.has_active_bionic( bionic_id( "bio_alarm" ) ) &&
-            u.get_power_level() >= 25_kJ &&
             rl_dist( u.pos(), critter.pos() ) <= 5 &&
-            !critter.is_hallucination() ) {
+            !critter.is_hallucination() &&
+            u.has_active_bionic( bio_alarm ) &&
+            u.get_power_level() >= 25_kJ ) {
             u.mod_power_level( -25_kJ );
             add_msg( m_warning, _( "Your motion alarm goes off!" ) );
             cancel_activity_or_ignore_query( distraction_type::motion_alarm,
@@ -4374,7 +4433,7 @@ void game::monmove()
             guy.process_turn();
         }
         while( !guy.is_dead() && guy.moves > 0 && turns < 10 &&
-               ( !guy.in_sleep_state() || guy.activity.id() == activity_id( "ACT_OPERATION" ) )
+               ( !guy.in_sleep_state() || guy.activity.id() == ACT_OPERATION )
              ) {
             int moves = guy.moves;
             guy.move();
@@ -4421,6 +4480,8 @@ void game::overmap_npc_move()
             travelling_npcs.push_back( npc_to_add );
         }
     }
+    // Reloading unloads and loads every active NPC, so do it once after everyone travelled
+    bool needs_reload = false;
     for( auto &elem : travelling_npcs ) {
         if( elem->has_omt_destination() ) {
             if( !elem->omt_path.empty() && rl_dist( elem->omt_path.back(), elem->global_omt_location() ) > 2 ) {
@@ -4443,10 +4504,12 @@ void game::overmap_npc_move()
                 }
                 elem->travel_overmap( omt_to_sm_copy( elem->omt_path.back() ) );
             }
-            reload_npcs();
+            needs_reload = true;
         }
     }
-    return;
+    if( needs_reload ) {
+        reload_npcs();
+    }
 }
 
 /* Knockback target at t by force number of tiles in direction from s to t
@@ -7001,37 +7064,34 @@ look_around_result game::look_around( const bool show_window, tripoint &center,
 
 std::vector<map_item_stack> game::find_nearby_items( int iRadius )
 {
-    std::map<std::string, map_item_stack> temp_items;
     std::vector<map_item_stack> ret;
-    std::vector<std::string> item_order;
+    // Index of the stack in ret for each item name, stacks are kept in the order names are found
+    std::unordered_map<std::string, size_t> stack_index;
 
     if( u.is_blind() ) {
         return ret;
     }
 
     for( auto &points_p_it : closest_tripoints_first( u.pos(), iRadius ) ) {
+        // Most tiles are empty, so test for items before the much more expensive sight check.
         if( points_p_it.y >= u.posy() - iRadius && points_p_it.y <= u.posy() + iRadius &&
-            u.sees( points_p_it ) &&
-            m.sees_some_items( points_p_it, u ) ) {
+            m.sees_some_items( points_p_it, u ) &&
+            u.sees( points_p_it ) ) {
 
+            const tripoint relative_pos = points_p_it - u.pos();
             for( auto &elem : m.i_at( points_p_it ) ) {
                 const std::string name = elem.tname();
-                const tripoint relative_pos = points_p_it - u.pos();
-
-                if( std::find( item_order.begin(), item_order.end(), name ) == item_order.end() ) {
-                    item_order.push_back( name );
-                    temp_items[name] = map_item_stack( &elem, relative_pos );
+                const auto iter = stack_index.find( name );
+                if( iter == stack_index.end() ) {
+                    stack_index.emplace( name, ret.size() );
+                    ret.emplace_back( &elem, relative_pos );
                 } else {
-                    temp_items[name].add_at_pos( &elem, relative_pos );
+                    ret[iter->second].add_at_pos( &elem, relative_pos );
                 }
             }
         }
     }
 
-    for( auto &elem : item_order ) {
-        ret.push_back( temp_items[elem] );
-    }
-
     return ret;
 }
 
@@ -7368,6 +7428,9 @@ game::vmenu_ret game::list_items( const std::vector<map_item_stack> &item_list )
     int iCatSortNum = 0;
     int iScrollPos = 0;
     std::map<int, std::string> mSortCategory;
+    // Info of the selected item, only regenerated when the selection changes
+    const item *info_item = nullptr;
+    std::vector<iteminfo> info_item_data;
 
     std::string action;
     input_context ctxt( "LIST_ITEMS" );
@@ -7480,11 +7543,14 @@ game::vmenu_ret game::list_items( const std::vector<map_item_stack> &item_list )
             werase( w_item_info );
 
             if( iItemNum > 0 && activeItem ) {
-                std::vector<iteminfo> vThisItem;
+                if( info_item != activeItem->example ) {
+                    info_item = activeItem->example;
+                    info_item_data.clear();
+                    info_item->info( true, info_item_data );
+                }
                 std::vector<iteminfo> vDummy;
-                activeItem->example->info( true, vThisItem );
 
-                item_info_data dummy( "", "", vThisItem, vDummy, iScrollPos );
+                item_info_data dummy( "", "", info_item_data, vDummy, iScrollPos );
                 dummy.without_getch = true;
                 dummy.without_border = true;
 
@@ -10891,6 +10957,9 @@ point game::update_map( player &p )
     return update_map( x, y );
 }
 
+// Several times what the map itself holds with z-levels.
+static constexpr size_t max_buffered_submaps = 20000;
+
 point game::update_map( int &x, int &y )
 {
     point shift;
@@ -10936,6 +11005,9 @@ point game::update_map( int &x, int &y )
     // TODO: Shift, don't reload
     grid_tracker_ptr->load( m );
 
+    // Keeps long trips from holding every submap passed through until the next save.
+    MAPBUFFER.evict_distant( max_buffered_submaps );
+
     // Shift monsters
     shift_monsters( tripoint( shift, 0 ) );
     const point shift_ms = sm_to_ms_copy( shift );
@@ -11443,6 +11515,7 @@ void game::debug_hour_timer::toggle()
 {
     enabled = !enabled;
     start_time = cata::nullopt;
+    profiler::set_enabled( enabled );
     add_msg( string_format( "debug timer %s", enabled ? "enabled" : "disabled" ) );
 }
 
@@ -11454,14 +11527,62 @@ void game::debug_hour_timer::print_time()
                                       std::chrono::system_clock::now() );
             if( start_time ) {
                 add_msg( "in-game hour took: %d ms", ( now - *start_time ).count() );
+                for( const profiler::zone_stats &zone : profiler::collected() ) {
+                    add_msg( "  %s: %d ms over %d calls, max %d us", zone.name,
+                             std::chrono::duration_cast<std::chrono::milliseconds>( zone.total ).count(),
+                             zone.calls,
+                             std::chrono::duration_cast<std::chrono::microseconds>( zone.max ).count() );
+#if defined(CATA_TRACK_ALLOCATIONS)
+                    add_msg( "    %d allocations, %d bytes", zone.allocations, zone.allocated_bytes );
+#endif
+                }
             } else {
                 add_msg( "starting debug timer" );
             }
             start_time = now;
+            profiler::reset();
         }
     }
 }
 
+void game::update_metrics( std::chrono::nanoseconds turn_time )
+{
+    profiler::record_turn( turn_time );
+
+    static std::chrono::steady_clock::time_point last_write;
+    const auto now = std::chrono::steady_clock::now();
+    if( now - last_write < std::chrono::seconds( 10 ) ) {
+        return;
+    }
+    last_write = now;
+
+    std::vector<std::pair<std::string, int64_t>> counters = {
+        { "turn", to_turns<int>( calendar::turn - calendar::turn_zero ) },
+        { "monsters", static_cast<int64_t>( critter_tracker->size() ) },
+        { "npcs", static_cast<int64_t>( active_npc.size() ) },
+        { "active_items", static_cast<int64_t>( m.active_item_count() ) },
+        { "fields", m.field_count() },
+        { "vehicles", static_cast<int64_t>( m.get_vehicles().size() ) },
+        { "submaps_loaded", static_cast<int64_t>( MAPBUFFER.size() ) },
+        { "overmaps_loaded", static_cast<int64_t>( overmap_buffer.loaded_count() ) },
+    };
+    for( const std::pair<std::string, int64_t> &usage : memory_usage() ) {
+        counters.emplace_back( usage.first + "_bytes", usage.second );
+    }
+    profiler::write_metrics( counters );
+}
+
+std::vector<std::pair<std::string, int64_t>> game::memory_usage() const
+{
+    return {
+        { "mapbuffer", static_cast<int64_t>( MAPBUFFER.memory_usage() ) },
+        { "overmapbuffer", static_cast<int64_t>( overmap_buffer.memory_usage() ) },
+        { "map_memory", static_cast<int64_t>( u.map_memory_usage() ) },
+        { "map_caches", static_cast<int64_t>( m.cache_memory_usage() ) },
+        { "heap", heap_in_use() },
+    };
+}
+
 void game::display_lighting()
 {
     if( use_tiles ) {
@@ -504,6 +504,8 @@ class game
     public:
         /** Unloads, then loads the NPCs */
         void reload_npcs();
+        /** Approximate bytes held by each of the big containers, by name. */
+        std::vector<std::pair<std::string, int64_t>> memory_usage() const;
         const kill_tracker &get_kill_tracker() const;
         /** Add follower id to set of followers. */
         void add_npc_follower( const character_id &id );
@@ -953,6 +955,9 @@ class game
                 cata::optional<IRLTimeMs> start_time = cata::nullopt;
         } debug_hour_timer;
 
+        /** Records the duration of a turn and, at most every few seconds, writes the metrics file. */
+        void update_metrics( std::chrono::nanoseconds turn_time );
+
         Creature *is_hostile_within( int distance );
 
         void move_save_to_graveyard();
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <bitset>
 #include <set>
+#include <sstream>
 #include <unordered_map>
 #include <vector>
 
@@ -12,6 +13,7 @@
 #include "catacharset.h"
 #include "debug.h"
 #include "enum_bitset.h"
+#include "filesystem.h"
 #include "init.h"
 #include "int_id.h"
 #include "json.h"
@@ -40,6 +42,11 @@ can be by it to implement its interface.
   The type can also have:
   - a 'check()' function (to run `generic_factory::check()` on all objects)
 
+  Types that are rarely needed can opt in to lazy loading via `set_lazy_loading`: the
+  factory then only remembers where the JSON of each object is, and calls `T::load`
+  on the first `obj()` access (or when `load_all`, `get_all` or `check` is called).
+  Such types must not rely on `finalize` visiting all their objects.
+
   Those things must be visible from the factory, you may have to add this class as
   friend if necessary.
 
@@ -138,6 +145,16 @@ class generic_factory
         std::unordered_map<string_id<T>, int_id<T>> map;
         std::unordered_map<std::string, T> abstracts;
 
+        struct lazy_source {
+            json_source_location location;
+            std::string src;
+        };
+        bool lazy_loading = false;
+        // calls `T::load`, set by `load` so that `obj` doesn't require it for all types
+        void ( *lazy_loader )( T &, const JsonObject &, const std::string & ) = nullptr;
+        // objects in `list` that only contain their id so far, by index into `list`
+        mutable std::unordered_map<int, lazy_source> lazy_sources;
+
         std::string type_name;
         std::string id_member_name;
         std::string alias_member_name;
@@ -180,6 +197,38 @@ class generic_factory
 
         const T dummy_obj;
 
+        /** Loads the object at `index` of `list` if its loading was postponed. */
+        void load_lazy( int index ) const {
+            if( lazy_sources.empty() ) {
+                return;
+            }
+            const auto iter = lazy_sources.find( index );
+            if( iter == lazy_sources.end() ) {
+                return;
+            }
+            const lazy_source source = iter->second;
+            lazy_sources.erase( iter );
+            // The objects are loaded on demand, which is an implementation detail callers
+            // of the const interface don't need to care about.
+            T &def = const_cast<T &>( list[index] );
+            try {
+                std::istringstream stream( read_entire_file( *source.location.path ) );
+                JsonIn jsin( stream, source.location );
+                JsonObject jo = jsin.get_object();
+                // Members that were read when the object was first encountered.
+                jo.has_member( "type" );
+                jo.has_member( id_member_name );
+                jo.has_member( alias_member_name );
+                T loaded;
+                loaded.id = def.id;
+                lazy_loader( loaded, jo, source.src );
+                loaded.id.set_cid_version( index, version );
+                def = loaded;
+            } catch( const JsonError &err ) {
+                debugmsg( "(json-error)\n%s", err.what() );
+            }
+        }
+
     public:
         /**
          * @param type_name A string used in debug messages as the name of `T`,
@@ -197,6 +246,15 @@ class generic_factory
               dummy_obj() {
         }
 
+        /**
+         * Postpone loading the objects until they are actually used.
+         * Only objects with a single id and without "copy-from" are postponed,
+         * the others are still loaded right away.
+         */
+        void set_lazy_loading( bool enable ) {
+            lazy_loading = enable;
+        }
+
         /**
         * Perform JSON inheritance handling for `T def` and returns true if JsonObject is real.
         *
@@ -263,8 +321,18 @@ class generic_factory
             }
             if( jo.has_string( id_member_name ) ) {
                 def.id = string_id<T>( jo.get_string( id_member_name ) );
-                def.load( jo, src );
-                insert( def );
+                if( lazy_loading && !jo.has_member( "copy-from" ) && jo.has_source_location() ) {
+                    lazy_loader = []( T & lazy, const JsonObject & lazy_jo,
+                    const std::string & lazy_src ) {
+                        lazy.load( lazy_jo, lazy_src );
+                    };
+                    insert( def );
+                    lazy_sources[map[def.id].to_i()] = lazy_source{ jo.get_source_location(), src };
+                    jo.allow_omitted_members();
+                } else {
+                    def.load( jo, src );
+                    insert( def );
+                }
 
                 if( jo.has_member( alias_member_name ) ) {
                     std::set<string_id<T>> aliases;
@@ -340,6 +408,7 @@ class generic_factory
             inc_version();
             const auto iter = map.find( obj.id );
             if( iter != map.end() ) {
+                lazy_sources.erase( iter->second.to_i() );
                 T &result = list[iter->second.to_i()];
                 result = obj;
                 result.id.set_cid_version( iter->second.to_i(), version );
@@ -366,10 +435,20 @@ class generic_factory
             }
         }
 
+        /**
+         * Loads all objects whose loading has been postponed, see `set_lazy_loading`.
+         */
+        void load_all() const {
+            while( !lazy_sources.empty() ) {
+                load_lazy( lazy_sources.begin()->first );
+            }
+        }
+
         /**
          * Checks loaded/inserted objects for consistency
          */
         void check() const {
+            load_all();
             for( const T &obj : list ) {
                 obj.check();
             }
@@ -396,11 +475,13 @@ class generic_factory
             map.clear();
             abstracts.clear();
             deferred.clear();
+            lazy_sources.clear();
         }
         /**
          * Returns all the loaded objects. It can be used to iterate over them.
          */
         const std::vector<T> &get_all() const {
+            load_all();
             return list;
         }
         /**
@@ -423,6 +504,7 @@ class generic_factory
                 debugmsg( "invalid %s id \"%d\"", type_name, id.to_i() );
                 return dummy_obj;
             }
+            load_lazy( id.to_i() );
             return list[id.to_i()];
         }
         /**
@@ -438,6 +520,7 @@ class generic_factory
                 debugmsg( "invalid %s id \"%s\"", type_name, id.c_str() );
                 return dummy_obj;
             }
+            load_lazy( i_id.to_i() );
             return list[i_id.to_i()];
         }
         /**
@@ -16,6 +16,7 @@
 #include "avatar_action.h"
 #include "bionics.h"
 #include "calendar.h"
+#include "cata_utility.h"
 #include "catacharset.h"
 #include "character.h"
 #include "character_martial_arts.h"
@@ -59,6 +60,7 @@
 #include "player.h"
 #include "player_activity.h"
 #include "popup.h"
+#include "profiler.h"
 #include "ranged.h"
 #include "rng.h"
 #include "safemode_ui.h"
@@ -1496,6 +1498,14 @@ bool game::handle_action()
         // No auto-move, ask player for input
         ctxt = get_player_input( action );
     }
+    const auto input_received = std::chrono::steady_clock::now();
+    // Logged on the way out, so that actions which return early are included.
+    on_out_of_scope log_handled_action( [&]() {
+        if( profiler::action_log_enabled() ) {
+            profiler::log_action( to_turn<int>( calendar::turn ), action_ident( act ),
+                                  std::chrono::steady_clock::now() - input_received );
+        }
+    } );
 
     const optional_vpart_position vp = m.veh_at( u.pos() );
     bool veh_ctrl = !u.is_dead_state() &&
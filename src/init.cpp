@@ -1,15 +1,22 @@
 #include "init.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <fstream>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <sstream> // for throwing errors
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
+#if defined(__GLIBC__)
+#   include <malloc.h>
+#endif
 
 #include "achievement.h"
 #include "activity_type.h"
@@ -20,6 +27,7 @@
 #include "behavior.h"
 #include "bionics.h"
 #include "bodypart.h"
+#include "cata_parallel.h"
 #include "cata_utility.h"
 #include "clothing_mod.h"
 #include "clzones.h"
@@ -41,7 +49,9 @@
 #include "fstream_utils.h"
 #include "flag.h"
 #include "gates.h"
+#include "get_version.h"
 #include "harvest.h"
+#include "hash_utils.h"
 #include "item_action.h"
 #include "item_category.h"
 #include "item_factory.h"
@@ -66,10 +76,12 @@
 #include "npc.h"
 #include "npc_class.h"
 #include "omdata.h"
+#include "options.h"
 #include "overlay_ordering.h"
 #include "overmap.h"
 #include "overmap_connection.h"
 #include "overmap_location.h"
+#include "path_info.h"
 #include "profession.h"
 #include "recipe_dictionary.h"
 #include "recipe_groups.h"
@@ -98,6 +110,71 @@
 #  include "mod_tileset.h"
 #endif
 
+static double seconds_since( const std::chrono::steady_clock::time_point &start )
+{
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+struct DynamicDataLoader::load_profile {
+    struct entry {
+        double seconds = 0;
+        int objects = 0;
+    };
+    struct stage {
+        std::string phase;
+        std::string name;
+        double seconds = 0;
+        // Change of the allocated memory, 0 if unknown.
+        int64_t heap_growth = 0;
+    };
+
+    std::string report_path;
+    std::map<std::string, entry> mods;
+    std::map<std::string, entry> types;
+    std::vector<stage> stages;
+
+    void clear() {
+        mods.clear();
+        types.clear();
+        stages.clear();
+    }
+
+    static void write_entries( JsonOut &jsout, const std::map<std::string, entry> &entries ) {
+        jsout.start_object();
+        for( const std::pair<const std::string, entry> &e : entries ) {
+            jsout.member( e.first );
+            jsout.start_object();
+            jsout.member( "seconds", e.second.seconds );
+            jsout.member( "objects", e.second.objects );
+            jsout.end_object();
+        }
+        jsout.end_object();
+    }
+
+    void write() const {
+        write_to_file( report_path, [&]( std::ostream & fout ) {
+            JsonOut jsout( fout, true );
+            jsout.start_object();
+            jsout.member( "mods" );
+            write_entries( jsout, mods );
+            jsout.member( "types" );
+            write_entries( jsout, types );
+            jsout.member( "stages" );
+            jsout.start_array();
+            for( const stage &s : stages ) {
+                jsout.start_object();
+                jsout.member( "phase", s.phase );
+                jsout.member( "name", s.name );
+                jsout.member( "seconds", s.seconds );
+                jsout.member( "heap_growth", s.heap_growth );
+                jsout.end_object();
+            }
+            jsout.end_array();
+            jsout.end_object();
+        }, nullptr );
+    }
+};
+
 DynamicDataLoader::DynamicDataLoader()
 {
     initialize();
@@ -120,7 +197,40 @@ void DynamicDataLoader::load_object( const JsonObject &jo, const std::string &sr
     if( it == type_function_map.end() ) {
         jo.throw_error( "unrecognized JSON object", "type" );
     }
+    if( !profile ) {
+        it->second( jo, src, base_path, full_path );
+        return;
+    }
+    const auto start = std::chrono::steady_clock::now();
     it->second( jo, src, base_path, full_path );
+    load_profile::entry &by_type = profile->types[type];
+    by_type.seconds += seconds_since( start );
+    by_type.objects++;
+    profile->mods[src].objects++;
+}
+
+void DynamicDataLoader::enable_load_profile( const std::string &report_path )
+{
+    profile = std::make_unique<load_profile>();
+    profile->report_path = report_path;
+}
+
+void DynamicDataLoader::run_stage( const std::string &phase, const std::string &name,
+                                   const std::function<void()> &stage )
+{
+    if( !profile ) {
+        stage();
+        return;
+    }
+    const int64_t heap_before = heap_in_use();
+    const auto start = std::chrono::steady_clock::now();
+    stage();
+    load_profile::stage result;
+    result.phase = phase;
+    result.name = name;
+    result.seconds = seconds_since( start );
+    result.heap_growth = heap_in_use() - heap_before;
+    profile->stages.push_back( result );
 }
 
 struct DynamicDataLoader::cached_streams {
@@ -445,6 +555,42 @@ void DynamicDataLoader::initialize()
 #endif
 }
 
+namespace
+{
+struct data_dir_listing {
+    std::vector<std::string> files;
+    /** Every directory of the tree with its modification time. Adding, removing or
+     * renaming a file changes the time of the directory that holds it. */
+    std::vector<std::pair<std::string, int64_t>> directories;
+};
+} // namespace
+
+// Core data is loaded again for every world, and once per mod by --check-mods.
+static std::map<std::string, data_dir_listing> data_dir_listings;
+
+/** The json files below @p path, only walking the tree again if a directory changed. */
+static const std::vector<std::string> &find_data_files( const std::string &path )
+{
+    data_dir_listing &listing = data_dir_listings[path];
+    const bool unchanged = !listing.directories.empty() &&
+                           std::all_of( listing.directories.begin(), listing.directories.end(),
+    []( const std::pair<std::string, int64_t> & dir ) {
+        return get_modification_time( dir.first ) == dir.second;
+    } );
+    if( unchanged ) {
+        return listing.files;
+    }
+    // Times are taken first, so a change made during the walk is noticed next time.
+    listing.directories.clear();
+    listing.directories.emplace_back( path, get_modification_time( path ) );
+    for( std::string &dir : get_subdirectories( path, true ) ) {
+        const int64_t time = get_modification_time( dir );
+        listing.directories.emplace_back( std::move( dir ), time );
+    }
+    listing.files = get_files_from_path( ".json", path, true, true );
+    return listing.files;
+}
+
 void DynamicDataLoader::load_data_from_path( const std::string &path, const std::string &src,
         loading_ui &ui )
 {
@@ -454,9 +600,10 @@ void DynamicDataLoader::load_data_from_path( const std::string &path, const std:
     // E.g. the core might provide a vpart "frame-x"
     // the first loaded mode might provide a vehicle that uses that frame
     // But not the other way round.
+    const auto start = std::chrono::steady_clock::now();
 
     // get a list of all files in the directory
-    str_vec files = get_files_from_path( ".json", path, true, true );
+    str_vec files = find_data_files( path );
     if( files.empty() ) {
         std::ifstream tmp( path.c_str(), std::ios::in );
         if( tmp ) {
@@ -465,26 +612,36 @@ void DynamicDataLoader::load_data_from_path( const std::string &path, const std:
             files.push_back( path );
         }
     }
-    // iterate over each file
-    for( auto &files_i : files ) {
-        const std::string &file = files_i;
-        // open the file as a stream
-        cata_ifstream infile = std::move( cata_ifstream().mode( cata_ios_mode::binary ).open( file ) );
-        // and stuff it into ram
-        std::istringstream iss(
-            std::string(
-                ( std::istreambuf_iterator<char>( *infile ) ),
-                std::istreambuf_iterator<char>()
-            )
-        );
-        try {
-            // parse it
-            JsonIn jsin( iss, file );
-            load_all_from_json( jsin, src, ui, path, file );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( err.what() );
+    // Reading the files does not depend on anything else, so it's done in parallel, a batch
+    // at a time to bound the memory used. The loaders modify global state and have to run
+    // on this thread, in order.
+    static constexpr size_t batch_size = 64;
+    std::vector<std::string> contents;
+    for( size_t batch_begin = 0; batch_begin < files.size(); batch_begin += batch_size ) {
+        const size_t batch_end = std::min( files.size(), batch_begin + batch_size );
+        contents.assign( batch_end - batch_begin, std::string() );
+        cata::parallel_for( 0, batch_end - batch_begin, [&]( const int i ) {
+            contents[i] = read_entire_file( files[batch_begin + i] );
+        } );
+        for( size_t i = batch_begin; i < batch_end; ++i ) {
+            const std::string &file = files[i];
+            cata::hash_combine( data_fingerprint, src );
+            cata::hash_combine( data_fingerprint, file );
+            cata::hash_combine( data_fingerprint, contents[i - batch_begin] );
+            std::istringstream iss( contents[i - batch_begin] );
+            contents[i - batch_begin].clear();
+            try {
+                // parse it
+                JsonIn jsin( iss, file );
+                load_all_from_json( jsin, src, ui, path, file );
+            } catch( const JsonError &err ) {
+                throw std::runtime_error( err.what() );
+            }
         }
     }
+    if( profile ) {
+        profile->mods[src].seconds += seconds_since( start );
+    }
 }
 
 void DynamicDataLoader::load_all_from_json( JsonIn &jsin, const std::string &src, loading_ui &,
@@ -518,6 +675,10 @@ void DynamicDataLoader::load_all_from_json( JsonIn &jsin, const std::string &src
 void DynamicDataLoader::unload_data()
 {
     finalized = false;
+    data_fingerprint = 0;
+    if( profile ) {
+        profile->clear();
+    }
 
     achievement::reset();
     activity_type::reset();
@@ -698,12 +859,26 @@ void DynamicDataLoader::finalize_loaded_data( loading_ui &ui )
 
     ui.show();
     for( const named_entry &e : entries ) {
-        e.second();
+        run_stage( "finalize", e.first, e.second );
         ui.proceed();
     }
 
     check_consistency( ui );
     finalized = true;
+
+    release_loading_memory();
+    if( profile ) {
+        profile->write();
+    }
+}
+
+void DynamicDataLoader::release_loading_memory()
+{
+#if defined(__GLIBC__)
+    // Loading leaves lots of freed parse buffers behind. glibc keeps those pages mapped
+    // unless told otherwise, which matters when many game processes share a host.
+    malloc_trim( 0 );
+#endif
 }
 
 void DynamicDataLoader::check_consistency( loading_ui &ui )
@@ -713,36 +888,16 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
     using named_entry = std::pair<std::string, std::function<void()>>;
     const std::vector<named_entry> entries = {{
             { _( "Flags" ), &json_flag::check_consistency },
-            {
-                _( "Crafting requirements" ), []()
-                {
-                    requirement_data::check_consistency();
-                }
-            },
             { _( "Vitamins" ), &vitamin::check_consistency },
             { _( "Field types" ), &field_types::check_consistency },
             { _( "Ammo effects" ), &ammo_effects::check_consistency },
             { _( "Emissions" ), &emit::check_consistency },
             { _( "Activities" ), &activity_type::check_consistency },
-            {
-                _( "Items" ), []()
-                {
-                    item_controller->check_definitions();
-                }
-            },
             { _( "Materials" ), &materials::check },
             { _( "Engine faults" ), &fault::check_consistency },
             { _( "Vehicle parts" ), &vpart_info::check },
-            { _( "Mapgen definitions" ), &check_mapgen_definitions },
             { _( "Mapgen palettes" ), &mapgen_palette::check_definitions },
-            {
-                _( "Monster types" ), []()
-                {
-                    MonsterGenerator::generator().check_monster_definitions();
-                }
-            },
             { _( "Monster groups" ), &MonsterGroupManager::check_group_definitions },
-            { _( "Furniture and terrain" ), &check_furniture_and_terrain },
             { _( "Constructions" ), &check_constructions },
             { _( "Professions" ), &profession::check_definitions },
             { _( "Scenarios" ), &scenario::check_definitions },
@@ -763,12 +918,6 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
             { _( "NPC classes" ), &npc_class::check_consistency },
             { _( "Behaviors" ), &behavior::check_consistency },
             { _( "Mission types" ), &mission_type::check_consistency },
-            {
-                _( "Item actions" ), []()
-                {
-                    item_action_generator::generator().check_consistency();
-                }
-            },
             { _( "Harvest lists" ), &harvest_list::check_consistency },
             { _( "NPC templates" ), &npc_template::check_consistency },
             { _( "Body parts" ), &body_part_type::check_consistency },
@@ -782,16 +931,100 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
             { _( "Achievements" ), &achievement::check_consistency },
             { _( "Disease types" ), &disease_type::check_disease_consistency },
             { _( "Factions" ), &faction_template::check_consistency },
+            { _( "ASCII art" ), &ascii_art::check_consistency },
         }
     };
 
+    // These only read the loaded data, so they can be skipped when the very same data
+    // has already passed them, see SKIP_VERIFIED_DATA_CHECKS.
+    // The other checks also fix up some of the data and have to run every time.
+    const std::vector<named_entry> read_only_entries = {{
+            {
+                _( "Crafting requirements" ), []()
+                {
+                    requirement_data::check_consistency();
+                }
+            },
+            {
+                _( "Items" ), []()
+                {
+                    item_controller->check_definitions();
+                }
+            },
+            { _( "Mapgen definitions" ), &check_mapgen_definitions },
+            {
+                _( "Monster types" ), []()
+                {
+                    MonsterGenerator::generator().check_monster_definitions();
+                }
+            },
+            { _( "Furniture and terrain" ), &check_furniture_and_terrain },
+            {
+                _( "Item actions" ), []()
+                {
+                    item_action_generator::generator().check_consistency();
+                }
+            },
+        }
+    };
+
+    std::string fingerprint;
+    bool skip_read_only = false;
+    if( get_option<bool>( "SKIP_VERIFIED_DATA_CHECKS" ) ) {
+        size_t hash = data_fingerprint;
+        cata::hash_combine( hash, std::string( getVersionString() ) );
+        fingerprint = std::to_string( hash );
+        skip_read_only = fingerprint == last_verified_fingerprint();
+    }
+
     for( const named_entry &e : entries ) {
         ui.add_entry( e.first );
     }
+    if( !skip_read_only ) {
+        for( const named_entry &e : read_only_entries ) {
+            ui.add_entry( e.first );
+        }
+    }
 
     ui.show();
     for( const named_entry &e : entries ) {
-        e.second();
+        run_stage( "check", e.first, e.second );
         ui.proceed();
     }
+    if( skip_read_only ) {
+        return;
+    }
+    for( const named_entry &e : read_only_entries ) {
+        run_stage( "check", e.first, e.second );
+        ui.proceed();
+    }
+    // Any error (even an unrelated earlier one) means the data has to be checked again next time.
+    if( !fingerprint.empty() && !debug_has_error_been_observed() ) {
+        store_verified_fingerprint( fingerprint );
+    }
+}
+
+static std::string verified_data_path()
+{
+    return PATH_INFO::config_dir() + "verified_data.json";
+}
+
+std::string DynamicDataLoader::last_verified_fingerprint() const
+{
+    std::string result;
+    read_from_file_optional_json( verified_data_path(), [&]( JsonIn & jsin ) {
+        JsonObject jo = jsin.get_object();
+        result = jo.get_string( "fingerprint", "" );
+    } );
+    return result;
+}
+
+void DynamicDataLoader::store_verified_fingerprint( const std::string &fingerprint ) const
+{
+    write_to_file( verified_data_path(), [&]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_object();
+        jsout.member( "fingerprint", fingerprint );
+        jsout.end_object();
+    }, nullptr );
 }
@@ -68,10 +68,19 @@ class DynamicDataLoader
 
     private:
         bool finalized = false;
+        /**
+         * Hash over the mod ids, paths and contents of all files loaded by
+         * @ref load_data_from_path, used to detect when data has already been verified.
+         */
+        size_t data_fingerprint = 0;
 
         struct cached_streams;
         std::unique_ptr<cached_streams> stream_cache;
 
+        struct load_profile;
+        /** Only set if enabled by @ref enable_load_profile. */
+        std::unique_ptr<load_profile> profile;
+
     protected:
         /**
          * Maps the type string (coming from json) to the
@@ -117,6 +126,14 @@ class DynamicDataLoader
          * @param ui Finalization status display.
          */
         void check_consistency( loading_ui &ui );
+        /** The fingerprint of the data and game version that passed @ref check_consistency last time. */
+        std::string last_verified_fingerprint() const;
+        void store_verified_fingerprint( const std::string &fingerprint ) const;
+        /** Returns memory that was only needed while loading to the operating system. */
+        static void release_loading_memory();
+        /** Runs one stage of finalization or checking, records it in the profile if enabled. */
+        void run_stage( const std::string &phase, const std::string &name,
+                        const std::function<void()> &stage );
 
     public:
         /**
@@ -161,6 +178,13 @@ class DynamicDataLoader
          */
         void load_deferred( deferred_json &data );
 
+        /**
+         * Record how long loading each mod and each JSON type as well as each finalization
+         * stage takes. The report is written as JSON to `report_path` at the end of every
+         * @ref finalize_loaded_data, it covers everything since the last @ref unload_data.
+         */
+        void enable_load_profile( const std::string &report_path );
+
         /**
          * Returns whether the data is finalized and ready to be utilized.
          */
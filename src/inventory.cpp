@@ -7,8 +7,10 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <utility>
 
 #include "avatar.h"
+#include "cata_utility.h"
 #include "debug.h"
 #include "distribution_grid.h"
 #include "game.h"
@@ -29,6 +31,7 @@
 #include "enums.h"
 #include "optional.h"
 #include "player.h"
+#include "profiler.h"
 #include "rng.h"
 #include "material.h"
 #include "type_id.h"
@@ -275,7 +278,26 @@ item &inventory::add_item( item newit, bool keep_invlet, bool assign_invlet, boo
 {
     binned = false;
 
-    if( should_stack ) {
+    if( should_stack && stacks_by_type != nullptr && !keep_invlet ) {
+        // Items only stack with items of the same type, so only those stacks need a look.
+        for( std::list<item> *elem : ( *stacks_by_type )[newit.typeId()] ) {
+            item &it_ref = elem->front();
+            if( it_ref.stacks_with( newit ) ) {
+                if( it_ref.merge_charges( newit ) ) {
+                    return it_ref;
+                }
+                if( it_ref.invlet == '\0' ) {
+                    update_invlet( newit, assign_invlet );
+                    update_cache_with_item( newit );
+                    it_ref.invlet = newit.invlet;
+                } else {
+                    newit.invlet = it_ref.invlet;
+                }
+                elem->push_back( std::move( newit ) );
+                return elem->back();
+            }
+        }
+    } else if( should_stack ) {
         // See if we can't stack this item.
         for( auto &elem : items ) {
             std::list<item>::iterator it_ref = elem.begin();
@@ -292,7 +314,7 @@ item &inventory::add_item( item newit, bool keep_invlet, bool assign_invlet, boo
                 } else {
                     newit.invlet = it_ref->invlet;
                 }
-                elem.push_back( newit );
+                elem.push_back( std::move( newit ) );
                 return elem.back();
             } else if( keep_invlet && assign_invlet && it_ref->invlet == newit.invlet ) {
                 // If keep_invlet is true, we'll be forcing other items out of their current invlet.
@@ -307,20 +329,23 @@ item &inventory::add_item( item newit, bool keep_invlet, bool assign_invlet, boo
     }
     update_cache_with_item( newit );
 
-    std::list<item> newstack;
-    newstack.push_back( newit );
-    items.push_back( newstack );
+    // Build the new stack in place, every copy of an item also copies all of its contents.
+    items.emplace_back();
+    items.back().push_back( std::move( newit ) );
+    if( stacks_by_type != nullptr ) {
+        ( *stacks_by_type )[items.back().back().typeId()].push_back( &items.back() );
+    }
     return items.back().back();
 }
 
 void inventory::add_item_keep_invlet( item newit )
 {
-    add_item( newit, true );
+    add_item( std::move( newit ), true );
 }
 
 void inventory::push_back( item newit )
 {
-    add_item( newit );
+    add_item( std::move( newit ) );
 }
 
 #if defined(__ANDROID__)
@@ -439,8 +464,14 @@ void inventory::form_from_map( map &m, const tripoint &origin, int range, const
 void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Character *pl,
                                bool assign_invlet )
 {
+    profiler::scoped_zone zone( "inventory::form_from_map" );
     const time_point bday = calendar::start_of_cataclysm;
     items.clear();
+    std::unordered_map<itype_id, std::vector<std::list<item> *>> index;
+    stacks_by_type = &index;
+    on_out_of_scope reset_index( [this]() {
+        stacks_by_type = nullptr;
+    } );
     for( const tripoint &p : pts ) {
         if( m.has_furn( p ) ) {
             const furn_t &f = m.furn( p ).obj();
@@ -236,6 +236,13 @@ class inventory : public visitable<inventory>
 
         invstack items;
 
+        /**
+         * Stacks grouped by item type, in the order they appear in @ref items.
+         * Only set while @ref form_from_map fills a fresh inventory, so that adding
+         * thousands of map items doesn't compare each of them against every stack.
+         */
+        std::unordered_map<itype_id, std::vector<std::list<item> *>> *stacks_by_type = nullptr;
+
         mutable bool binned = false;
         /**
          * Items binned by their type.
@@ -5,6 +5,7 @@
 #include <cassert>
 #include <cctype>
 #include <cmath>
+#include <cstdio>
 #include <cstdlib>
 #include <iomanip>
 #include <iterator>
@@ -22,6 +23,7 @@
 #include "avatar.h"
 #include "bionics.h"
 #include "bodypart.h"
+#include "cached_options.h"
 #include "cata_utility.h"
 #include "catacharset.h"
 #include "character.h"
@@ -136,110 +138,110 @@ static const trait_id trait_SQUEAMISH( "SQUEAMISH" );
 static const trait_id trait_TOLERANCE( "TOLERANCE" );
 static const trait_id trait_WOOLALLERGY( "WOOLALLERGY" );
 
-static const std::string flag_ALWAYS_TWOHAND( "ALWAYS_TWOHAND" );
-static const std::string flag_AURA( "AURA" );
-static const std::string flag_BELTED( "BELTED" );
-static const std::string flag_BIPOD( "BIPOD" );
-static const std::string flag_BYPRODUCT( "BYPRODUCT" );
-static const std::string flag_CABLE_SPOOL( "CABLE_SPOOL" );
-static const std::string flag_CANNIBALISM( "CANNIBALISM" );
-static const std::string flag_CHARGEDIM( "CHARGEDIM" );
-static const std::string flag_COLLAPSIBLE_STOCK( "COLLAPSIBLE_STOCK" );
-static const std::string flag_CONDUCTIVE( "CONDUCTIVE" );
-static const std::string flag_CONSUMABLE( "CONSUMABLE" );
-static const std::string flag_CORPSE( "CORPSE" );
-static const std::string flag_DANGEROUS( "DANGEROUS" );
+static const flag_str_id flag_ALWAYS_TWOHAND( "ALWAYS_TWOHAND" );
+static const flag_str_id flag_AURA( "AURA" );
+static const flag_str_id flag_BELTED( "BELTED" );
+static const flag_str_id flag_BIPOD( "BIPOD" );
+static const flag_str_id flag_BYPRODUCT( "BYPRODUCT" );
+static const flag_str_id flag_CABLE_SPOOL( "CABLE_SPOOL" );
+static const flag_str_id flag_CANNIBALISM( "CANNIBALISM" );
+static const flag_str_id flag_CHARGEDIM( "CHARGEDIM" );
+static const flag_str_id flag_COLLAPSIBLE_STOCK( "COLLAPSIBLE_STOCK" );
+static const flag_str_id flag_CONDUCTIVE( "CONDUCTIVE" );
+static const flag_str_id flag_CONSUMABLE( "CONSUMABLE" );
+static const flag_str_id flag_CORPSE( "CORPSE" );
+static const flag_str_id flag_DANGEROUS( "DANGEROUS" );
 static const std::string flag_DEEP_WATER( "DEEP_WATER" );
-static const std::string flag_DIAMOND( "DIAMOND" );
-static const std::string flag_DISABLE_SIGHTS( "DISABLE_SIGHTS" );
-static const std::string flag_ETHEREAL_ITEM( "ETHEREAL_ITEM" );
-static const std::string flag_FAKE_MILL( "FAKE_MILL" );
-static const std::string flag_FAKE_SMOKE( "FAKE_SMOKE" );
-static const std::string flag_FIELD_DRESS( "FIELD_DRESS" );
-static const std::string flag_FIELD_DRESS_FAILED( "FIELD_DRESS_FAILED" );
-static const std::string flag_FILTHY( "FILTHY" );
-static const std::string flag_FIRE_100( "FIRE_100" );
-static const std::string flag_FIRE_20( "FIRE_20" );
-static const std::string flag_FIRE_50( "FIRE_50" );
-static const std::string flag_FIRE_TWOHAND( "FIRE_TWOHAND" );
-static const std::string flag_FIT( "FIT" );
+static const flag_str_id flag_DIAMOND( "DIAMOND" );
+static const flag_str_id flag_DISABLE_SIGHTS( "DISABLE_SIGHTS" );
+static const flag_str_id flag_ETHEREAL_ITEM( "ETHEREAL_ITEM" );
+static const flag_str_id flag_FAKE_MILL( "FAKE_MILL" );
+static const flag_str_id flag_FAKE_SMOKE( "FAKE_SMOKE" );
+static const flag_str_id flag_FIELD_DRESS( "FIELD_DRESS" );
+static const flag_str_id flag_FIELD_DRESS_FAILED( "FIELD_DRESS_FAILED" );
+static const flag_str_id flag_FILTHY( "FILTHY" );
+static const flag_str_id flag_FIRE_100( "FIRE_100" );
+static const flag_str_id flag_FIRE_20( "FIRE_20" );
+static const flag_str_id flag_FIRE_50( "FIRE_50" );
+static const flag_str_id flag_FIRE_TWOHAND( "FIRE_TWOHAND" );
+static const flag_str_id flag_FIT( "FIT" );
 static const std::string flag_FLAMMABLE( "FLAMMABLE" );
 static const std::string flag_FLAMMABLE_ASH( "FLAMMABLE_ASH" );
-static const std::string flag_GIBBED( "GIBBED" );
-static const std::string flag_HEATS_FOOD( "HEATS_FOOD" );
-static const std::string flag_HELMET_COMPAT( "HELMET_COMPAT" );
-static const std::string flag_HIDDEN_HALLU( "HIDDEN_HALLU" );
-static const std::string flag_HIDDEN_POISON( "HIDDEN_POISON" );
-static const std::string flag_IRREMOVABLE( "IRREMOVABLE" );
-static const std::string flag_IS_ARMOR( "IS_ARMOR" );
-static const std::string flag_IS_PET_ARMOR( "IS_PET_ARMOR" );
-static const std::string flag_IS_UPS( "IS_UPS" );
-static const std::string flag_LEAK_ALWAYS( "LEAK_ALWAYS" );
-static const std::string flag_LEAK_DAM( "LEAK_DAM" );
+static const flag_str_id flag_GIBBED( "GIBBED" );
+static const flag_str_id flag_HEATS_FOOD( "HEATS_FOOD" );
+static const flag_str_id flag_HELMET_COMPAT( "HELMET_COMPAT" );
+static const flag_str_id flag_HIDDEN_HALLU( "HIDDEN_HALLU" );
+static const flag_str_id flag_HIDDEN_POISON( "HIDDEN_POISON" );
+static const flag_str_id flag_IRREMOVABLE( "IRREMOVABLE" );
+static const flag_str_id flag_IS_ARMOR( "IS_ARMOR" );
+static const flag_str_id flag_IS_PET_ARMOR( "IS_PET_ARMOR" );
+static const flag_str_id flag_IS_UPS( "IS_UPS" );
+static const flag_str_id flag_LEAK_ALWAYS( "LEAK_ALWAYS" );
+static const flag_str_id flag_LEAK_DAM( "LEAK_DAM" );
 static const std::string flag_LIQUID( "LIQUID" );
 static const std::string flag_LIQUIDCONT( "LIQUIDCONT" );
-static const std::string flag_LITCIG( "LITCIG" );
-static const std::string flag_MAG_BELT( "MAG_BELT" );
-static const std::string flag_MAG_DESTROY( "MAG_DESTROY" );
-static const std::string flag_MAG_EJECT( "MAG_EJECT" );
-static const std::string flag_NANOFAB_TEMPLATE( "NANOFAB_TEMPLATE" );
-static const std::string flag_NEEDS_UNFOLD( "NEEDS_UNFOLD" );
-static const std::string flag_NEVER_JAMS( "NEVER_JAMS" );
-static const std::string flag_NONCONDUCTIVE( "NONCONDUCTIVE" );
+static const flag_str_id flag_LITCIG( "LITCIG" );
+static const flag_str_id flag_MAG_BELT( "MAG_BELT" );
+static const flag_str_id flag_MAG_DESTROY( "MAG_DESTROY" );
+static const flag_str_id flag_MAG_EJECT( "MAG_EJECT" );
+static const flag_str_id flag_NANOFAB_TEMPLATE( "NANOFAB_TEMPLATE" );
+static const flag_str_id flag_NEEDS_UNFOLD( "NEEDS_UNFOLD" );
+static const flag_str_id flag_NEVER_JAMS( "NEVER_JAMS" );
+static const flag_str_id flag_NONCONDUCTIVE( "NONCONDUCTIVE" );
 static const std::string flag_NO_DISPLAY( "NO_DISPLAY" );
-static const std::string flag_NO_DROP( "NO_DROP" );
-static const std::string flag_NO_PACKED( "NO_PACKED" );
-static const std::string flag_NO_PARASITES( "NO_PARASITES" );
-static const std::string flag_NO_RELOAD( "NO_RELOAD" );
-static const std::string flag_NO_REPAIR( "NO_REPAIR" );
-static const std::string flag_NO_SALVAGE( "NO_SALVAGE" );
-static const std::string flag_NO_STERILE( "NO_STERILE" );
-static const std::string flag_NO_UNLOAD( "NO_UNLOAD" );
-static const std::string flag_OUTER( "OUTER" );
-static const std::string flag_OVERSIZE( "OVERSIZE" );
-static const std::string flag_PERSONAL( "PERSONAL" );
-static const std::string flag_PROCESSING( "PROCESSING" );
-static const std::string flag_PROCESSING_RESULT( "PROCESSING_RESULT" );
-static const std::string flag_PULPED( "PULPED" );
-static const std::string flag_PUMP_ACTION( "PUMP_ACTION" );
-static const std::string flag_PUMP_RAIL_COMPATIBLE( "PUMP_RAIL_COMPATIBLE" );
-static const std::string flag_QUARTERED( "QUARTERED" );
-static const std::string flag_RADIOACTIVE( "RADIOACTIVE" );
-static const std::string flag_RADIOSIGNAL_1( "RADIOSIGNAL_1" );
-static const std::string flag_RADIOSIGNAL_2( "RADIOSIGNAL_2" );
-static const std::string flag_RADIOSIGNAL_3( "RADIOSIGNAL_3" );
-static const std::string flag_RADIO_ACTIVATION( "RADIO_ACTIVATION" );
-static const std::string flag_RADIO_INVOKE_PROC( "RADIO_INVOKE_PROC" );
-static const std::string flag_RADIO_MOD( "RADIO_MOD" );
-static const std::string flag_RAIN_PROTECT( "RAIN_PROTECT" );
-static const std::string flag_REACH3( "REACH3" );
-static const std::string flag_REACH_ATTACK( "REACH_ATTACK" );
-static const std::string flag_RECHARGE( "RECHARGE" );
-static const std::string flag_REDUCED_BASHING( "REDUCED_BASHING" );
-static const std::string flag_REDUCED_WEIGHT( "REDUCED_WEIGHT" );
-static const std::string flag_RELOAD_AND_SHOOT( "RELOAD_AND_SHOOT" );
-static const std::string flag_RELOAD_EJECT( "RELOAD_EJECT" );
-static const std::string flag_RELOAD_ONE( "RELOAD_ONE" );
-static const std::string flag_REVIVE_SPECIAL( "REVIVE_SPECIAL" );
+static const flag_str_id flag_NO_DROP( "NO_DROP" );
+static const flag_str_id flag_NO_PACKED( "NO_PACKED" );
+static const flag_str_id flag_NO_PARASITES( "NO_PARASITES" );
+static const flag_str_id flag_NO_RELOAD( "NO_RELOAD" );
+static const flag_str_id flag_NO_REPAIR( "NO_REPAIR" );
+static const flag_str_id flag_NO_SALVAGE( "NO_SALVAGE" );
+static const flag_str_id flag_NO_STERILE( "NO_STERILE" );
+static const flag_str_id flag_NO_UNLOAD( "NO_UNLOAD" );
+static const flag_str_id flag_OUTER( "OUTER" );
+static const flag_str_id flag_OVERSIZE( "OVERSIZE" );
+static const flag_str_id flag_PERSONAL( "PERSONAL" );
+static const flag_str_id flag_PROCESSING( "PROCESSING" );
+static const flag_str_id flag_PROCESSING_RESULT( "PROCESSING_RESULT" );
+static const flag_str_id flag_PULPED( "PULPED" );
+static const flag_str_id flag_PUMP_ACTION( "PUMP_ACTION" );
+static const flag_str_id flag_PUMP_RAIL_COMPATIBLE( "PUMP_RAIL_COMPATIBLE" );
+static const flag_str_id flag_QUARTERED( "QUARTERED" );
+static const flag_str_id flag_RADIOACTIVE( "RADIOACTIVE" );
+static const flag_str_id flag_RADIOSIGNAL_1( "RADIOSIGNAL_1" );
+static const flag_str_id flag_RADIOSIGNAL_2( "RADIOSIGNAL_2" );
+static const flag_str_id flag_RADIOSIGNAL_3( "RADIOSIGNAL_3" );
+static const flag_str_id flag_RADIO_ACTIVATION( "RADIO_ACTIVATION" );
+static const flag_str_id flag_RADIO_INVOKE_PROC( "RADIO_INVOKE_PROC" );
+static const flag_str_id flag_RADIO_MOD( "RADIO_MOD" );
+static const flag_str_id flag_RAIN_PROTECT( "RAIN_PROTECT" );
+static const flag_str_id flag_REACH3( "REACH3" );
+static const flag_str_id flag_REACH_ATTACK( "REACH_ATTACK" );
+static const flag_str_id flag_RECHARGE( "RECHARGE" );
+static const flag_str_id flag_REDUCED_BASHING( "REDUCED_BASHING" );
+static const flag_str_id flag_REDUCED_WEIGHT( "REDUCED_WEIGHT" );
+static const flag_str_id flag_RELOAD_AND_SHOOT( "RELOAD_AND_SHOOT" );
+static const flag_str_id flag_RELOAD_EJECT( "RELOAD_EJECT" );
+static const flag_str_id flag_RELOAD_ONE( "RELOAD_ONE" );
+static const flag_str_id flag_REVIVE_SPECIAL( "REVIVE_SPECIAL" );
 static const std::string flag_SILENT( "SILENT" );
-static const std::string flag_SKINNED( "SKINNED" );
-static const std::string flag_SKINTIGHT( "SKINTIGHT" );
-static const std::string flag_SLOW_WIELD( "SLOW_WIELD" );
-static const std::string flag_SPEEDLOADER( "SPEEDLOADER" );
-static const std::string flag_SPLINT( "SPLINT" );
-static const std::string flag_STR_DRAW( "STR_DRAW" );
-static const std::string flag_TOBACCO( "TOBACCO" );
-static const std::string flag_UNARMED_WEAPON( "UNARMED_WEAPON" );
-static const std::string flag_UNDERSIZE( "UNDERSIZE" );
-static const std::string flag_USES_BIONIC_POWER( "USES_BIONIC_POWER" );
-static const std::string flag_USE_UPS( "USE_UPS" );
-static const std::string flag_VARSIZE( "VARSIZE" );
-static const std::string flag_VEHICLE( "VEHICLE" );
-static const std::string flag_WAIST( "WAIST" );
-static const std::string flag_WATERPROOF_GUN( "WATERPROOF_GUN" );
-static const std::string flag_WATER_EXTINGUISH( "WATER_EXTINGUISH" );
-static const std::string flag_WET( "WET" );
-static const std::string flag_WIND_EXTINGUISH( "WIND_EXTINGUISH" );
+static const flag_str_id flag_SKINNED( "SKINNED" );
+static const flag_str_id flag_SKINTIGHT( "SKINTIGHT" );
+static const flag_str_id flag_SLOW_WIELD( "SLOW_WIELD" );
+static const flag_str_id flag_SPEEDLOADER( "SPEEDLOADER" );
+static const flag_str_id flag_SPLINT( "SPLINT" );
+static const flag_str_id flag_STR_DRAW( "STR_DRAW" );
+static const flag_str_id flag_TOBACCO( "TOBACCO" );
+static const flag_str_id flag_UNARMED_WEAPON( "UNARMED_WEAPON" );
+static const flag_str_id flag_UNDERSIZE( "UNDERSIZE" );
+static const flag_str_id flag_USES_BIONIC_POWER( "USES_BIONIC_POWER" );
+static const flag_str_id flag_USE_UPS( "USE_UPS" );
+static const flag_str_id flag_VARSIZE( "VARSIZE" );
+static const flag_str_id flag_VEHICLE( "VEHICLE" );
+static const flag_str_id flag_WAIST( "WAIST" );
+static const flag_str_id flag_WATERPROOF_GUN( "WATERPROOF_GUN" );
+static const flag_str_id flag_WATER_EXTINGUISH( "WATER_EXTINGUISH" );
+static const flag_str_id flag_WET( "WET" );
+static const flag_str_id flag_WIND_EXTINGUISH( "WIND_EXTINGUISH" );
 
 static const matec_id rapid_strike( "RAPID" );
 
@@ -948,29 +950,21 @@ void item::put_in( const item &payload )
     contents.insert_item( payload );
 }
 
+// std::to_string never groups digits, so unlike a stream it needs no locale for integers.
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 void item::set_var( const std::string &name, const double value )
@@ -998,10 +992,11 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
     if( it == item_vars.end() ) {
         return default_value;
     }
-    std::vector<std::string> values = string_split( it->second, ',' );
-    return tripoint( atoi( values[0].c_str() ),
-                     atoi( values[1].c_str() ),
-                     atoi( values[2].c_str() ) );
+    tripoint ret;
+    if( std::sscanf( it->second.c_str(), "%d,%d,%d", &ret.x, &ret.y, &ret.z ) != 3 ) {
+        return default_value;
+    }
+    return ret;
 }
 
 void item::set_var( const std::string &name, const std::string &value )
@@ -4034,9 +4029,9 @@ void item::on_wear( Character &p )
         if( has_flag( flag_SPLINT ) ) {
             set_side( side::LEFT );
             if( ( covers( bodypart_id( "leg_l" ) ) && p.is_limb_broken( bodypart_id( "leg_r" ) ) &&
-                  !p.worn_with_flag( flag_SPLINT, bodypart_id( "leg_r" ) ) ) ||
+                  !p.worn_with_flag( flag_SPLINT.str(), bodypart_id( "leg_r" ) ) ) ||
                 ( covers( bodypart_id( "arm_l" ) ) && p.is_limb_broken( bodypart_id( "arm_r" ) ) &&
-                  !p.worn_with_flag( flag_SPLINT, bodypart_id( "arm_r" ) ) ) ) {
+                  !p.worn_with_flag( flag_SPLINT.str(), bodypart_id( "arm_r" ) ) ) ) {
                 set_side( side::RIGHT );
             }
         } else {
@@ -4249,10 +4244,10 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     // for portions of string that have <color_ etc in them, this aims to truncate the whole string correctly
     unsigned int truncate_override = 0;
 
-    if( ( damage() != 0 || ( get_option<bool>( "ITEM_HEALTH_BAR" ) && is_armor() ) ) && !is_null() &&
+    if( ( damage() != 0 || ( item_health_bar && is_armor() ) ) && !is_null() &&
         with_prefix ) {
         damtext = durability_indicator();
-        if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+        if( item_health_bar ) {
             // get the utf8 width of the tags
             truncate_override = utf8_width( damtext, false ) - utf8_width( damtext, true );
         }
@@ -4518,7 +4513,7 @@ std::string item::display_name( unsigned int quantity ) const
     }
 
     std::string ammotext;
-    if( ( ( is_gun() && ammo_required() ) || is_magazine() ) && get_option<bool>( "AMMO_IN_NAMES" ) ) {
+    if( ( ( is_gun() && ammo_required() ) || is_magazine() ) && ammo_in_names ) {
         if( ammo_current() != "null" ) {
             ammotext = find_type( ammo_current() )->ammo->type->name();
         } else {
@@ -4635,9 +4630,12 @@ units::mass item::weight( bool include_contents, bool integral ) const
         ret *= 0.75;
     }
 
+    // only guns have gunmods installed, collect them once for the adjustments below
+    std::vector<const item *> mods;
     // if this is a gun apply all of its gunmods' weight multipliers
     if( type->gun ) {
-        for( const item *mod : gunmods() ) {
+        mods = gunmods();
+        for( const item *mod : mods ) {
             ret *= mod->type->gunmod->weight_multiplier;
         }
     }
@@ -4678,7 +4676,10 @@ units::mass item::weight( bool include_contents, bool integral ) const
     }
 
     // reduce weight for sawn-off weapons capped to the apportioned weight of the barrel
-    if( gunmod_find( "barrel_small" ) ) {
+    const bool sawn_off = std::any_of( mods.begin(), mods.end(), []( const item * mod ) {
+        return mod->typeId() == "barrel_small";
+    } );
+    if( sawn_off ) {
         const units::volume b = type->gun->barrel_length;
         const units::mass max_barrel_weight = units::from_gram( to_milliliter( b ) );
         const units::mass barrel_weight = units::from_gram( b.value() * type->weight.value() /
@@ -4687,7 +4688,7 @@ units::mass item::weight( bool include_contents, bool integral ) const
     }
 
     if( is_gun() ) {
-        for( const item *elem : gunmods() ) {
+        for( const item *elem : mods ) {
             ret += elem->weight( true, true );
         }
     } else if( include_contents ) {
@@ -4975,6 +4976,24 @@ bool item::has_flag( const std::string &f ) const
     return ret;
 }
 
+bool item::has_flag( const flag_str_id &f ) const
+{
+    if( !f.is_valid() ) {
+        return has_flag( f.str() );
+    }
+
+    if( f->inherit() ) {
+        for( const item *e : is_gun() ? gunmods() : toolmods() ) {
+            // gunmods fired separately do not contribute to base gun flags
+            if( !e->is_gun() && e->has_flag( f ) ) {
+                return true;
+            }
+        }
+    }
+
+    return type->has_flag( f ) || has_own_flag( f.str() );
+}
+
 item &item::set_flag( const std::string &flag )
 {
     item_tags.insert( flag );
@@ -5890,7 +5909,7 @@ std::string item::durability_indicator( bool include_intact ) const
     std::string outputstring;
 
     if( damage() < 0 )  {
-        if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+        if( item_health_bar ) {
             outputstring = colorize( damage_symbol() + "\u00A0", damage_color() );
         } else if( is_gun() ) {
             outputstring = pgettext( "damage adjective", "accurized " );
@@ -5914,7 +5933,7 @@ std::string item::durability_indicator( bool include_intact ) const
                     break;
             }
         }
-    } else if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+    } else if( item_health_bar ) {
         outputstring = colorize( damage_symbol() + "\u00A0", damage_color() );
     } else {
         outputstring = string_format( "%s ", get_base_material().dmg_adj( damage_level( 4 ) ) );
@@ -8449,9 +8468,15 @@ bool item::needs_processing() const
 
 int item::processing_speed() const
 {
-    if( is_corpse() || is_food() || is_food_container() ) {
+    // Corpses may revive, so they are checked more often than other perishables.
+    if( is_corpse() ) {
         return to_turns<int>( 10_minutes );
     }
+    // Rot is integrated over the time since last_rot_check (see process_rot), so
+    // food only needs to be visited occasionally to catch up and to drop rotten items.
+    if( is_food() || is_food_container() ) {
+        return to_turns<int>( 1_hours );
+    }
     // Unless otherwise indicated, update every turn.
     return 1;
 }
@@ -8470,7 +8495,7 @@ bool item::process_rot( float /*insulation*/, const bool seals,
     }
 
     // process rot at most once every 100_turns (10 min)
-    // note we're also gated by item::processing_speed
+    // note we're also gated by item::processing_speed, which visits food hourly
     time_duration smallest_interval = 10_minutes;
 
     int temp = g->weather.get_temperature( pos );
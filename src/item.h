@@ -1366,6 +1366,11 @@ class item : public visitable<item>
          */
         /*@{*/
         bool has_flag( const std::string &flag ) const;
+        /**
+         * Same as above, but faster: prefer static `flag_str_id` constants in frequently
+         * called code, their lookup is cached and the item type flags are a bitset.
+         */
+        bool has_flag( const flag_str_id &flag ) const;
 
         template<typename Container, typename T = std::decay_t<decltype( *std::declval<const Container &>().begin() )>>
         bool has_any_flag( const Container &flags ) const {
@@ -523,6 +523,15 @@ void Item_factory::finalize_post( itype &obj )
         }
     } );
 
+    obj.flag_bits.clear();
+    for( const std::string &f : obj.item_tags ) {
+        const size_t bit = flag_str_id( f ).id().to_i();
+        if( bit >= obj.flag_bits.size() ) {
+            obj.flag_bits.resize( bit + 1 );
+        }
+        obj.flag_bits[bit] = true;
+    }
+
     // handle complex firearms as a special case
     if( obj.gun && !obj.has_flag( "PRIMITIVE_RANGED_WEAPON" ) ) {
         std::copy( gun_tools.begin(), gun_tools.end(), std::inserter( obj.repair, obj.repair.begin() ) );
@@ -534,7 +543,7 @@ void Item_factory::finalize_post( itype &obj )
 
         // check if item can be repaired with any of the actions?
         for( const auto &act : repair_actions ) {
-            const use_function *func = m_templates[tool].get_use( act );
+            const use_function *func = find_static_template( tool )->get_use( act );
             if( func == nullptr ) {
                 continue;
             }
@@ -568,13 +577,13 @@ void Item_factory::finalize()
     // we can no longer add or adjust static item templates
     frozen = true;
 
-    for( auto &e : m_templates ) {
-        finalize_pre( e.second );
-        register_cached_uses( e.second );
+    for( itype &e : m_templates ) {
+        finalize_pre( e );
+        register_cached_uses( e );
     }
 
-    for( auto &e : m_templates ) {
-        finalize_post( e.second );
+    for( itype &e : m_templates ) {
+        finalize_post( e );
     }
 
     // We may actually have some runtimes here - ones loaded from saved game
@@ -591,9 +600,8 @@ void Item_factory::finalize()
             continue;
         }
         const itype_id &result = rec.result();
-        auto it = m_templates.find( result );
-        if( it != m_templates.end() ) {
-            it->second.recipes.push_back( p.first );
+        if( itype *it = find_static_template( result ) ) {
+            it->recipes.push_back( p.first );
         }
     }
 }
@@ -601,24 +609,23 @@ void Item_factory::finalize()
 void Item_factory::finalize_item_blacklist()
 {
     for( const std::string &blackout : item_blacklist ) {
-        std::unordered_map<itype_id, itype>::iterator candidate = m_templates.find( blackout );
-        if( candidate == m_templates.end() ) {
+        if( !find_static_template( blackout ) ) {
             debugmsg( "item on blacklist %s does not exist", blackout.c_str() );
             continue;
         }
 
         for( std::pair<const item_group_id, std::unique_ptr<Item_spawn_data>> &g : m_template_groups ) {
-            g.second->remove_item( candidate->first );
+            g.second->remove_item( blackout );
         }
 
         // remove any blacklisted items from requirements
         for( const std::pair<const requirement_id, requirement_data> &r : requirement_data::all() ) {
-            const_cast<requirement_data &>( r.second ).blacklist_item( candidate->first );
+            const_cast<requirement_data &>( r.second ).blacklist_item( blackout );
         }
 
         // remove any recipes used to craft the blacklisted item
-        recipe_dictionary::delete_if( [&candidate]( const recipe & r ) {
-            return r.result() == candidate->first;
+        recipe_dictionary::delete_if( [&blackout]( const recipe & r ) {
+            return r.result() == blackout;
         } );
     }
     for( vproto_id &vid : vehicle_prototype::get_all() ) {
@@ -631,7 +638,8 @@ void Item_factory::finalize_item_blacklist()
     }
 
     for( const std::pair<const itype_id, migration> &migrate : migrations ) {
-        if( m_templates.find( migrate.second.replace ) == m_templates.end() ) {
+        const itype *replacement = find_static_template( migrate.second.replace );
+        if( !replacement ) {
             debugmsg( "Replacement item for migration %s does not exist", migrate.first.c_str() );
             continue;
         }
@@ -655,12 +663,11 @@ void Item_factory::finalize_item_blacklist()
         // If the default ammo of an ammo_type gets migrated, we migrate all guns using that ammo
         // type to the ammo type of whatever that default ammo was migrated to.
         // To do that we need to store a map of ammo to the migration replacement thereof.
-        auto maybe_ammo = m_templates.find( migrate.first );
+        const itype *migrated = find_static_template( migrate.first );
         // If the itype_id is valid and the itype has ammo data
-        if( maybe_ammo != m_templates.end() && maybe_ammo->second.ammo ) {
-            auto replacement = m_templates.find( migrate.second.replace );
-            if( replacement->second.ammo ) {
-                migrated_ammo.emplace( std::make_pair( migrate.first, replacement->second.ammo->type ) );
+        if( migrated && migrated->ammo ) {
+            if( replacement->ammo ) {
+                migrated_ammo.emplace( std::make_pair( migrate.first, replacement->ammo->type ) );
             } else {
                 debugmsg( "Replacement item %s for migrated ammo %s is not ammo.", migrate.second.replace,
                           migrate.first );
@@ -668,10 +675,8 @@ void Item_factory::finalize_item_blacklist()
         }
 
         // migrate magazines as well
-        auto maybe_mag = m_templates.find( migrate.first );
-        if( maybe_mag != m_templates.end() && maybe_mag->second.magazine ) {
-            auto replacement = m_templates.find( migrate.second.replace );
-            if( replacement->second.magazine ) {
+        if( migrated && migrated->magazine ) {
+            if( replacement->magazine ) {
                 migrated_magazines.emplace( std::make_pair( migrate.first, migrate.second.replace ) );
             } else {
                 debugmsg( "Replacement item %s for migrated magazine %s is not a magazine.", migrate.second.replace,
@@ -1031,9 +1036,8 @@ bool Item_factory::check_ammo_type( std::string &msg, const ammotype &ammo ) con
         return false;
     }
 
-    if( std::none_of( m_templates.begin(),
-    m_templates.end(), [&ammo]( const decltype( m_templates )::value_type & e ) {
-    return e.second.ammo && e.second.ammo->type == ammo;
+    if( std::none_of( m_templates.begin(), m_templates.end(), [&ammo]( const itype & e ) {
+    return e.ammo && e.ammo->type == ammo;
 } ) ) {
         msg += string_format( "there is no actual ammo of type %s defined\n", ammo.c_str() );
         return false;
@@ -1043,9 +1047,9 @@ bool Item_factory::check_ammo_type( std::string &msg, const ammotype &ammo ) con
 
 void Item_factory::check_definitions() const
 {
-    for( const auto &elem : m_templates ) {
+    for( const itype &elem : m_templates ) {
         std::string msg;
-        const itype *type = &elem.second;
+        const itype *type = &elem;
 
         if( !type->category_force.is_valid() ) {
             msg += "undefined category " + type->category_force.str() + "\n";
@@ -1416,11 +1420,11 @@ void Item_factory::check_definitions() const
         debugmsg( "warnings for type %s:\n%s", type->id.c_str(), msg );
     }
     for( const auto &e : migrations ) {
-        if( !m_templates.count( e.second.replace ) ) {
+        if( !m_template_index.count( e.second.replace ) ) {
             debugmsg( "Invalid migration target: %s", e.second.replace.c_str() );
         }
         for( const auto &c : e.second.contents ) {
-            if( !m_templates.count( c ) ) {
+            if( !m_template_index.count( c ) ) {
                 debugmsg( "Invalid migration contents: %s", c.c_str() );
             }
         }
@@ -1430,14 +1434,25 @@ void Item_factory::check_definitions() const
     }
 }
 
+itype *Item_factory::find_static_template( const itype_id &id )
+{
+    const auto iter = m_template_index.find( id );
+    return iter == m_template_index.end() ? nullptr : &m_templates[iter->second];
+}
+
+const itype *Item_factory::find_static_template( const itype_id &id ) const
+{
+    const auto iter = m_template_index.find( id );
+    return iter == m_template_index.end() ? nullptr : &m_templates[iter->second];
+}
+
 //Returns the template with the given identification tag
 const itype *Item_factory::find_template( const itype_id &id ) const
 {
     assert( frozen );
 
-    auto found = m_templates.find( id );
-    if( found != m_templates.end() ) {
-        return &found->second;
+    if( const itype *found = find_static_template( id ) ) {
+        return found;
     }
 
     auto rt = m_runtimes.find( id );
@@ -1530,9 +1545,8 @@ bool Item_factory::load_definition( const JsonObject &jo, const std::string &src
         return true;
     }
 
-    auto base = m_templates.find( jo.get_string( "copy-from" ) );
-    if( base != m_templates.end() ) {
-        def = base->second;
+    if( const itype *base = find_static_template( jo.get_string( "copy-from" ) ) ) {
+        def = *base;
         def.looks_like = jo.get_string( "copy-from" );
         def.was_loaded = true;
         return true;
@@ -2541,8 +2555,11 @@ void Item_factory::load_basic_info( const JsonObject &jo, itype &def, const std:
 
     if( jo.has_string( "abstract" ) ) {
         m_abstracts[ def.id ] = def;
+    } else if( itype *existing = find_static_template( def.id ) ) {
+        *existing = def;
     } else {
-        m_templates[ def.id ] = def;
+        m_template_index.emplace( def.id, m_templates.size() );
+        m_templates.push_back( def );
     }
 }
 
@@ -2662,6 +2679,7 @@ void Item_factory::clear()
     m_runtimes.clear();
     m_template_groups.clear();
     m_templates.clear();
+    m_template_index.clear();
 
     gun_tools.clear();
     repair_actions.clear();
@@ -3147,7 +3165,7 @@ void item_group::debug_spawn()
 
 bool Item_factory::has_template( const itype_id &id ) const
 {
-    return m_templates.count( id ) || m_runtimes.count( id );
+    return m_template_index.count( id ) || m_runtimes.count( id );
 }
 
 std::vector<const itype *> Item_factory::all() const
@@ -3157,8 +3175,8 @@ std::vector<const itype *> Item_factory::all() const
     std::vector<const itype *> res;
     res.reserve( m_templates.size() + m_runtimes.size() );
 
-    for( const auto &e : m_templates ) {
-        res.push_back( &e.second );
+    for( const itype &e : m_templates ) {
+        res.push_back( &e );
     }
     for( const auto &e : m_runtimes ) {
         res.push_back( e.second.get() );
@@ -238,7 +238,16 @@ class Item_factory
 
         std::map<const std::string, itype> m_abstracts;
 
-        std::unordered_map<itype_id, itype> m_templates;
+        /**
+         * The static item types, stored next to each other and looked up via
+         * @ref m_template_index. Pointers into it are only handed out once frozen.
+         */
+        std::vector<itype> m_templates;
+        std::unordered_map<itype_id, size_t> m_template_index;
+
+        /** Static item type with that id or null if there is none. */
+        itype *find_static_template( const itype_id &id );
+        const itype *find_static_template( const itype_id &id ) const;
 
         mutable std::map<itype_id, std::unique_ptr<itype>> m_runtimes;
 
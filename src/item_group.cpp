@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <set>
 
 #include "calendar.h"
@@ -21,7 +22,7 @@ static const std::string null_item_id( "null" );
 static const std::string flag_NEEDS_NO_LUBE( "NEEDS_NO_LUBE" );
 static const std::string flag_NON_FOULING( "NON-FOULING" );
 static const std::string flag_PRIMITIVE_RANGED_WEAPON( "PRIMITIVE_RANGED_WEAPON" );
-static const std::string flag_VARSIZE( "VARSIZE" );
+static const flag_str_id flag_VARSIZE( "VARSIZE" );
 
 Item_spawn_data::ItemList Item_spawn_data::create( const time_point &birthday ) const
 {
@@ -42,6 +43,15 @@ Single_item_creator::Single_item_creator( const std::string &_id, Type _type, in
 {
 }
 
+const itype *Single_item_creator::item_type() const
+{
+    if( cached_type == nullptr || cached_type_id != id ) {
+        cached_type = item::find_type( id );
+        cached_type_id = id;
+    }
+    return cached_type;
+}
+
 item Single_item_creator::create_single( const time_point &birthday, RecursionList &rec ) const
 {
     item tmp;
@@ -49,7 +59,7 @@ item Single_item_creator::create_single( const time_point &birthday, RecursionLi
         if( id == "corpse" ) {
             tmp = item::make_corpse( mtype_id::NULL_ID(), birthday );
         } else {
-            tmp = item( id, birthday );
+            tmp = item( item_type(), birthday );
         }
     } else if( type == S_ITEM_GROUP ) {
         if( std::find( rec.begin(), rec.end(), id ) != rec.end() ) {
@@ -91,9 +101,9 @@ Item_spawn_data::ItemList Single_item_creator::create( const time_point &birthda
     }
     for( ; cnt > 0; cnt-- ) {
         if( type == S_ITEM ) {
-            const auto itm = create_single( birthday, rec );
+            item itm = create_single( birthday, rec );
             if( !itm.is_null() ) {
-                result.push_back( itm );
+                result.push_back( std::move( itm ) );
             }
         } else {
             if( std::find( rec.begin(), rec.end(), id ) != rec.end() ) {
@@ -113,7 +123,8 @@ Item_spawn_data::ItemList Single_item_creator::create( const time_point &birthda
                     modifier->modify( elem );
                 }
             }
-            result.insert( result.end(), tmplist.begin(), tmplist.end() );
+            result.insert( result.end(), std::make_move_iterator( tmplist.begin() ),
+                           std::make_move_iterator( tmplist.end() ) );
         }
     }
     return result;
@@ -476,7 +487,8 @@ Item_spawn_data::ItemList Item_group::create( const time_point &birthday, Recurs
                 continue;
             }
             ItemList tmp = ( elem )->create( birthday, rec );
-            result.insert( result.end(), tmp.begin(), tmp.end() );
+            result.insert( result.end(), std::make_move_iterator( tmp.begin() ),
+                           std::make_move_iterator( tmp.end() ) );
         }
     } else if( type == G_DISTRIBUTION ) {
         int p = rng( 0, sum_prob - 1 );
@@ -486,7 +498,8 @@ Item_spawn_data::ItemList Item_group::create( const time_point &birthday, Recurs
                 continue;
             }
             ItemList tmp = ( elem )->create( birthday, rec );
-            result.insert( result.end(), tmp.begin(), tmp.end() );
+            result.insert( result.end(), std::make_move_iterator( tmp.begin() ),
+                           std::make_move_iterator( tmp.end() ) );
             break;
         }
     }
@@ -242,6 +242,17 @@ class Single_item_creator : public Item_spawn_data
 
         bool has_item( const Item_tag &itemid ) const override;
         std::set<const itype *> every_item() const override;
+
+    private:
+        /**
+         * Type of the item for S_ITEM entries, looked up on first use as item types are only
+         * known once the item factory is finalized. Remembers the id it was looked up for,
+         * which keeps it right when @ref id is changed later.
+         */
+        mutable const itype *cached_type = nullptr;
+        mutable std::string cached_type_id;
+
+        const itype *item_type() const;
 };
 
 /**
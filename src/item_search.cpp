@@ -47,11 +47,14 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
             };
         // both
         case 'b':
-            return [filter]( const item & i ) {
-                auto pair = get_both( filter );
-                return item_filter_from_string( pair.first )( i )
-                       && item_filter_from_string( pair.second )( i );
-            };
+            {
+                const auto pair = get_both( filter );
+                const auto first = item_filter_from_string( pair.first );
+                const auto second = item_filter_from_string( pair.second );
+                return [first, second]( const item & i ) {
+                    return first( i ) && second( i );
+                };
+            }
         // disassembled components
         case 'd':
             return [filter]( const item & i ) {
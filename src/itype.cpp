@@ -73,6 +73,15 @@ bool itype::has_flag( const std::string &flag ) const
     return item_tags.count( flag );
 }
 
+bool itype::has_flag( const flag_str_id &flag ) const
+{
+    if( flag_bits.empty() || !flag.is_valid() ) {
+        return has_flag( flag.str() );
+    }
+    const size_t bit = flag.id().to_i();
+    return bit < flag_bits.size() && flag_bits[bit];
+}
+
 const itype::FlagsSetType &itype::get_flags() const
 {
     return item_tags;
@@ -863,6 +863,12 @@ struct itype {
         int damage_max_ = +4000;
         /// @}
 
+        /**
+         * Bit `i` is set if @ref item_tags contains the flag with the int id `i`.
+         * Filled in by @ref Item_factory::finalize_post, empty before that.
+         */
+        std::vector<bool> flag_bits;
+
     protected:
         std::string id = "null"; /** unique string identifier for this type */
 
@@ -1101,6 +1107,8 @@ struct itype {
         bool has_use() const;
 
         bool has_flag( const std::string &flag ) const;
+        /** Same as above, but just a bit test once the type has been finalized. */
+        bool has_flag( const flag_str_id &flag ) const;
 
         // returns read-only set of all item tags/flags
         const FlagsSetType &get_flags() const;
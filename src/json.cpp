@@ -31,6 +31,33 @@ static bool is_whitespace( char ch )
     return ( ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' );
 }
 
+// Printable ASCII apart from the quote and the escape character. These need no special
+// handling inside a string, and make up the vast majority of all string contents.
+static bool is_plain_string_character( const int ch )
+{
+    return ch >= 0x20 && ch < 0x80 && ch != '"' && ch != '\\';
+}
+
+// The next two read straight from the stream buffer, the caller has to make sure that
+// the stream is good. They stop at the first character that needs the slow path and
+// never change the stream state. Reaching the end of input just makes them stop.
+static void skip_plain_characters( std::streambuf &sb )
+{
+    int ch = sb.sgetc();
+    while( is_plain_string_character( ch ) ) {
+        ch = sb.snextc();
+    }
+}
+
+static void append_plain_characters( std::streambuf &sb, std::string &s )
+{
+    int ch = sb.sgetc();
+    while( is_plain_string_character( ch ) ) {
+        s += static_cast<char>( ch );
+        ch = sb.snextc();
+    }
+}
+
 // for parsing \uxxxx escapes
 static std::string utf16_to_utf8( uint32_t ch )
 {
@@ -246,6 +273,11 @@ JsonIn *JsonObject::get_raw( const std::string &name ) const
     return jsin;
 }
 
+bool JsonObject::has_source_location() const
+{
+    return jsin && jsin->get_path();
+}
+
 json_source_location JsonObject::get_source_location() const
 {
     if( !jsin ) {
@@ -747,8 +779,21 @@ void JsonIn::seek( int pos )
 
 void JsonIn::eat_whitespace()
 {
-    while( is_whitespace( peek() ) ) {
-        stream->get();
+    if( !stream->good() ) {
+        while( is_whitespace( peek() ) ) {
+            stream->get();
+        }
+        return;
+    }
+    // Reading from the buffer directly avoids constructing a sentry for every character.
+    std::streambuf *const sb = stream->rdbuf();
+    int ch = sb->sgetc();
+    while( ch != std::char_traits<char>::eof() && is_whitespace( static_cast<char>( ch ) ) ) {
+        ch = sb->snextc();
+    }
+    if( ch == std::char_traits<char>::eof() ) {
+        // Same state as peek() would leave behind.
+        stream->setstate( std::ios::eofbit );
     }
 }
 
@@ -833,7 +878,9 @@ void JsonIn::skip_string()
         err << "expecting string but found '" << ch << "'";
         error( err.str(), -1 );
     }
+    std::streambuf *const sb = stream->rdbuf();
     while( stream->good() ) {
+        skip_plain_characters( *sb );
         stream->get( ch );
         if( ch == '\\' ) {
             stream->get( ch );
@@ -1111,8 +1158,10 @@ std::string JsonIn::get_string()
             err = "expected string but got '" + std::string( 1, ch ) + "'";
             break;
         }
+        std::streambuf *const sb = stream->rdbuf();
         // add chars to the string, one at a time
         do {
+            append_plain_characters( *sb, s );
             ch = stream->peek();
             if( !stream->good() ) {
                 err = "read operation failed";
@@ -1975,21 +2024,52 @@ void JsonOut::write_null()
     need_separator = true;
 }
 
+void JsonOut::write_integer( const int64_t val )
+{
+    if( val < 0 ) {
+        stream->put( '-' );
+        // Negated as unsigned, -INT64_MIN does not fit into int64_t
+        write_integer( uint64_t( 0 ) - static_cast<uint64_t>( val ) );
+    } else {
+        write_integer( static_cast<uint64_t>( val ) );
+    }
+}
+
+void JsonOut::write_integer( uint64_t val )
+{
+    char buffer[20];
+    char *const end = buffer + sizeof( buffer );
+    char *begin = end;
+    do {
+        *--begin = static_cast<char>( '0' + val % 10 );
+        val /= 10;
+    } while( val != 0 );
+    stream->write( begin, end - begin );
+}
+
 void JsonOut::write( const std::string &val )
 {
     if( need_separator ) {
         write_separator();
     }
     stream->put( '"' );
-    for( const auto &i : val ) {
-        unsigned char ch = i;
+    // Copy runs of characters that need no escaping in one go.
+    const auto needs_escape = []( const char c ) {
+        const unsigned char ch = c;
+        return ch == '"' || ch == '\\' || ch < 0x20;
+    };
+    for( auto it = val.begin(); it != val.end(); ) {
+        const auto run_end = std::find_if( it, val.end(), needs_escape );
+        stream->write( &*it, run_end - it );
+        it = run_end;
+        if( it == val.end() ) {
+            break;
+        }
+        unsigned char ch = *it++;
         if( ch == '"' ) {
             stream->write( "\\\"", 2 );
         } else if( ch == '\\' ) {
             stream->write( "\\\\", 2 );
-        } else if( ch == '/' ) {
-            // don't technically need to escape this
-            stream->put( '/' );
         } else if( ch == '\b' ) {
             stream->write( "\\b", 2 );
         } else if( ch == '\f' ) {
@@ -2010,8 +2090,6 @@ void JsonOut::write( const std::string &val )
             } else {
                 stream->put( 'A' + ( remainder - 0x0A ) );
             }
-        } else {
-            stream->put( ch );
         }
     }
     stream->put( '"' );
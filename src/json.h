@@ -579,6 +579,23 @@ class JsonOut
         int indent_level = 0;
         bool need_separator = false;
 
+        // Integers are formatted by hand, the stream's locale machinery is slow and saves
+        // consist mostly of small numbers.
+        void write_integer( int64_t val );
+        void write_integer( uint64_t val );
+        template<typename T>
+        void write_number( T val, std::true_type /* is_integer */ ) {
+            if( std::is_signed<T>::value ) {
+                write_integer( static_cast<int64_t>( val ) );
+            } else {
+                write_integer( static_cast<uint64_t>( val ) );
+            }
+        }
+        template<typename T>
+        void write_number( T val, std::false_type /* is_integer */ ) {
+            *stream << val;
+        }
+
     public:
         JsonOut( std::ostream &stream, bool pretty_print = false, int depth = 0 );
         JsonOut( const JsonOut & ) = delete;
@@ -615,7 +632,9 @@ class JsonOut
             if( need_separator ) {
                 write_separator();
             }
-            *stream << val;
+            using is_integer = std::integral_constant<bool, std::is_integral<T>::value &&
+                  !std::is_same<T, bool>::value>;
+            write_number( val, is_integer() );
             need_separator = true;
         }
 
@@ -871,6 +890,8 @@ class JsonObject
         // seek to a value and return a pointer to the JsonIn (member must exist)
         JsonIn *get_raw( const std::string &name ) const;
         JsonValue get_member( const std::string &name ) const;
+        // whether get_source_location can be called (the object was read from a file)
+        bool has_source_location() const;
         json_source_location get_source_location() const;
 
         // values by name
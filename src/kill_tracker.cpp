@@ -116,6 +116,12 @@ void kill_tracker::clear()
     npc_kills.clear();
 }
 
+bool kill_tracker::wants( const event_type type ) const
+{
+    return type == event_type::character_kills_monster ||
+           type == event_type::character_kills_character;
+}
+
 void kill_tracker::notify( const cata::event &e )
 {
     switch( e.type() ) {
@@ -36,6 +36,7 @@ class kill_tracker : public event_subscriber
         void clear();
 
         void notify( const cata::event & ) override;
+        bool wants( event_type ) const override;
 
         void serialize( JsonOut & ) const;
         void deserialize( JsonIn & );
@@ -1,6 +1,8 @@
 #include "lightmap.h" // IWYU pragma: associated
 #include "shadowcasting.h" // IWYU pragma: associated
 
+#include <array>
+#include <bitset>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -369,7 +371,7 @@ void map::generate_lightmap( const int zlev )
     auto &lm = map_cache.lm;
     auto &sm = map_cache.sm;
     auto &outside_cache = map_cache.outside_cache;
-    std::memset( lm, 0, sizeof( lm ) );
+    // No need to clear lm, build_sunlight_cache below overwrites all of it.
     std::memset( sm, 0, sizeof( sm ) );
 
     /* Bulk light sources wastefully cast rays into neighbors; a burning hospital can produce
@@ -440,22 +442,24 @@ void map::generate_lightmap( const int zlev )
                         auto items = i_at( p );
                         add_light_from_items( p, items.begin(), items.end() );
                     }
+                }
+            }
 
-                    const ter_id terrain = cur_submap->get_ter( { sx, sy } );
-                    if( terrain->light_emitted > 0 ) {
-                        add_light_source( p, terrain->light_emitted );
-                    }
-                    const furn_id furniture = cur_submap->get_furn( {sx, sy } );
-                    if( furniture->light_emitted > 0 ) {
-                        add_light_source( p, furniture->light_emitted );
-                    }
-
-                    for( auto &fld : cur_submap->get_field( { sx, sy } ) ) {
-                        const field_entry *cur = &fld.second;
-                        const int light_emitted = cur->light_emitted();
-                        if( light_emitted > 0 ) {
-                            add_light_source( p, light_emitted );
-                        }
+            // Most tiles emit nothing, so only visit the known emitters and field tiles.
+            const tripoint sm_origin( smx * SEEX, smy * SEEY, zlev );
+            for( const std::pair<point, int> &emitter : cur_submap->get_light_emitters() ) {
+                add_light_source( sm_origin + emitter.first, emitter.second );
+            }
+            if( cur_submap->field_count == 0 ) {
+                continue;
+            }
+            for( int tile = cur_submap->next_field_tile( 0 ); tile < SEEX * SEEY;
+                 tile = cur_submap->next_field_tile( tile + 1 ) ) {
+                const point sp( tile / SEEY, tile % SEEY );
+                for( auto &fld : cur_submap->get_field( sp ) ) {
+                    const int light_emitted = fld.second.light_emitted();
+                    if( light_emitted > 0 ) {
+                        add_light_source( sm_origin + sp, light_emitted );
                     }
                 }
             }
@@ -1203,6 +1207,118 @@ castLightAll<float, float, shrapnel_calc, shrapnel_check,
     const float( &input_array )[MAPSIZE_X][MAPSIZE_Y],
     const point &offset, int offsetDistance, float numerator );
 
+// Octants in the order castLightAll casts them, as { xx, xy, yx, yy } of castLight.
+static constexpr std::array<std::array<int, 4>, 8> octant_transforms = {{
+        {{ 0, 1, 1, 0 }}, {{ 1, 0, 0, 1 }}, {{ 0, -1, 1, 0 }}, {{ -1, 0, 0, 1 }},
+        {{ 0, 1, -1, 0 }}, {{ 1, 0, 0, -1 }}, {{ 0, -1, -1, 0 }}, {{ -1, 0, 0, -1 }}
+    }
+};
+
+// Returns the octants that visit the tile at offset d from the origin of a cast.
+// Tiles on the edge between two octants are visited by both of them.
+static std::bitset<8> octants_containing( const point &d )
+{
+    std::bitset<8> result;
+    for( size_t i = 0; i < octant_transforms.size(); ++i ) {
+        const std::array<int, 4> &t = octant_transforms[i];
+        // Inverse of the castLight transform, which is its transpose.
+        const int dx = t[0] * d.x + t[2] * d.y;
+        const int dy = t[1] * d.x + t[3] * d.y;
+        result[i] = dy < 0 && dy <= dx && dx <= 0;
+    }
+    return result;
+}
+
+static void cast_seen_octants( float ( &seen_cache )[MAPSIZE_X][MAPSIZE_Y],
+                               const float ( &transparency_cache )[MAPSIZE_X][MAPSIZE_Y],
+                               const point &origin, const std::bitset<8> &octants )
+{
+    if( octants[0] ) {
+        castLight<0, 1, 1, 0, float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+            seen_cache, transparency_cache, origin, 0 );
+    }
+    if( octants[1] ) {
+        castLight<1, 0, 0, 1, float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+            seen_cache, transparency_cache, origin, 0 );
+    }
+    if( octants[2] ) {
+        castLight < 0, -1, 1, 0, float, float, sight_calc, sight_check, update_light,
+                  accumulate_transparency > ( seen_cache, transparency_cache, origin, 0 );
+    }
+    if( octants[3] ) {
+        castLight < -1, 0, 0, 1, float, float, sight_calc, sight_check, update_light,
+                  accumulate_transparency > ( seen_cache, transparency_cache, origin, 0 );
+    }
+    if( octants[4] ) {
+        castLight < 0, 1, -1, 0, float, float, sight_calc, sight_check, update_light,
+                  accumulate_transparency > ( seen_cache, transparency_cache, origin, 0 );
+    }
+    if( octants[5] ) {
+        castLight < 1, 0, 0, -1, float, float, sight_calc, sight_check, update_light,
+                  accumulate_transparency > ( seen_cache, transparency_cache, origin, 0 );
+    }
+    if( octants[6] ) {
+        castLight < 0, -1, -1, 0, float, float, sight_calc, sight_check, update_light,
+                  accumulate_transparency > ( seen_cache, transparency_cache, origin, 0 );
+    }
+    if( octants[7] ) {
+        castLight < -1, 0, 0, -1, float, float, sight_calc, sight_check, update_light,
+                  accumulate_transparency > ( seen_cache, transparency_cache, origin, 0 );
+    }
+}
+
+/**
+ * Updates a 2D seen cache that was previously cast from the same origin by recasting only
+ * the octants that contain a tile whose vision transparency has changed since.
+ * Returns false if the previous cast can't be reused and a full recast is needed instead.
+ */
+static bool recast_changed_octants( level_cache &map_cache, const point &origin )
+{
+    if( map_cache.seen_cache_origin != origin ) {
+        return false;
+    }
+    const float ( &transparency_cache )[MAPSIZE_X][MAPSIZE_Y] = map_cache.vision_transparency_cache;
+    float ( &seen_cache )[MAPSIZE_X][MAPSIZE_Y] = map_cache.seen_cache;
+
+    std::bitset<8> dirty_octants;
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            if( transparency_cache[x][y] != map_cache.seen_cache_transparency[x][y] ) {
+                dirty_octants |= octants_containing( point( x, y ) - origin );
+            }
+        }
+        if( dirty_octants.all() ) {
+            return false;
+        }
+    }
+    if( dirty_octants.none() ) {
+        return true;
+    }
+
+    // Clearing a dirty octant also clears its edges, so the neighbouring octants sharing
+    // those edges have to be recast too. Their results are unchanged, so this is safe.
+    std::bitset<8> recast_octants = dirty_octants;
+    for( const tripoint &d : eight_horizontal_neighbors ) {
+        const std::bitset<8> octants = octants_containing( d.xy() );
+        if( ( octants & dirty_octants ).any() ) {
+            recast_octants |= octants;
+        }
+    }
+    if( recast_octants.all() ) {
+        return false;
+    }
+
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            if( ( octants_containing( point( x, y ) - origin ) & dirty_octants ).any() ) {
+                seen_cache[x][y] = LIGHT_TRANSPARENCY_SOLID;
+            }
+        }
+    }
+    cast_seen_octants( seen_cache, transparency_cache, origin, recast_octants );
+    return true;
+}
+
 /**
  * Calculates the Field Of View for the provided map from the given x, y
  * coordinates. Returns a lightmap for a result where the values represent a
@@ -1230,17 +1346,24 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
     if( !fov_3d ) {
         for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
             auto &cur_cache = get_cache( z );
-            if( z == target_z || cur_cache.seen_cache_dirty ) {
+            if( z == target_z ) {
+                if( !recast_changed_octants( cur_cache, origin.xy() ) ) {
+                    std::uninitialized_fill_n(
+                        &seen_cache[0][0], map_dimensions, light_transparency_solid );
+                    seen_cache[origin.x][origin.y] = VISIBILITY_FULL;
+                    castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+                        seen_cache, transparency_cache, origin.xy(), 0 );
+                }
+                memcpy( &cur_cache.seen_cache_transparency, &transparency_cache,
+                        sizeof( transparency_cache ) );
+                cur_cache.seen_cache_origin = origin.xy();
+                cur_cache.seen_cache_dirty = false;
+            } else if( cur_cache.seen_cache_dirty ) {
                 std::uninitialized_fill_n(
                     &cur_cache.seen_cache[0][0], map_dimensions, light_transparency_solid );
+                cur_cache.seen_cache_origin = point_min;
                 cur_cache.seen_cache_dirty = false;
             }
-
-            if( z == target_z ) {
-                seen_cache[origin.x][origin.y] = VISIBILITY_FULL;
-                castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
-                    seen_cache, transparency_cache, origin.xy(), 0 );
-            }
         }
     } else {
         // Cache the caches (pointers to them)
@@ -1254,6 +1377,7 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
             floor_caches[z + OVERMAP_DEPTH] = &cur_cache.floor_cache;
             std::uninitialized_fill_n(
                 &cur_cache.seen_cache[0][0], map_dimensions, light_transparency_solid );
+            cur_cache.seen_cache_origin = point_min;
             cur_cache.seen_cache_dirty = false;
         }
         if( origin.z == target_z ) {
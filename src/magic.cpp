@@ -674,8 +674,8 @@ bool spell::can_cast( const Character &guy ) const
         case stamina_energy:
             return guy.get_stamina() >= energy_cost( guy );
         case hp_energy: {
-            for( const std::pair<const bodypart_str_id, bodypart> &elem : guy.get_body() ) {
-                if( energy_cost( guy ) < elem.second.get_hp_cur() ) {
+            for( const bodypart &elem : guy.get_body() ) {
+                if( energy_cost( guy ) < elem.get_hp_cur() ) {
                     return true;
                 }
             }
@@ -1476,8 +1476,8 @@ bool known_magic::has_enough_energy( const Character &guy, spell &sp ) const
         case stamina_energy:
             return guy.get_stamina() >= cost;
         case hp_energy:
-            for( const std::pair<const bodypart_str_id, bodypart> &elem : guy.get_body() ) {
-                if( elem.second.get_hp_cur() > cost ) {
+            for( const bodypart &elem : guy.get_body() ) {
+                if( elem.get_hp_cur() > cost ) {
                     return true;
                 }
             }
@@ -2093,6 +2093,11 @@ bool fake_spell::operator==( const fake_spell &rhs ) const
            npc_trigger_message == rhs.npc_trigger_message;
 }
 
+bool spell_events::wants( const event_type type ) const
+{
+    return type == event_type::player_levels_spell;
+}
+
 void spell_events::notify( const cata::event &e )
 {
     switch( e.type() ) {
@@ -126,6 +126,7 @@ class spell_events : public event_subscriber
 {
     public:
         void notify( const cata::event & ) override;
+        bool wants( event_type ) const override;
 };
 
 class spell_type
@@ -28,6 +28,7 @@
 #include "filesystem.h"
 #include "game.h"
 #include "game_ui.h"
+#include "init.h"
 #include "input.h"
 #include "language.h"
 #include "loading_ui.h"
@@ -38,6 +39,7 @@
 #include "options.h"
 #include "output.h"
 #include "path_info.h"
+#include "profiler.h"
 #include "rng.h"
 #include "type_id.h"
 
@@ -193,6 +195,8 @@ int main( int argc, char *argv[] )
     dump_mode dmode = dump_mode::TSV;
     std::vector<std::string> opts;
     std::string world; /** if set try to load first save in this world on startup */
+    std::string startup_profile; /** if set write the data loading times to this file */
+    std::string action_log; /** if set log player actions and their cost to this file */
 
 #if defined(__ANDROID__)
     // Start the standard output logging redirector
@@ -233,7 +237,7 @@ int main( int argc, char *argv[] )
         const char *section_default = nullptr;
         const char *section_map_sharing = "Map sharing";
         const char *section_user_directory = "User directories";
-        const std::array<arg_handler, 12> first_pass_arguments = {{
+        const std::array<arg_handler, 15> first_pass_arguments = {{
                 {
                     "--seed", "<string of letters and or numbers>",
                     "Sets the random number generator's seed value",
@@ -314,6 +318,45 @@ int main( int argc, char *argv[] )
                         return 1;
                     }
                 },
+                {
+                    "--startup-profile", "<path>",
+                    "Write the time spent loading each mod, JSON type and stage to a JSON file",
+                    section_default,
+                    [&startup_profile]( int n, const char *params[] ) -> int {
+                        if( n < 1 )
+                        {
+                            return -1;
+                        }
+                        startup_profile = params[0];
+                        return 1;
+                    }
+                },
+                {
+                    "--action-log", "<path>",
+                    "Append the RNG seed and every player action with its processing time to a file",
+                    section_default,
+                    [&action_log]( int n, const char *params[] ) -> int {
+                        if( n < 1 )
+                        {
+                            return -1;
+                        }
+                        action_log = params[0];
+                        return 1;
+                    }
+                },
+                {
+                    "--metrics-file", "<path>",
+                    "Periodically write turn timings and reality bubble counts to a file",
+                    section_default,
+                    []( int n, const char *params[] ) -> int {
+                        if( n < 1 )
+                        {
+                            return -1;
+                        }
+                        profiler::metrics_file = params[0];
+                        return 1;
+                    }
+                },
                 {
                     "--basepath", "<path>",
                     "Base path for all game data subdirectories",
@@ -663,8 +706,14 @@ int main( int argc, char *argv[] )
 #endif
 
     rng_set_engine_seed( seed );
+    if( !action_log.empty() ) {
+        profiler::open_action_log( action_log, seed );
+    }
 
     g = std::make_unique<game>();
+    if( !startup_profile.empty() ) {
+        DynamicDataLoader::get_instance().enable_load_profile( startup_profile );
+    }
     // First load and initialize everything that does not
     // depend on the mods.
     try {
@@ -1,6 +1,7 @@
 #include "map.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <climits>
 #include <cstdlib>
@@ -19,6 +20,7 @@
 #include "basecamp.h"
 #include "bodypart.h"
 #include "calendar.h"
+#include "cata_parallel.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "character_id.h"
@@ -73,6 +75,7 @@
 #include "overmapbuffer.h"
 #include "pathfinding.h"
 #include "player.h"
+#include "profiler.h"
 #include "projectile.h"
 #include "rng.h"
 #include "safe_reference.h"
@@ -150,13 +153,7 @@ map::map( int mapsize, bool zlev )
         grid.resize( static_cast<size_t>( my_MAPSIZE * my_MAPSIZE ), nullptr );
     }
 
-    for( auto &ptr : caches ) {
-        ptr = std::make_unique<level_cache>();
-    }
-
-    for( auto &ptr : pathfinding_caches ) {
-        ptr = std::make_unique<pathfinding_cache>();
-    }
+    cached_routes = std::make_unique<route_cache>();
 
     dbg( DL::Info ) << "map::map(): my_MAPSIZE: " << my_MAPSIZE << " z-levels enabled:" << zlevels;
     traplocs.resize( trap::count() );
@@ -241,6 +238,14 @@ void map::add_vehicle_to_cache( vehicle *veh )
 
     auto &ch = get_cache( veh->sm_pos.z );
     ch.veh_in_active_range = true;
+    std::vector<tripoint> &tiles = ch.veh_cached_tiles[veh];
+    // Release the tiles of an earlier call, so they can be claimed again below
+    for( const tripoint &p : tiles ) {
+        if( inbounds( p ) ) {
+            ch.veh_exists_at[p.x][p.y] = false;
+        }
+    }
+    tiles.clear();
     // Get parts
     std::vector<vehicle_part> &parts = veh->parts;
     int partid = 0;
@@ -250,10 +255,14 @@ void map::add_vehicle_to_cache( vehicle *veh )
             continue;
         }
         const tripoint p = veh->global_part_pos3( *it );
-        ch.veh_cached_parts.insert( std::make_pair( p,
-                                    std::make_pair( veh, partid ) ) );
-        if( inbounds( p ) ) {
+        if( !inbounds( p ) ) {
+            // Not looked up, but dropping things resting on it still has to happen
+            tiles.push_back( p );
+        } else if( !ch.veh_exists_at[p.x][p.y] ) {
+            // The first part cached on a tile is the one found there
             ch.veh_exists_at[p.x][p.y] = true;
+            ch.veh_cached_parts[p.x][p.y] = std::make_pair( veh, partid );
+            tiles.push_back( p );
         }
     }
 
@@ -269,20 +278,16 @@ void map::update_vehicle_cache( vehicle *veh, const int old_zlevel )
 
     // Existing must be cleared
     auto &ch = get_cache( old_zlevel );
-    auto it = ch.veh_cached_parts.begin();
-    const auto end = ch.veh_cached_parts.end();
-    while( it != end ) {
-        if( it->second.first == veh ) {
-            const tripoint p = it->first;
+    const auto it = ch.veh_cached_tiles.find( veh );
+    if( it != ch.veh_cached_tiles.end() ) {
+        for( const tripoint &p : it->second ) {
             if( inbounds( p ) ) {
                 ch.veh_exists_at[p.x][p.y] = false;
             }
-            ch.veh_cached_parts.erase( it++ );
             // If something was resting on vehicle, drop it
             support_dirty( tripoint( p.xy(), old_zlevel + 1 ) );
-        } else {
-            ++it;
         }
+        ch.veh_cached_tiles.erase( it );
     }
 
     add_vehicle_to_cache( veh );
@@ -291,14 +296,14 @@ void map::update_vehicle_cache( vehicle *veh, const int old_zlevel )
 void map::clear_vehicle_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    while( !ch.veh_cached_parts.empty() ) {
-        const auto part = ch.veh_cached_parts.begin();
-        const auto &p = part->first;
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = false;
+    for( const auto &elem : ch.veh_cached_tiles ) {
+        for( const tripoint &p : elem.second ) {
+            if( inbounds( p ) ) {
+                ch.veh_exists_at[p.x][p.y] = false;
+            }
         }
-        ch.veh_cached_parts.erase( part );
     }
+    ch.veh_cached_tiles.clear();
 }
 
 void map::clear_vehicle_list( const int zlev )
@@ -972,15 +977,9 @@ const vehicle *map::veh_at_internal( const tripoint &p, int &part_num ) const
         return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
     }
 
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
-    }
-
-    debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
-    part_num = -1;
-    return nullptr;
+    const std::pair<vehicle *, int> &cached = ch.veh_cached_parts[p.x][p.y];
+    part_num = cached.second;
+    return cached.first;
 }
 
 vehicle *map::veh_at_internal( const tripoint &p, int &part_num )
@@ -1331,30 +1330,33 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture )
     if( new_t.has_flag( "EMITTER" ) ) {
         field_furn_locs.push_back( p );
     }
-    if( old_t.transparent != new_t.transparent ) {
-        set_transparency_cache_dirty( p );
-        set_seen_cache_dirty( p );
-    }
+    invalidate_max_populated_zlev( p.z );
 
-    if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
-        set_outside_cache_dirty( p.z );
-    }
+    // map::generate invalidates the caches of the whole z-level once it is done
+    if( !defer_cache_invalidation ) {
+        if( old_t.transparent != new_t.transparent ) {
+            set_transparency_cache_dirty( p );
+            set_seen_cache_dirty( p );
+        }
 
-    if( old_t.has_flag( TFLAG_NO_FLOOR ) != new_t.has_flag( TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
-        set_seen_cache_dirty( p );
-    }
+        if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
+            set_outside_cache_dirty( p.z );
+        }
 
-    if( old_t.has_flag( TFLAG_SUN_ROOF_ABOVE ) != new_t.has_flag( TFLAG_SUN_ROOF_ABOVE ) ) {
-        set_floor_cache_dirty( p.z + 1 );
-    }
+        if( old_t.has_flag( TFLAG_NO_FLOOR ) != new_t.has_flag( TFLAG_NO_FLOOR ) ) {
+            set_floor_cache_dirty( p.z );
+            set_seen_cache_dirty( p );
+        }
 
-    invalidate_max_populated_zlev( p.z );
+        if( old_t.has_flag( TFLAG_SUN_ROOF_ABOVE ) != new_t.has_flag( TFLAG_SUN_ROOF_ABOVE ) ) {
+            set_floor_cache_dirty( p.z + 1 );
+        }
 
-    set_memory_seen_cache_dirty( p );
+        set_memory_seen_cache_dirty( p );
 
-    // TODO: Limit to changes that affect move cost, traps and stairs
-    set_pathfinding_cache_dirty( p.z );
+        // TODO: Limit to changes that affect move cost, traps and stairs
+        set_pathfinding_cache_dirty( p );
+    }
 
     // Make sure the furniture falls if it needs to
     support_dirty( p );
@@ -1443,22 +1445,18 @@ uint8_t map::get_known_connections( const tripoint &p, int connect_group,
 {
     auto &ch = access_cache( p.z );
     uint8_t val = 0;
-    std::function<bool( const tripoint & )> is_memorized;
 #ifdef TILES
-    if( use_tiles ) {
-        is_memorized =
-        [&]( const tripoint & q ) {
-            return !g->u.get_memorized_tile( getabs( q ) ).tile.empty();
-        };
-    } else {
-#endif
-        is_memorized =
-        [&]( const tripoint & q ) {
-            return g->u.get_memorized_symbol( getabs( q ) );
-        };
-#ifdef TILES
-    }
+    const bool memorized_as_tiles = use_tiles;
+#else
+    const bool memorized_as_tiles = false;
 #endif
+    const auto is_memorized = [&]( const tripoint & q ) -> bool {
+        if( memorized_as_tiles )
+        {
+            return !g->u.get_memorized_tile( getabs( q ) ).tile.empty();
+        }
+        return g->u.get_memorized_symbol( getabs( q ) );
+    };
 
     const bool overridden = override.find( p ) != override.end();
     const bool is_transparent = ch.transparency_cache[p.x][p.y] > LIGHT_TRANSPARENCY_SOLID;
@@ -1595,27 +1593,34 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
         traplocs[new_t.trap.to_i()].push_back( p );
     }
 
-    if( old_t.transparent != new_t.transparent ) {
-        set_transparency_cache_dirty( p );
-        set_seen_cache_dirty( p );
-    }
-
-    if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
-        set_outside_cache_dirty( p.z );
-    }
-
-    if( new_t.has_flag( TFLAG_NO_FLOOR ) != old_t.has_flag( TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
+    const bool floor_changed = new_t.has_flag( TFLAG_NO_FLOOR ) != old_t.has_flag( TFLAG_NO_FLOOR );
+    if( floor_changed ) {
         // It's a set, not a flag
         support_cache_dirty.insert( p );
-        set_seen_cache_dirty( p );
     }
     invalidate_max_populated_zlev( p.z );
 
-    set_memory_seen_cache_dirty( p );
+    // map::generate invalidates the caches of the whole z-level once it is done
+    if( !defer_cache_invalidation ) {
+        if( old_t.transparent != new_t.transparent ) {
+            set_transparency_cache_dirty( p );
+            set_seen_cache_dirty( p );
+        }
+
+        if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
+            set_outside_cache_dirty( p.z );
+        }
+
+        if( floor_changed ) {
+            set_floor_cache_dirty( p.z );
+            set_seen_cache_dirty( p );
+        }
+
+        set_memory_seen_cache_dirty( p );
 
-    // TODO: Limit to changes that affect move cost, traps and stairs
-    set_pathfinding_cache_dirty( p.z );
+        // TODO: Limit to changes that affect move cost, traps and stairs
+        set_pathfinding_cache_dirty( p );
+    }
 
     tripoint above( p.xy(), p.z + 1 );
     // Make sure that if we supported something and no longer do so, it falls down
@@ -2760,17 +2765,21 @@ bool map::mop_spills( const tripoint &p )
 
 int map::collapse_check( const tripoint &p )
 {
-    const bool collapses = has_flag( "COLLAPSES", p );
-    const bool supports_roof = has_flag( "SUPPORTS_ROOF", p );
+    const bool collapses = has_flag( TFLAG_COLLAPSES, p );
+    const bool supports_roof = has_flag( TFLAG_SUPPORTS_ROOF, p );
 
     int num_supports = p.z == OVERMAP_DEPTH ? 0 : -5;
     // if there's support below, things are less likely to collapse
     if( p.z > -OVERMAP_DEPTH ) {
         const tripoint &pbelow = tripoint( p.xy(), p.z - 1 );
-        for( const tripoint &tbelow : points_in_radius( pbelow, 1 ) ) {
-            if( has_flag( "SUPPORTS_ROOF", pbelow ) ) {
+        // Only the tile right below is looked at, the loop just weighs it by the number of
+        // its neighbors, so its flags are the same on every iteration.
+        const bool below_supports = has_flag( TFLAG_SUPPORTS_ROOF, pbelow );
+        const bool below_wall = below_supports && has_flag( TFLAG_WALL, pbelow );
+        if( below_supports ) {
+            for( const tripoint &tbelow : points_in_radius( pbelow, 1 ) ) {
                 num_supports += 1;
-                if( has_flag( "WALL", pbelow ) ) {
+                if( below_wall ) {
                     num_supports = 2;
                 }
                 if( tbelow == pbelow ) {
@@ -2786,16 +2795,16 @@ int map::collapse_check( const tripoint &p )
         }
 
         if( collapses ) {
-            if( has_flag( "COLLAPSES", t ) ) {
+            if( has_flag( TFLAG_COLLAPSES, t ) ) {
                 num_supports++;
-            } else if( has_flag( "SUPPORTS_ROOF", t ) ) {
+            } else if( has_flag( TFLAG_SUPPORTS_ROOF, t ) ) {
                 num_supports += 2;
             }
         } else if( supports_roof ) {
-            if( has_flag( "SUPPORTS_ROOF", t ) ) {
-                if( has_flag( "WALL", t ) ) {
+            if( has_flag( TFLAG_SUPPORTS_ROOF, t ) ) {
+                if( has_flag( TFLAG_WALL, t ) ) {
                     num_supports += 4;
-                } else if( !has_flag( "COLLAPSES", t ) ) {
+                } else if( !has_flag( TFLAG_COLLAPSES, t ) ) {
                     num_supports += 3;
                 }
             }
@@ -2810,15 +2819,15 @@ int map::collapse_check( const tripoint &p )
 void map::collapse_at( const tripoint &p, const bool silent, const bool was_supporting,
                        const bool destroy_pos )
 {
-    const bool supports = was_supporting || has_flag( "SUPPORTS_ROOF", p );
-    const bool wall = was_supporting || has_flag( "WALL", p );
+    const bool supports = was_supporting || has_flag( TFLAG_SUPPORTS_ROOF, p );
+    const bool wall = was_supporting || has_flag( TFLAG_WALL, p );
     // don't bash again if the caller already bashed here
     if( destroy_pos ) {
         destroy( p, silent );
         crush( p );
         make_rubble( p );
     }
-    const bool still_supports = has_flag( "SUPPORTS_ROOF", p );
+    const bool still_supports = has_flag( TFLAG_SUPPORTS_ROOF, p );
 
     // If something supporting the roof collapsed, see what else collapses
     if( supports && !still_supports ) {
@@ -2831,12 +2840,12 @@ void map::collapse_at( const tripoint &p, const bool silent, const bool was_supp
             }
             // if a wall collapses, walls without support from below risk collapsing and
             //propogate the collapse upwards
-            if( zlevels && wall && p == t && has_flag( "WALL", tz ) ) {
+            if( zlevels && wall && p == t && has_flag( TFLAG_WALL, tz ) ) {
                 collapse_at( tz, silent );
             }
             // floors without support from below risk collapsing into open air and can propogate
             // the collapse horizontally but not vertically
-            if( p != t && ( has_flag( "SUPPORTS_ROOF", t ) && has_flag( "COLLAPSES", t ) ) ) {
+            if( p != t && has_flag( TFLAG_SUPPORTS_ROOF, t ) && has_flag( TFLAG_COLLAPSES, t ) ) {
                 collapse_at( t, silent );
             }
             // this tile used to support a roof, now it doesn't, which means there is only
@@ -4069,22 +4078,22 @@ item &map::spawn_an_item( const tripoint &p, item new_item,
 
     new_item.set_damage( damlevel );
 
-    return add_item_or_charges( p, new_item );
+    return add_item_or_charges( p, std::move( new_item ) );
 }
 
-std::vector<item *> map::spawn_items( const tripoint &p, const std::vector<item> &new_items )
+std::vector<item *> map::spawn_items( const tripoint &p, std::vector<item> new_items )
 {
     std::vector<item *> ret;
     if( !inbounds( p ) || has_flag( "DESTROY_ITEM", p ) ) {
         return ret;
     }
     const bool swimmable = has_flag( "SWIMMABLE", p );
-    for( const item &new_item : new_items ) {
+    for( item &new_item : new_items ) {
 
         if( new_item.made_of( LIQUID ) && swimmable ) {
             continue;
         }
-        item &it = add_item_or_charges( p, new_item );
+        item &it = add_item_or_charges( p, std::move( new_item ) );
         if( !it.is_null() ) {
             ret.push_back( &it );
         }
@@ -4124,7 +4133,7 @@ void map::spawn_item( const tripoint &p, const std::string &type_id,
         new_item.set_flag( "FIT" );
     }
 
-    spawn_an_item( p, new_item, charges, damlevel );
+    spawn_an_item( p, std::move( new_item ), charges, damlevel );
 }
 
 units::volume map::max_volume( const tripoint &p )
@@ -4185,7 +4194,7 @@ item &map::add_item_or_charges( const tripoint &pos, item obj, bool overflow )
         }
 
         support_dirty( tile );
-        return add_item( tile, obj );
+        return add_item( tile, std::move( obj ) );
     };
 
     // Some items never exist on map as a discrete item (must be contained by another item)
@@ -4284,8 +4293,9 @@ item &map::add_item( const tripoint &p, item new_item )
 
     current_submap->update_lum_add( l, new_item );
 
-    const map_stack::iterator new_pos = current_submap->get_items( l ).insert( new_item );
-    if( new_item.needs_processing() ) {
+    const map_stack::iterator new_pos =
+        current_submap->get_items( l ).insert( std::move( new_item ) );
+    if( new_pos->needs_processing() ) {
         if( current_submap->active_items.empty() ) {
             submaps_with_active_items.insert( tripoint( abs_sub.x + p.x / SEEX, abs_sub.y + p.y / SEEY, p.z ) );
         }
@@ -4516,6 +4526,7 @@ std::vector<tripoint> map::check_submap_active_item_consistency()
 
 void map::process_items()
 {
+    profiler::scoped_zone zone( "map::process_items" );
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int gz = minz; gz <= maxz; ++gz ) {
@@ -4542,12 +4553,53 @@ void map::process_items()
     }
 }
 
+int map::field_count() const
+{
+    const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    int result = 0;
+    for( int gz = minz; gz <= maxz; ++gz ) {
+        for( int gx = 0; gx < my_MAPSIZE; ++gx ) {
+            for( int gy = 0; gy < my_MAPSIZE; ++gy ) {
+                const submap *const current_submap = get_submap_at_grid( { gx, gy, gz } );
+                if( current_submap != nullptr ) {
+                    result += current_submap->field_count;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+size_t map::active_item_count() const
+{
+    size_t result = 0;
+    for( const tripoint &abs_pos : submaps_with_active_items ) {
+        result += get_submap_at_grid( abs_pos - abs_sub.xy() )->active_items.size();
+    }
+    return result;
+}
+
+size_t map::cache_memory_usage() const
+{
+    size_t total = 0;
+    for( size_t i = 0; i < caches.size(); i++ ) {
+        if( caches[i] ) {
+            total += sizeof( level_cache );
+        }
+        if( pathfinding_caches[i] ) {
+            total += sizeof( pathfinding_cache );
+        }
+    }
+    return total;
+}
+
 void map::process_items_in_submap( submap &current_submap, const tripoint &gridp )
 {
-    // Get a COPY of the active item list for this submap.
-    // If more are added as a side effect of processing, they are ignored this turn.
+    // The list is separate from the cache itself, so if more items are added as a side
+    // effect of processing, they are ignored this turn.
     // If they are destroyed before processing, they don't get processed.
-    std::vector<item_reference> active_items = current_submap.active_items.get_for_processing();
+    std::vector<item_reference> &active_items = current_submap.active_items.get_for_processing();
     const point grid_offset( gridp.x * SEEX, gridp.y * SEEY );
     for( item_reference &active_item_ref : active_items ) {
         if( !active_item_ref.item_ref ) {
@@ -4595,30 +4647,37 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
     }
 
     auto cargo_parts = cur_veh.get_parts_including_carried( VPFLAG_CARGO );
+    // Index of the first cargo part at each mount point, so matching an active item to its
+    // part does not walk (and flag-check) every part of the vehicle once per item.
+    std::unordered_map<point, size_t> cargo_at_mount;
+    const auto index_cargo_parts = [&]() {
+        cargo_at_mount.clear();
+        for( const vpart_reference &vp : cargo_parts ) {
+            cargo_at_mount.emplace( vp.mount(), vp.part_index() );
+        }
+    };
+    index_cargo_parts();
     for( const vpart_reference &vp : cargo_parts ) {
         process_vehicle_items( cur_veh, vp.part_index() );
     }
 
     for( item_reference &active_item_ref : cur_veh.active_items.get_for_processing() ) {
-        if( empty( cargo_parts ) ) {
+        if( cargo_at_mount.empty() ) {
             return;
         } else if( !active_item_ref.item_ref ) {
             // The item was destroyed, so skip it.
             continue;
         }
-        const auto it = std::find_if( begin( cargo_parts ),
-        end( cargo_parts ), [&]( const vpart_reference & part ) {
-            return active_item_ref.location == part.mount();
-        } );
-
-        if( it == end( cargo_parts ) ) {
+        const auto cargo_iter = cargo_at_mount.find( active_item_ref.location );
+        if( cargo_iter == cargo_at_mount.end() ) {
             continue; // Can't find a cargo part matching the active item.
         }
+        const vpart_reference cargo_part( cur_veh, cargo_iter->second );
         const item &target = *active_item_ref.item_ref;
         // Find the cargo part and coordinates corresponding to the current active item.
-        const vehicle_part &pt = it->part();
-        const tripoint item_loc = it->pos();
-        auto items = cur_veh.get_items( static_cast<int>( it->part_index() ) );
+        const vehicle_part &pt = cargo_part.part();
+        const tripoint item_loc = cargo_part.pos();
+        auto items = cur_veh.get_items( static_cast<int>( cargo_part.part_index() ) );
         float it_insulation = 1.0;
         temperature_flag flag = temperature_flag::TEMP_NORMAL;
         if( target.is_food() || target.is_food_container() || target.is_corpse() ) {
@@ -4657,6 +4716,7 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
         // a low index has been removed by an explosion, all the other
         // parts would move up to fill the gap).
         cargo_parts = cur_veh.get_any_parts( VPFLAG_CARGO );
+        index_cargo_parts();
     }
 }
 
@@ -5093,6 +5153,33 @@ partial_con *map::partial_con_at( const tripoint &p )
     return nullptr;
 }
 
+std::vector<tripoint> map::partial_cons_in_radius( const tripoint &p, int radius ) const
+{
+    std::vector<tripoint> result;
+    if( !inbounds_z( p.z ) ) {
+        return result;
+    }
+    // Walk the partial constructions of the submaps in range instead of every tile.
+    const int max_coord = SEEX * my_MAPSIZE - 1;
+    const int min_smx = clamp( p.x - radius, 0, max_coord ) / SEEX;
+    const int max_smx = clamp( p.x + radius, 0, max_coord ) / SEEX;
+    const int min_smy = clamp( p.y - radius, 0, max_coord ) / SEEY;
+    const int max_smy = clamp( p.y + radius, 0, max_coord ) / SEEY;
+    for( int smx = min_smx; smx <= max_smx; smx++ ) {
+        for( int smy = min_smy; smy <= max_smy; smy++ ) {
+            const submap *sm = get_submap_at_grid( { smx, smy, p.z } );
+            for( const auto &elem : sm->partial_constructions ) {
+                const tripoint pos( smx * SEEX + elem.first.x, smy * SEEY + elem.first.y,
+                                    elem.first.z );
+                if( pos.z == p.z && square_dist( p, pos ) <= radius ) {
+                    result.push_back( pos );
+                }
+            }
+        }
+    }
+    return result;
+}
+
 void map::partial_con_remove( const tripoint &p )
 {
     if( !inbounds( p ) ) {
@@ -5139,6 +5226,7 @@ void map::trap_set( const tripoint &p, const trap_id &type )
     if( type != tr_null ) {
         traplocs[type.to_i()].push_back( p );
     }
+    set_pathfinding_cache_dirty( p );
 }
 
 void map::disarm_trap( const tripoint &p )
@@ -5220,6 +5308,7 @@ void map::remove_trap( const tripoint &p )
         if( iter != traps.end() ) {
             traps.erase( iter );
         }
+        set_pathfinding_cache_dirty( p );
     }
 }
 /*
@@ -5322,6 +5411,27 @@ field_entry *map::get_field( const tripoint &p, const field_type_id &type )
     return current_submap->get_field( l ).find_field( type );
 }
 
+bool map::may_have_fields_near( const tripoint &p, int radius ) const
+{
+    if( !inbounds_z( p.z ) ) {
+        return false;
+    }
+    const int max_coord = SEEX * my_MAPSIZE - 1;
+    const int min_smx = clamp( p.x - radius, 0, max_coord ) / SEEX;
+    const int max_smx = clamp( p.x + radius, 0, max_coord ) / SEEX;
+    const int min_smy = clamp( p.y - radius, 0, max_coord ) / SEEY;
+    const int max_smy = clamp( p.y + radius, 0, max_coord ) / SEEY;
+    const auto &field_cache = get_cache_ref( p.z ).field_cache;
+    for( int smx = min_smx; smx <= max_smx; smx++ ) {
+        for( int smy = min_smy; smy <= max_smy; smy++ ) {
+            if( field_cache[smx + smy * MAPSIZE] ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool map::dangerous_field_at( const tripoint &p )
 {
     for( auto &pr : field_at( p ) ) {
@@ -5356,6 +5466,7 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
     invalidate_max_populated_zlev( p.z );
 
     if( current_submap->get_field( l ).add_field( type_id, intensity, age ) ) {
+        current_submap->mark_field_tile( l );
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -5378,7 +5489,7 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
     }
 
     if( fd_type.is_dangerous() ) {
-        set_pathfinding_cache_dirty( p.z );
+        set_pathfinding_cache_dirty( p );
     }
 
     // Ensure blood type fields don't hang in the air
@@ -5410,7 +5521,7 @@ void map::remove_field( const tripoint &p, const field_type_id &field_to_remove
             set_seen_cache_dirty( p );
         }
         if( fdata.is_dangerous() ) {
-            set_pathfinding_cache_dirty( p.z );
+            set_pathfinding_cache_dirty( p );
         }
     }
 }
@@ -5715,8 +5826,9 @@ void map::draw( const catacurses::window &w, const tripoint &center )
     // Memorize off-screen tiles
     rectangle display( offs.xy(), offs.xy() + point( wnd_w, wnd_h ) );
     drawsq_params mm_params = drawsq_params().memorize( true ).output( false );
-    for( int y = 0; y < MAPSIZE_Y; y++ ) {
-        for( int x = 0; x < MAPSIZE_X; x++ ) {
+    // The order doesn't matter here, so walk along the rows of the [x][y] caches.
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
             const tripoint p( x, y, center.z );
             if( display.contains_half_open( p.xy() ) ) {
                 // Have been memorized during display loop
@@ -6447,39 +6559,35 @@ void map::load( const tripoint &w, const bool update_vehicle )
     field_furn_locs.clear();
     submaps_with_active_items.clear();
     set_abs_sub( w );
+    // Read the quad files on another thread while the ones already read are parsed here.
+    const int min_z = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int max_z = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    const point last_sub = abs_sub.xy() + point( my_MAPSIZE - 1, my_MAPSIZE - 1 );
+    MAPBUFFER.prefetch_quads( tripoint( abs_sub.xy(), min_z ), tripoint( last_sub, max_z ) );
     for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
         for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
             loadn( point( gridx, gridy ), update_vehicle );
         }
     }
+    MAPBUFFER.discard_prefetched_quads();
 }
 
 void map::shift_traps( const tripoint &shift )
 {
     // Offset needs to have sign opposite to shift direction
     const tripoint offset( -shift.x * SEEX, -shift.y * SEEY, -shift.z );
-    for( auto iter = field_furn_locs.begin(); iter != field_furn_locs.end(); ) {
-        tripoint &pos = *iter;
-        pos += offset;
-        if( inbounds( pos ) ) {
-            ++iter;
-        } else {
-            iter = field_furn_locs.erase( iter );
-        }
-    }
-    for( auto &traps : traplocs ) {
-        for( auto iter = traps.begin(); iter != traps.end(); ) {
-            tripoint &pos = *iter;
+    const auto shift_locations = [this, &offset]( std::vector<tripoint> &locations ) {
+        for( tripoint &pos : locations ) {
             pos += offset;
-            if( inbounds( pos ) ) {
-                ++iter;
-            } else {
-                // Theoretical enhancement: if this is not the last entry of the vector,
-                // move the last entry into pos and remove the last entry instead of iter.
-                // This would avoid moving all the remaining entries.
-                iter = traps.erase( iter );
-            }
         }
+        locations.erase( std::remove_if( locations.begin(), locations.end(),
+        [this]( const tripoint & pos ) {
+            return !inbounds( pos );
+        } ), locations.end() );
+    };
+    shift_locations( field_furn_locs );
+    for( auto &traps : traplocs ) {
+        shift_locations( traps );
     }
 }
 
@@ -6498,13 +6606,22 @@ void shift_bitset_cache( std::bitset<SIZE *SIZE> &cache, const point &s )
     if( s.x == 0 ) {
         return;
     }
-    const size_t x_offset = s.x > 0 ? SIZE - MULTIPLIER : 0;
-    for( size_t y = 0; y < SIZE; ++y ) {
-        size_t y_offset = y * SIZE;
-        for( size_t x = 0; x < MULTIPLIER; ++x ) {
-            cache.reset( y_offset + x_offset + x );
+    // Masks of the first and the last MULTIPLIER columns are built once, so the clearing is
+    // a word wise AND rather than a bit by bit reset.
+    static const std::array<std::bitset<SIZE *SIZE>, 2> keep_masks = []() {
+        std::array<std::bitset<SIZE *SIZE>, 2> masks;
+        for( size_t side = 0; side < masks.size(); ++side ) {
+            masks[side].set();
+            const size_t x_offset = side == 1 ? SIZE - MULTIPLIER : 0;
+            for( size_t y = 0; y < SIZE; ++y ) {
+                for( size_t x = 0; x < MULTIPLIER; ++x ) {
+                    masks[side].reset( y * SIZE + x_offset + x );
+                }
+            }
         }
-    }
+        return masks;
+    }();
+    cache &= keep_masks[s.x > 0 ? 1 : 0];
 }
 
 template void
@@ -6518,10 +6635,11 @@ static inline void shift_tripoint_set( std::set<tripoint> &set, const point &off
 {
     std::set<tripoint> old_set = std::move( set );
     set.clear();
+    // A translation keeps the order, so every point goes at the end of the new set.
     for( const tripoint &pt : old_set ) {
         tripoint new_pt = pt + offset;
         if( boundaries.contains_half_open( new_pt.xy() ) ) {
-            set.insert( new_pt );
+            set.insert( set.end(), new_pt );
         }
     }
 }
@@ -7385,7 +7503,9 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
                          tmp.wander_pos.x, tmp.wander_pos.y, tmp.wander_pos.z );
             }
 
-            monster *const placed = g->place_critter_at( make_shared_fast<monster>( tmp ), p );
+            // The group is cleared below, so its members can be moved out instead of copied
+            monster *const placed = g->place_critter_at(
+                                        make_shared_fast<monster>( std::move( tmp ) ), p );
             if( placed ) {
                 placed->on_load();
             }
@@ -7431,7 +7551,9 @@ void map::spawn_monsters_submap( const tripoint &gp, bool ignore_sight )
             };
 
             const auto place_it = [&]( const tripoint & p ) {
-                monster *const placed = g->place_critter_at( make_shared_fast<monster>( tmp ), p );
+                // tmp is built anew for every spawn, so it can be moved out instead of copied
+                monster *const placed = g->place_critter_at(
+                                            make_shared_fast<monster>( std::move( tmp ) ), p );
                 if( placed ) {
                     placed->on_load();
                 }
@@ -7664,6 +7786,17 @@ void map::build_outside_cache( const int zlev )
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             const auto cur_submap = get_submap_at_grid( { smx, smy, zlev } );
 
+            if( cur_submap->is_uniform ) {
+                // Every tile is the same, so the whole submap is indoors or none of it is
+                if( cur_submap->get_ter( point_zero ).obj().has_flag( TFLAG_INDOORS ) ||
+                    cur_submap->get_furn( point_zero ).obj().has_flag( TFLAG_INDOORS ) ) {
+                    for( int x = smx * SEEX; x < ( smx + 1 ) * SEEX + 2; x++ ) {
+                        std::fill_n( &padded_cache[x][smy * SEEY], SEEY + 2, false );
+                    }
+                }
+                continue;
+            }
+
             for( int sx = 0; sx < SEEX; ++sx ) {
                 for( int sy = 0; sy < SEEY; ++sy ) {
                     point sp( sx, sy );
@@ -7706,6 +7839,16 @@ void map::build_obstacle_cache( const tripoint &start, const tripoint &end,
         for( int smy = min_submap.y; smy <= max_submap.y; ++smy ) {
             const auto cur_submap = get_submap_at_grid( { smx, smy, start.z } );
 
+            if( cur_submap->is_uniform ) {
+                const int ter_move = cur_submap->get_ter( point_zero ).obj().movecost;
+                const int furn_move = cur_submap->get_furn( point_zero ).obj().movecost;
+                const bool obstacle = ter_move == 0 || furn_move < 0 || ter_move + furn_move == 0;
+                for( int x = smx * SEEX; x < ( smx + 1 ) * SEEX; x++ ) {
+                    std::fill_n( &obstacle_cache[x][smy * SEEY], SEEY, obstacle ? 1000.0f : 0.0f );
+                }
+                continue;
+            }
+
             // TODO: Init indices to prevent iterating over unused submap sections.
             for( int sx = 0; sx < SEEX; ++sx ) {
                 for( int sy = 0; sy < SEEY; ++sy ) {
@@ -7771,6 +7914,21 @@ bool map::build_floor_cache( const int zlev )
                 continue;
             }
 
+            // Sky and solid rock: one tile decides for the whole submap
+            const bool uniform_below = below_submap == nullptr || below_submap->is_uniform;
+            if( cur_submap->is_uniform && uniform_below ) {
+                const ter_t &terrain = cur_submap->get_ter( point_zero ).obj();
+                const bool roof_below = below_submap != nullptr &&
+                                        below_submap->get_furn( point_zero )->has_flag(
+                                            TFLAG_SUN_ROOF_ABOVE );
+                if( terrain.has_flag( TFLAG_NO_FLOOR ) && !roof_below ) {
+                    for( int x = smx * SEEX; x < ( smx + 1 ) * SEEX; x++ ) {
+                        std::fill_n( &floor_cache[x][smy * SEEY], SEEY, false );
+                    }
+                }
+                continue;
+            }
+
             for( int sx = 0; sx < SEEX; ++sx ) {
                 for( int sy = 0; sy < SEEY; ++sy ) {
                     point sp( sx, sy );
@@ -7847,16 +8005,31 @@ void map::do_vehicle_caching( int z )
 
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
+    profiler::scoped_zone zone( "map::build_map_cache" );
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
+    // Outside, transparency and floor caches of a level only depend on the submaps of that
+    // level (and the one below it), so all levels can be built at the same time.
+    std::array<bool, OVERMAP_LAYERS> floor_cache_rebuilt;
+    // debugmsg must not be called from the workers, their messages are reported after the join.
+    std::array<std::vector<deferred_debugmsg>, OVERMAP_LAYERS> errors;
+    cata::parallel_for( minz, maxz + 1, [&]( const int z ) {
+        defer_debugmsgs_during( errors[z + OVERMAP_DEPTH], [&]() {
+            build_outside_cache( z );
+            build_transparency_cache( z );
+            floor_cache_rebuilt[z + OVERMAP_DEPTH] = build_floor_cache( z );
+        } );
+    } );
+    for( const std::vector<deferred_debugmsg> &level_errors : errors ) {
+        report_deferred_debugmsgs( level_errors );
+    }
     bool seen_cache_dirty = false;
     for( int z = minz; z <= maxz; z++ ) {
         // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
         const bool affects_seen_cache =  z == zlev || fov_3d;
-        build_outside_cache( z );
-        build_transparency_cache( z );
-        seen_cache_dirty |= ( build_floor_cache( z ) && affects_seen_cache );
+        seen_cache_dirty |= floor_cache_rebuilt[z + OVERMAP_DEPTH] && affects_seen_cache;
         seen_cache_dirty |= get_cache( z ).seen_cache_dirty && affects_seen_cache;
+        // Vehicles also mark the floor of the level above, so this has to happen afterwards.
         do_vehicle_caching( z );
     }
     seen_cache_dirty |= build_vision_transparency_cache( zlev );
@@ -8243,6 +8416,31 @@ tripoint_range map::points_in_radius( const tripoint &center, size_t radius, siz
     return tripoint_range( tripoint( minx, miny, minz ), tripoint( maxx, maxy, maxz ) );
 }
 
+std::vector<tripoint> map::points_with_fields( const tripoint_range &range ) const
+{
+    std::vector<tripoint> result;
+    const tripoint &lo = range.min();
+    const tripoint &hi = range.max();
+    for( int z = lo.z; z <= hi.z; ++z ) {
+        for( int gx = lo.x / SEEX; gx <= hi.x / SEEX; ++gx ) {
+            for( int gy = lo.y / SEEY; gy <= hi.y / SEEY; ++gy ) {
+                const submap *const sm = get_submap_at_grid( { gx, gy, z } );
+                if( sm->field_count == 0 ) {
+                    continue;
+                }
+                for( int tile = sm->next_field_tile( 0 ); tile < SEEX * SEEY;
+                     tile = sm->next_field_tile( tile + 1 ) ) {
+                    const tripoint p( gx * SEEX + tile / SEEY, gy * SEEY + tile % SEEY, z );
+                    if( p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y ) {
+                        result.push_back( p );
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
 tripoint_range map::points_on_zlevel( const int z ) const
 {
     if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
@@ -8333,7 +8531,7 @@ std::list<Creature *> map::get_creatures_in_radius( const tripoint &center, size
 level_cache &map::access_cache( int zlev )
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        return get_cache( zlev );
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -8343,7 +8541,7 @@ level_cache &map::access_cache( int zlev )
 const level_cache &map::access_cache( int zlev ) const
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        return get_cache( zlev );
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -8365,6 +8563,7 @@ level_cache::level_cache()
     std::fill_n( &transparency_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &vision_transparency_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
+    std::fill_n( &seen_cache_transparency[0][0], map_dimensions, 0.0f );
     std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, LL_DARK );
     veh_in_active_range = false;
@@ -8373,20 +8572,39 @@ level_cache::level_cache()
 
 pathfinding_cache::pathfinding_cache()
 {
-    dirty = true;
+    dirty_submaps.set();
 }
 
 pathfinding_cache::~pathfinding_cache() = default;
 
 pathfinding_cache &map::get_pathfinding_cache( int zlev ) const
 {
-    return *pathfinding_caches[zlev + OVERMAP_DEPTH];
+    std::unique_ptr<pathfinding_cache> &cache = pathfinding_caches[zlev + OVERMAP_DEPTH];
+    if( !cache ) {
+        cache = std::make_unique<pathfinding_cache>();
+    }
+    return *cache;
 }
 
 void map::set_pathfinding_cache_dirty( const int zlev )
 {
     if( inbounds_z( zlev ) ) {
-        get_pathfinding_cache( zlev ).dirty = true;
+        // A cache that hasn't been created yet starts out dirty anyway
+        if( pathfinding_caches[zlev + OVERMAP_DEPTH] ) {
+            pathfinding_caches[zlev + OVERMAP_DEPTH]->dirty_submaps.set();
+        }
+        cached_routes->clear();
+    }
+}
+
+void map::set_pathfinding_cache_dirty( const tripoint &p )
+{
+    if( inbounds( p ) ) {
+        const tripoint smp = ms_to_sm_copy( p );
+        if( pathfinding_caches[smp.z + OVERMAP_DEPTH] ) {
+            pathfinding_caches[smp.z + OVERMAP_DEPTH]->dirty_submaps.set( smp.x * MAPSIZE + smp.y );
+        }
+        cached_routes->clear();
     }
 }
 
@@ -8394,10 +8612,10 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
 {
     if( !inbounds_z( zlev ) ) {
         debugmsg( "Tried to get pathfinding cache for out of bounds z-level %d", zlev );
-        return *pathfinding_caches[ OVERMAP_DEPTH ];
+        return get_pathfinding_cache( 0 );
     }
     auto &cache = get_pathfinding_cache( zlev );
-    if( cache.dirty ) {
+    if( cache.dirty_submaps.any() ) {
         update_pathfinding_cache( zlev );
     }
 
@@ -8407,14 +8625,15 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
 void map::update_pathfinding_cache( int zlev ) const
 {
     auto &cache = get_pathfinding_cache( zlev );
-    if( !cache.dirty ) {
+    if( cache.dirty_submaps.none() ) {
         return;
     }
 
-    std::uninitialized_fill_n( &cache.special[0][0], MAPSIZE_X * MAPSIZE_Y, PF_NORMAL );
-
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            if( !cache.dirty_submaps[smx * MAPSIZE + smy] ) {
+                continue;
+            }
             const auto cur_submap = get_submap_at_grid( { smx, smy, zlev } );
             if( !cur_submap ) {
                 return;
@@ -8476,10 +8695,9 @@ void map::update_pathfinding_cache( int zlev ) const
                     cache.special[p.x][p.y] = cur_value;
                 }
             }
+            cache.dirty_submaps.reset( smx * MAPSIZE + smy );
         }
     }
-
-    cache.dirty = false;
 }
 
 void map::clip_to_bounds( tripoint &p ) const
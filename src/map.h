@@ -14,6 +14,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -85,7 +86,10 @@ using VehicleList = std::vector<wrapped_vehicle>;
 class map;
 
 enum ter_bitflags : int;
+enum pf_special : int;
 struct pathfinding_cache;
+struct route_cache;
+struct flow_field;
 struct pathfinding_settings;
 template<typename T>
 struct weighted_int_list;
@@ -303,6 +307,12 @@ struct level_cache {
     // values range from 1 (fully visible to player) to 0 (not visible)
     float seen_cache[MAPSIZE_X][MAPSIZE_Y];
 
+    // copy of `vision_transparency_cache` and the origin used by the last 2D cast into
+    // `seen_cache`, lets build_seen_cache recast only the octants whose input has changed
+    // `seen_cache_origin` is point_min when `seen_cache` can't be updated incrementally
+    float seen_cache_transparency[MAPSIZE_X][MAPSIZE_Y];
+    point seen_cache_origin = point_min;
+
     // same as `seen_cache` (same units) but contains values for cameras and mirrors
     // effective "visibility_cache" is calculated as "max(seen_cache, camera_cache)"
     float camera_cache[MAPSIZE_X][MAPSIZE_Y];
@@ -314,7 +324,10 @@ struct level_cache {
 
     bool veh_in_active_range;
     bool veh_exists_at[MAPSIZE_X][MAPSIZE_Y];
-    std::map< tripoint, std::pair<vehicle *, int> > veh_cached_parts;
+    // vehicle and part index on each tile where veh_exists_at is set
+    std::pair<vehicle *, int> veh_cached_parts[MAPSIZE_X][MAPSIZE_Y];
+    // tiles each cached vehicle claimed in veh_cached_parts, so they can be released again
+    std::unordered_map<const vehicle *, std::vector<tripoint>> veh_cached_tiles;
     std::set<vehicle *> vehicle_list;
     std::set<vehicle *> zone_vehicles;
 
@@ -413,6 +426,9 @@ class map
         }
 
         void set_pathfinding_cache_dirty( int zlev );
+        // more granular version of the pathfinding cache invalidation, only the submap
+        // containing p (in local coords, "ms") is rebuilt
+        void set_pathfinding_cache_dirty( const tripoint &p );
         /*@}*/
 
         void set_memory_seen_cache_dirty( const tripoint &p ) {
@@ -1283,9 +1299,9 @@ class map
                                                 const time_point &turn = calendar::start_of_cataclysm );
 
         // Similar to spawn_an_item, but spawns a list of items, or nothing if the list is empty.
-        std::vector<item *> spawn_items( const tripoint &p, const std::vector<item> &new_items );
-        void spawn_items( const point &p, const std::vector<item> &new_items ) {
-            spawn_items( tripoint( p, abs_sub.z ), new_items );
+        std::vector<item *> spawn_items( const tripoint &p, std::vector<item> new_items );
+        void spawn_items( const point &p, std::vector<item> new_items ) {
+            spawn_items( tripoint( p, abs_sub.z ), std::move( new_items ) );
         }
 
         void create_anomaly( const tripoint &p, artifact_natural_property prop, bool create_rubble = true );
@@ -1297,6 +1313,8 @@ class map
         void partial_con_set( const tripoint &p, const partial_con &con );
         void partial_con_remove( const tripoint &p );
         partial_con *partial_con_at( const tripoint &p );
+        /** Local positions of all partial constructions within radius of p on its z-level. */
+        std::vector<tripoint> partial_cons_in_radius( const tripoint &p, int radius ) const;
         // Traps
         void trap_set( const tripoint &p, const trap_id &type );
 
@@ -1387,6 +1405,11 @@ class map
          * @return NULL if there is no such field entry at that place.
          */
         field_entry *get_field( const tripoint &p, const field_type_id &type );
+        /**
+         * Whether any loaded submap overlapping the square of the given radius around p
+         * may hold fields. A false result means there are certainly none there.
+         */
+        bool may_have_fields_near( const tripoint &p, int radius ) const;
         bool dangerous_field_at( const tripoint &p );
         /**
          * Add field entry at point, or set intensity if present
@@ -1809,6 +1832,16 @@ class map
         int bash_rating_internal( int str, const furn_t &furniture,
                                   const ter_t &terrain, bool allow_floor,
                                   const vehicle *veh, int part ) const;
+        /**
+         * Cost for route() of stepping from `cur` onto the adjacent tile `p` on the same z-level,
+         * not counting the diagonal penalty. Returns -1 if `p` can't be entered from `cur`.
+         * Sets `close_p` if `p` shouldn't be considered from any other tile either, and `ledge`
+         * if `p` is a ledge that can be climbed down instead of entered.
+         */
+        int route_step_cost( const tripoint &cur, const tripoint &p, pf_special p_special,
+                             const pathfinding_settings &settings, bool &close_p, bool &ledge ) const;
+        /** Fills in the costs and routes of `field` toward its destination, see flow_field. */
+        void build_flow_field( flow_field &field ) const;
 
         /**
          * Internal version of the drawsq. Keeps a cached maptile for less re-getting.
@@ -1896,11 +1929,15 @@ class map
          */
         std::vector<tripoint> field_furn_locs;
         /**
-         * Holds caches for visibility, light, transparency and vehicles
+         * Holds caches for visibility, light, transparency and vehicles.
+         * Allocated on first use of each z-level, see @ref get_cache.
          */
-        std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
+        mutable std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
 
+        /** Allocated on first use of each z-level, like @ref caches. */
         mutable std::array< std::unique_ptr<pathfinding_cache>, OVERMAP_LAYERS > pathfinding_caches;
+        // Routes found this turn, see route_cache
+        mutable std::unique_ptr<route_cache> cached_routes;
         /**
          * Set of submaps that contain active items in absolute coordinates.
          */
@@ -1918,21 +1955,31 @@ class map
         bool last_full_vehicle_list_dirty = true;
 
         // Note: no bounds check
+        // The cache is created on first access, as most maps (like the tinymaps used for
+        // mapgen) only ever touch a few of the z-levels and a level cache is large.
         level_cache &get_cache( int zlev ) const {
-            return *caches[zlev + OVERMAP_DEPTH];
+            std::unique_ptr<level_cache> &cache = caches[zlev + OVERMAP_DEPTH];
+            if( !cache ) {
+                cache = std::make_unique<level_cache>();
+            }
+            return *cache;
         }
 
         pathfinding_cache &get_pathfinding_cache( int zlev ) const;
 
         visibility_variables visibility_variables_cache;
 
+        // Set while map::generate runs: terrain and furniture writes then skip the per-tile
+        // cache invalidation and the generated z-level is invalidated once at the end.
+        bool defer_cache_invalidation = false;
+
         // caches the highest zlevel above which all zlevels are uniform
         // !value || value->first != map::abs_sub means cache is invalid
         cata::optional<std::pair<tripoint, int>> max_populated_zlev = cata::nullopt;
 
     public:
         const level_cache &get_cache_ref( int zlev ) const {
-            return *caches[zlev + OVERMAP_DEPTH];
+            return get_cache( zlev );
         }
 
         const pathfinding_cache &get_pathfinding_cache_ref( int zlev ) const;
@@ -1948,9 +1995,20 @@ class map
         const std::set<tripoint> &get_submaps_with_active_items() const {
             return submaps_with_active_items;
         }
+        /** Number of fields in the reality bubble on all loaded z-levels. */
+        int field_count() const;
+        /** Number of active map items in the reality bubble, vehicles excluded. */
+        size_t active_item_count() const;
+        /** Bytes held by the per z-level caches that have been created so far. */
+        size_t cache_memory_usage() const;
         // Clips the area to map bounds
         tripoint_range points_in_rectangle( const tripoint &from, const tripoint &to ) const;
         tripoint_range points_in_radius( const tripoint &center, size_t radius, size_t radiusz = 0 ) const;
+        /**
+         * The points of @p range (as clipped by @ref points_in_radius) that may hold a field,
+         * in submap order. Much cheaper than checking every point when fields are sparse.
+         */
+        std::vector<tripoint> points_with_fields( const tripoint_range &range ) const;
         /**
          * Yields a range of all points that are contained in the map and have the z-level of
          * this map (@ref abs_sub).
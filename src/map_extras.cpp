@@ -1,6 +1,8 @@
 #include "map_extras.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdlib>
 #include <map>
 #include <memory>
@@ -136,6 +138,11 @@ namespace
 
 generic_factory<map_extra> extras( "map extra" );
 
+std::map<string_id<map_extra>, MapExtras::application_profile> profiles;
+
+// Extras slower than this are logged, so hitches can be traced back to them.
+constexpr double slow_extra_seconds = 0.05;
+
 } // namespace
 
 /** @relates string_id */
@@ -2915,6 +2922,21 @@ void apply_function( const string_id<map_extra> &id, map &m, const tripoint &abs
     bool applied_successfully = false;
 
     const map_extra &extra = id.obj();
+    const auto start = std::chrono::steady_clock::now();
+    const int64_t heap_before = heap_in_use();
+    on_out_of_scope record_profile( [&]() {
+        const double seconds = std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - start ).count();
+        application_profile &prof = profiles[id];
+        prof.applications++;
+        prof.seconds += seconds;
+        prof.max_seconds = std::max( prof.max_seconds, seconds );
+        prof.heap_growth += heap_in_use() - heap_before;
+        if( seconds > slow_extra_seconds ) {
+            DebugLog( DL::Warn, DC::MapGen ) << "map extra " << id.str() << " took " << seconds
+                                             << " s at " << abs_sub.to_string();
+        }
+    } );
     switch( extra.generator_method ) {
         case map_extra_method::map_extra_function: {
             const map_extra_pointer mx_func = get_function( extra.generator_id );
@@ -2989,6 +3011,28 @@ void reset()
     extras.reset();
 }
 
+void debug_show_profiles()
+{
+    std::vector<std::pair<string_id<map_extra>, application_profile>> sorted( profiles.begin(),
+            profiles.end() );
+    std::sort( sorted.begin(), sorted.end(), []( const auto & l, const auto & r ) {
+        return l.second.seconds > r.second.seconds;
+    } );
+    uilist results_menu;
+    results_menu.text = _( "Time spent applying map extras this session:" );
+    for( const std::pair<string_id<map_extra>, application_profile> &e : sorted ) {
+        const application_profile &prof = e.second;
+        const std::string line = string_format( _( "%s: %d x, %.3f s total, %.3f s max, %d KiB" ),
+                                                e.first.str(), prof.applications, prof.seconds,
+                                                prof.max_seconds, prof.heap_growth / 1024 );
+        results_menu.addentry( -1, true, -2, line );
+    }
+    if( results_menu.entries.empty() ) {
+        results_menu.text = _( "No map extras have been applied this session." );
+    }
+    results_menu.query();
+}
+
 void debug_spawn_test()
 {
     uilist mx_menu;
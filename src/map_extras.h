@@ -77,6 +77,18 @@ void reset();
 
 void debug_spawn_test();
 
+/** Time and memory spent in @ref apply_function for one map extra. */
+struct application_profile {
+    int applications = 0;
+    double seconds = 0;
+    double max_seconds = 0;
+    // Change of the allocated memory, 0 if unknown.
+    int64_t heap_growth = 0;
+};
+
+/** Lists the time spent in every map extra applied since the game started. */
+void debug_show_profiles();
+
 /// This function provides access to all loaded map extras.
 const generic_factory<map_extra> &mapExtraFactory();
 
@@ -1,10 +1,15 @@
 #include "map_memory.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
 #include "coordinate_conversions.h"
 #include "debug.h"
 #include "filesystem.h"
 #include "fstream_utils.h"
 #include "game.h"
+#include "json.h"
 #include "line.h"
 #include "translations.h"
 
@@ -45,6 +50,49 @@ struct reg_coord_pair {
 
 mm_submap::mm_submap() = default;
 
+void mm_submap::set_tile( const point &p, const memorized_terrain_tile &value )
+{
+    if( tiles.empty() ) {
+        // call 'reserve' first to force allocation of exact size
+        tiles.reserve( SEEX * SEEY );
+        tiles.resize( SEEX * SEEY, 0 );
+        palette.push_back( default_tile );
+    }
+    uint16_t &idx = tiles[p.y * SEEX + p.x];
+    if( palette[idx] == value ) {
+        return;
+    }
+    const auto it = std::find( palette.begin(), palette.end(), value );
+    if( it != palette.end() ) {
+        idx = static_cast<uint16_t>( it - palette.begin() );
+        return;
+    }
+    // Overwritten tiles leave stale entries behind, keep the palette bounded.
+    if( palette.size() >= SEEX * SEEY ) {
+        idx = 0;
+        compact_palette();
+    }
+    tiles[p.y * SEEX + p.x] = static_cast<uint16_t>( palette.size() );
+    palette.push_back( value );
+}
+
+void mm_submap::compact_palette()
+{
+    std::vector<uint16_t> remap( palette.size(), UINT16_MAX );
+    std::vector<memorized_terrain_tile> new_palette;
+    // Default tile always stays at index 0
+    remap[0] = 0;
+    new_palette.push_back( palette[0] );
+    for( uint16_t &idx : tiles ) {
+        if( remap[idx] == UINT16_MAX ) {
+            remap[idx] = static_cast<uint16_t>( new_palette.size() );
+            new_palette.push_back( std::move( palette[idx] ) );
+        }
+        idx = remap[idx];
+    }
+    palette = std::move( new_palette );
+}
+
 mm_region::mm_region() : submaps {{ nullptr }} {}
 
 bool mm_region::is_empty() const
@@ -64,11 +112,30 @@ map_memory::coord_pair::coord_pair( const tripoint &p ) : loc( p.xy() )
     sm = tripoint( ms_to_sm_remain( loc.x, loc.y ), p.z );
 }
 
+size_t mm_submap::memory_usage() const
+{
+    size_t total = sizeof( mm_submap ) + palette.capacity() * sizeof( memorized_terrain_tile ) +
+                   tiles.capacity() * sizeof( uint16_t ) + symbols.capacity() * sizeof( int );
+    for( const memorized_terrain_tile &tile : palette ) {
+        total += tile.tile.capacity();
+    }
+    return total;
+}
+
 map_memory::map_memory()
 {
     clear_cache();
 }
 
+size_t map_memory::memory_usage() const
+{
+    size_t total = 0;
+    for( const auto &elem : submaps ) {
+        total += sizeof( elem ) + elem.second->memory_usage();
+    }
+    return total;
+}
+
 const memorized_terrain_tile &map_memory::get_tile( const tripoint &pos ) const
 {
     coord_pair p( pos );
@@ -326,10 +393,8 @@ bool map_memory::save( const tripoint &pos )
                                       );
 
             const auto writer = [&]( std::ostream & fout ) -> void {
-                fout << serialize_wrapper( [&]( JsonOut & jsout )
-                {
-                    reg.serialize( jsout );
-                } );
+                JsonOut jsout( fout );
+                reg.serialize( jsout );
             };
 
             const bool res = write_to_file( path, writer, descr.c_str() );
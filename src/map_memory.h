@@ -2,8 +2,10 @@
 #ifndef CATA_SRC_MAP_MEMORY_H
 #define CATA_SRC_MAP_MEMORY_H
 
+#include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "game_constants.h"
 #include "memory_fast.h"
@@ -43,18 +45,11 @@ struct mm_submap {
             if( tiles.empty() ) {
                 return default_tile;
             } else {
-                return tiles[p.y * SEEX + p.x];
+                return palette[tiles[p.y * SEEX + p.x]];
             }
         }
 
-        inline void set_tile( const point &p, const memorized_terrain_tile &value ) {
-            if( tiles.empty() ) {
-                // call 'reserve' first to force allocation of exact size
-                tiles.reserve( SEEX * SEEY );
-                tiles.resize( SEEX * SEEY, default_tile );
-            }
-            tiles[p.y * SEEX + p.x] = value;
-        }
+        void set_tile( const point &p, const memorized_terrain_tile &value );
 
         inline int symbol( const point &p ) const {
             if( symbols.empty() ) {
@@ -76,9 +71,21 @@ struct mm_submap {
         void serialize( JsonOut &jsout ) const;
         void deserialize( JsonIn &jsin );
 
+        /** Approximate bytes held by this submap. */
+        size_t memory_usage() const;
+
     private:
-        std::vector<memorized_terrain_tile> tiles; // holds either 0 or SEEX*SEEY elements
+        /**
+         * Distinct tiles memorized in this submap, indexed by @ref tiles.
+         * Most submaps only contain a handful of different tiles, so storing
+         * each tile id once is much cheaper than storing it for every square.
+         */
+        std::vector<memorized_terrain_tile> palette;
+        std::vector<uint16_t> tiles; // holds either 0 or SEEX*SEEY elements
         std::vector<int> symbols; // holds either 0 or SEEX*SEEY elements
+
+        /** Drop palette entries no longer referenced by any square. */
+        void compact_palette();
 };
 
 /**
@@ -139,6 +146,9 @@ class map_memory
          */
         bool prepare_region( const tripoint &p1, const tripoint &p2 );
 
+        /** Approximate bytes held by the memorized submaps. */
+        size_t memory_usage() const;
+
         /**
          * Memorizes given tile, overwriting old value.
          * @param pos tile position, in global ms coords.
@@ -14,8 +14,13 @@
 
 map_selector::map_selector( const tripoint &pos, int radius, bool accessible )
 {
+    map &here = get_map();
     for( const tripoint &e : closest_tripoints_first( pos, radius ) ) {
-        if( !accessible || get_map().clear_path( pos, e, radius, 1, 100 ) ) {
+        // Most tiles in range hold nothing, don't bother tracing a path to them.
+        if( !here.has_items( e ) ) {
+            continue;
+        }
+        if( !accessible || here.clear_path( pos, e, radius, 1, 100 ) ) {
             data.emplace_back( e );
         }
     }
@@ -34,6 +34,7 @@ class map_selector : public visitable<map_selector>
          *  @param pos position on map at which to start each query
          *  @param radius number of adjacent tiles to include (searching from pos outwards)
          *  @param accessible whether found items must be accessible from pos to be considered
+         *  Only tiles that hold items at the time of construction are included.
          */
         map_selector( const tripoint &pos, int radius = 0, bool accessible = true );
 
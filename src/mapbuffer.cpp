@@ -1,13 +1,24 @@
 #include "mapbuffer.h"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <functional>
+#include <iterator>
 #include <set>
 #include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+#include "binary_io.h"
+#include "calendar.h"
 #include "cata_utility.h"
 #include "coordinate_conversions.h"
 #include "debug.h"
@@ -16,13 +27,18 @@
 #include "fstream_utils.h"
 #include "game.h"
 #include "game_constants.h"
+#include "item.h"
 #include "json.h"
 #include "map.h"
+#include "mapsharing.h"
+#include "options.h"
 #include "output.h"
 #include "popup.h"
+#include "profiler.h"
 #include "string_formatter.h"
 #include "submap.h"
 #include "translations.h"
+#include "trap.h"
 #include "ui_manager.h"
 
 static std::string find_quad_path( const std::string &dirname, const tripoint &om_addr )
@@ -37,6 +53,255 @@ static std::string find_dirname( const tripoint &om_addr )
                           segment_addr.y, segment_addr.z );
 }
 
+/**
+ * Quad files serialized by @ref mapbuffer::save. They are written by a separate thread,
+ * which only ever touches this object, until @ref mapbuffer::finish_pending_writes joins it.
+ */
+struct quad_writer {
+    struct quad_file {
+        std::string path;
+        std::string contents;
+        size_t hash = 0;
+        bool written = false;
+        std::string error;
+    };
+    std::vector<quad_file> files;
+    std::thread thread;
+
+    void write_all() {
+        for( quad_file &file : files ) {
+            try {
+                write_to_file( file.path, [&]( std::ostream & fout ) {
+                    fout << file.contents;
+                } );
+                file.written = true;
+            } catch( const std::exception &err ) {
+                file.error = err.what();
+            }
+        }
+    }
+};
+
+/**
+ * Quad files read ahead by @ref mapbuffer::prefetch_quads. The list of files is fixed before
+ * the thread starts; the thread fills them in order and only then counts them as done, after
+ * which they belong to the main thread.
+ */
+struct quad_reader {
+    struct quad_file {
+        std::string path;
+        std::string contents;
+        bool read = false;
+    };
+    std::vector<quad_file> files;
+    std::unordered_map<std::string, size_t> index;
+    std::atomic<size_t> done{ 0 };
+    std::atomic<bool> cancelled{ false };
+    std::thread thread;
+
+    void read_all() {
+        for( quad_file &file : files ) {
+            if( cancelled ) {
+                break;
+            }
+            // Missing files are normal (the quad has not been generated yet) and errors are
+            // left for the main thread to report when it reads the file again itself.
+            cata_ifstream fin;
+            fin.mode( cata_ios_mode::binary ).open( file.path );
+            if( fin.is_open() ) {
+                file.contents.assign( std::istreambuf_iterator<char>( *fin ),
+                                      std::istreambuf_iterator<char>() );
+                file.read = !fin.bad();
+            }
+            done++;
+        }
+    }
+};
+
+/** Binary quad files start with this, JSON ones with '['. */
+static constexpr char binary_quad_magic[4] = { 'C', 'B', 'Q', 'D' };
+static constexpr uint32_t binary_quad_version = 1;
+
+/**
+ * Writes one submap in the binary quad format.
+ * Terrain, furniture and traps are run length encoded as (index, count) pairs of u16,
+ * with the index referring to a table of the ids used in this submap. Radiation is
+ * encoded as (value, count) pairs. Tiles are in the same order as in the JSON format.
+ * Everything else (items, vehicles, ...) is embedded as the JSON object written by
+ * @ref submap::store_contents, it is rarely the bulk of a submap.
+ */
+static void store_binary_submap( binary_writer &out, const tripoint &addr, const submap &sm )
+{
+    out.write_i32( addr.x );
+    out.write_i32( addr.y );
+    out.write_i32( addr.z );
+    out.write_i32( savegame_version );
+    out.write_i64( to_turns<int>( sm.last_touched - calendar::turn_zero ) );
+    out.write_i32( sm.get_temperature() );
+
+    std::vector<std::string> ids;
+    std::unordered_map<std::string, uint16_t> id_indices;
+    using run_list = std::vector<std::pair<uint16_t, uint16_t>>;
+    const auto encode = [&]( const std::function<std::string( const point & )> &id_at ) {
+        run_list runs;
+        for( int j = 0; j < SEEY; j++ ) {
+            for( int i = 0; i < SEEX; i++ ) {
+                const std::string id = id_at( point( i, j ) );
+                const auto emplaced = id_indices.emplace( id, ids.size() );
+                if( emplaced.second ) {
+                    ids.push_back( id );
+                }
+                const uint16_t index = emplaced.first->second;
+                if( !runs.empty() && runs.back().first == index ) {
+                    runs.back().second++;
+                } else {
+                    runs.emplace_back( index, 1 );
+                }
+            }
+        }
+        return runs;
+    };
+    const run_list ter_runs = encode( [&]( const point & p ) {
+        return sm.get_ter( p ).id().str();
+    } );
+    const run_list furn_runs = encode( [&]( const point & p ) {
+        return sm.get_furn( p ).id().str();
+    } );
+    const run_list trap_runs = encode( [&]( const point & p ) {
+        return sm.get_trap( p ).id().str();
+    } );
+
+    out.write_u16( ids.size() );
+    for( const std::string &id : ids ) {
+        out.write_short_string( id );
+    }
+    for( const run_list *runs : {
+             &ter_runs, &furn_runs, &trap_runs
+         } ) {
+        out.write_u16( runs->size() );
+        for( const auto &run : *runs ) {
+            out.write_u16( run.first );
+            out.write_u16( run.second );
+        }
+    }
+
+    std::vector<std::pair<int, uint16_t>> rad_runs;
+    for( int j = 0; j < SEEY; j++ ) {
+        for( int i = 0; i < SEEX; i++ ) {
+            const int rad = sm.get_radiation( point( i, j ) );
+            if( !rad_runs.empty() && rad_runs.back().first == rad ) {
+                rad_runs.back().second++;
+            } else {
+                rad_runs.emplace_back( rad, 1 );
+            }
+        }
+    }
+    out.write_u16( rad_runs.size() );
+    for( const auto &run : rad_runs ) {
+        out.write_i32( run.first );
+        out.write_u16( run.second );
+    }
+
+    std::ostringstream contents;
+    {
+        JsonOut jsout( contents );
+        jsout.start_object();
+        sm.store_contents( jsout );
+        jsout.end_object();
+    }
+    out.write_string( contents.str() );
+}
+
+/** Counterpart of @ref store_binary_submap. Throws on malformed data. */
+static std::unique_ptr<submap> load_binary_submap( binary_reader &in, tripoint &addr )
+{
+    std::unique_ptr<submap> sm = std::make_unique<submap>();
+    addr.x = in.read_i32();
+    addr.y = in.read_i32();
+    addr.z = in.read_i32();
+    const int version = in.read_i32();
+    sm->last_touched = calendar::turn_zero + time_duration::from_turns( in.read_i64() );
+    sm->set_temperature( in.read_i32() );
+
+    std::vector<std::string> ids( in.read_u16() );
+    for( std::string &id : ids ) {
+        id = in.read_short_string();
+    }
+    using run_list = std::vector<std::pair<uint16_t, uint16_t>>;
+    const auto read_runs = [&]() {
+        run_list runs( in.read_u16() );
+        int cells = 0;
+        for( auto &run : runs ) {
+            run.first = in.read_u16();
+            run.second = in.read_u16();
+            cells += run.second;
+            if( run.first >= ids.size() || cells > SEEX * SEEY ) {
+                throw std::runtime_error( "corrupted submap layer" );
+            }
+        }
+        if( cells != SEEX * SEEY ) {
+            throw std::runtime_error( "incomplete submap layer" );
+        }
+        return runs;
+    };
+    const run_list ter_runs = read_runs();
+    const run_list furn_runs = read_runs();
+    const run_list trap_runs = read_runs();
+    // The layers share one id table. Each id is only resolved for the layers that use it,
+    // and only once per layer rather than once per tile.
+    const auto apply = [&]( const run_list & runs, const auto & to_id, const auto & set ) {
+        std::vector<decltype( to_id( std::string() ) )> resolved( ids.size() );
+        std::vector<bool> is_resolved( ids.size(), false );
+        int cell = 0;
+        for( const auto &run : runs ) {
+            if( !is_resolved[run.first] ) {
+                resolved[run.first] = to_id( ids[run.first] );
+                is_resolved[run.first] = true;
+            }
+            for( int end = cell + run.second; cell < end; cell++ ) {
+                set( point( cell % SEEX, cell / SEEX ), resolved[run.first] );
+            }
+        }
+    };
+    apply( ter_runs, []( const std::string & id ) {
+        return ter_str_id( id ).id();
+    }, [&]( const point & p, const ter_id & ter ) {
+        sm->set_ter( p, ter );
+    } );
+    apply( furn_runs, []( const std::string & id ) {
+        return furn_str_id( id ).id();
+    }, [&]( const point & p, const furn_id & furn ) {
+        sm->set_furn( p, furn );
+    } );
+    apply( trap_runs, []( const std::string & id ) {
+        return trap_str_id( id ).id();
+    }, [&]( const point & p, const trap_id & trap ) {
+        sm->set_trap( p, trap );
+    } );
+
+    const uint16_t rad_run_count = in.read_u16();
+    int cell = 0;
+    for( uint16_t r = 0; r < rad_run_count; r++ ) {
+        const int rad = in.read_i32();
+        const uint16_t count = in.read_u16();
+        if( cell + count > SEEX * SEEY ) {
+            throw std::runtime_error( "corrupted submap radiation" );
+        }
+        for( int end = cell + count; cell < end; cell++ ) {
+            sm->set_radiation( point( cell % SEEX, cell / SEEX ), rad );
+        }
+    }
+
+    std::istringstream contents( in.read_string() );
+    JsonIn jsin( contents );
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string member_name = jsin.get_member_name();
+        sm->load( jsin, member_name, version );
+    }
+    return sm;
+}
+
 mapbuffer MAPBUFFER;
 
 mapbuffer::mapbuffer() = default;
@@ -46,8 +311,100 @@ mapbuffer::~mapbuffer()
     reset();
 }
 
+void mapbuffer::finish_pending_writes()
+{
+    if( !writer ) {
+        return;
+    }
+    if( writer->thread.joinable() ) {
+        writer->thread.join();
+    }
+    for( const quad_writer::quad_file &file : writer->files ) {
+        if( file.written ) {
+            written_quad_hashes[file.path] = file.hash;
+        } else {
+            written_quad_hashes.erase( file.path );
+            popup( _( "Failed to write %1$s to \"%2$s\": %3$s" ), _( "map data" ), file.path, file.error );
+        }
+    }
+    writer.reset();
+}
+
+void mapbuffer::prefetch_quads( const tripoint &sm_min, const tripoint &sm_max )
+{
+    discard_prefetched_quads();
+    // The files must not be read while they are still being written.
+    finish_pending_writes();
+
+    auto r = std::make_unique<quad_reader>();
+    for( int x = sm_min.x; x <= sm_max.x; x++ ) {
+        for( int y = sm_min.y; y <= sm_max.y; y++ ) {
+            for( int z = sm_min.z; z <= sm_max.z; z++ ) {
+                const tripoint om_addr = sm_to_omt_copy( tripoint( x, y, z ) );
+                if( is_submap_loaded( omt_to_sm_copy( om_addr ) ) ) {
+                    continue;
+                }
+                std::string path = find_quad_path( find_dirname( om_addr ), om_addr );
+                if( r->index.emplace( path, r->files.size() ).second ) {
+                    r->files.emplace_back();
+                    r->files.back().path = std::move( path );
+                }
+            }
+        }
+    }
+    // Not worth a thread, this is the case for the small maps used by mapgen.
+    if( r->files.size() < 8 ) {
+        return;
+    }
+    reader = std::move( r );
+    quad_reader *const rd = reader.get();
+    try {
+        reader->thread = std::thread( [rd]() {
+            rd->read_all();
+        } );
+    } catch( const std::system_error &err ) {
+        debugmsg( "Failed to start reading map data ahead: %s", err.what() );
+        reader.reset();
+    }
+}
+
+void mapbuffer::discard_prefetched_quads()
+{
+    if( !reader ) {
+        return;
+    }
+    reader->cancelled = true;
+    if( reader->thread.joinable() ) {
+        reader->thread.join();
+    }
+    reader.reset();
+}
+
+bool mapbuffer::take_prefetched_quad( const std::string &path, std::string &contents )
+{
+    if( !reader ) {
+        return false;
+    }
+    const auto iter = reader->index.find( path );
+    // Files the thread has not got to yet are read right here instead of waiting for it.
+    if( iter == reader->index.end() || iter->second >= reader->done ) {
+        return false;
+    }
+    quad_reader::quad_file &file = reader->files[iter->second];
+    if( !file.read ) {
+        return false;
+    }
+    contents = std::move( file.contents );
+    file.read = false;
+    return true;
+}
+
 void mapbuffer::reset()
 {
+    discard_prefetched_quads();
+    finish_pending_writes();
+    written_quad_hashes.clear();
+    evicted_quads.clear();
     for( auto &elem : submaps ) {
         delete elem.second;
     }
@@ -56,13 +413,7 @@ void mapbuffer::reset()
 
 bool mapbuffer::add_submap( const tripoint &p, submap *sm )
 {
-    if( submaps.count( p ) != 0 ) {
-        return false;
-    }
-
-    submaps[p] = sm;
-
-    return true;
+    return submaps.emplace( p, sm ).second;
 }
 
 bool mapbuffer::add_submap( const tripoint &p, std::unique_ptr<submap> &sm )
@@ -100,8 +451,64 @@ submap *mapbuffer::lookup_submap( const tripoint &p )
     return iter->second;
 }
 
+bool mapbuffer::is_submap_loaded( const tripoint &p ) const
+{
+    return submaps.count( p ) != 0;
+}
+
+size_t mapbuffer::memory_usage() const
+{
+    size_t total = 0;
+    for( const auto &elem : submaps ) {
+        total += sizeof( submap_map_t::value_type ) + sizeof( submap );
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                total += elem.second->get_items( point( x, y ) ).capacity() * sizeof( item );
+            }
+        }
+    }
+    for( const auto &elem : evicted_quads ) {
+        total += sizeof( elem ) + elem.second.capacity();
+    }
+    return total;
+}
+
+void mapbuffer::evict_distant( const size_t max_submaps )
+{
+    if( submaps.size() <= max_submaps ) {
+        return;
+    }
+    profiler::scoped_zone zone( "mapbuffer::evict_distant" );
+    // Same window as the one save() keeps in memory.
+    const tripoint map_origin = sm_to_omt_copy( g->m.get_abs_sub() );
+    std::set<tripoint> distant_quads;
+    for( const auto &elem : submaps ) {
+        const tripoint om_addr = sm_to_omt_copy( elem.first );
+        if( om_addr.x < map_origin.x || om_addr.y < map_origin.y ||
+            om_addr.x > map_origin.x + HALF_MAPSIZE || om_addr.y > map_origin.y + HALF_MAPSIZE ) {
+            distant_quads.insert( om_addr );
+        }
+    }
+    std::list<tripoint> submaps_to_delete;
+    for( const tripoint &om_addr : distant_quads ) {
+        std::string contents;
+        if( serialize_quad( om_addr, submaps_to_delete, contents ) ) {
+            evicted_quads[om_addr] = std::move( contents );
+        }
+    }
+    for( const tripoint &addr : submaps_to_delete ) {
+        remove_submap( addr );
+    }
+}
+
 void mapbuffer::save( bool delete_after_save )
 {
+    profiler::scoped_zone zone( "mapbuffer::save" );
+    // What was read ahead is about to become outdated.
+    discard_prefetched_quads();
+    finish_pending_writes();
+    writer = std::make_unique<quad_writer>();
+
     assure_dir_exist( g->get_world_base_save_path() + "/maps" );
 
     int num_saved_submaps = 0;
@@ -118,7 +525,15 @@ void mapbuffer::save( bool delete_after_save )
     static constexpr std::chrono::milliseconds update_interval( 500 );
     auto last_update = std::chrono::steady_clock::now();
 
-    for( auto &elem : submaps ) {
+    // Save in a fixed order, independent of how the hash map happens to be laid out.
+    std::vector<tripoint> addresses;
+    addresses.reserve( submaps.size() );
+    for( const auto &elem : submaps ) {
+        addresses.push_back( elem.first );
+    }
+    std::sort( addresses.begin(), addresses.end() );
+
+    for( const tripoint &addr : addresses ) {
         auto now = std::chrono::steady_clock::now();
         if( last_update + update_interval < now ) {
             popup.message( _( "Please wait as the map saves [%d/%d]" ),
@@ -131,7 +546,7 @@ void mapbuffer::save( bool delete_after_save )
         // we're saving a 2x2 quad of submaps at a time.
         // Submaps are generated in quads, so we know if we have one member of a quad,
         // we have the rest of it, if that assumption is broken we have REAL problems.
-        const tripoint om_addr = sm_to_omt_copy( elem.first );
+        const tripoint om_addr = sm_to_omt_copy( addr );
         if( saved_submaps.count( om_addr ) != 0 ) {
             // Already handled this one.
             continue;
@@ -157,6 +572,25 @@ void mapbuffer::save( bool delete_after_save )
     for( auto &elem : submaps_to_delete ) {
         remove_submap( elem );
     }
+    // Evicted quads are only written now, so the files on disk always match the last save.
+    for( auto &elem : evicted_quads ) {
+        const std::string dirname = find_dirname( elem.first );
+        const std::string quad_path = find_quad_path( dirname, elem.first );
+        queue_quad_write( dirname, quad_path, std::move( elem.second ) );
+    }
+    evicted_quads.clear();
+
+    if( !writer->files.empty() ) {
+        quad_writer *const w = writer.get();
+        try {
+            w->thread = std::thread( [w]() {
+                w->write_all();
+            } );
+        } catch( const std::system_error & ) {
+            // No thread available, just do it here.
+            w->write_all();
+        }
+    }
 
     get_distribution_grid_tracker().on_saved();
 }
@@ -164,6 +598,20 @@ void mapbuffer::save( bool delete_after_save )
 void mapbuffer::save_quad( const std::string &dirname, const std::string &filename,
                            const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
                            bool delete_after_save )
+{
+    std::list<tripoint> quad_submaps;
+    std::string contents;
+    const bool has_contents = serialize_quad( om_addr, quad_submaps, contents );
+    if( delete_after_save ) {
+        submaps_to_delete.splice( submaps_to_delete.end(), quad_submaps );
+    }
+    if( has_contents ) {
+        queue_quad_write( dirname, filename, std::move( contents ) );
+    }
+}
+
+bool mapbuffer::serialize_quad( const tripoint &om_addr, std::list<tripoint> &quad_submaps,
+                                std::string &contents )
 {
     std::vector<point> offsets;
     std::vector<tripoint> submap_addrs;
@@ -178,7 +626,8 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         submap_addr.x += offsets_offset.x;
         submap_addr.y += offsets_offset.y;
         submap_addrs.push_back( submap_addr );
-        submap *sm = submaps[submap_addr];
+        const auto iter = submaps.find( submap_addr );
+        submap *sm = iter == submaps.end() ? nullptr : iter->second;
         if( sm != nullptr && !sm->is_uniform ) {
             all_uniform = false;
         }
@@ -186,33 +635,39 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
 
     if( all_uniform ) {
         // Nothing to save - this quad will be regenerated faster than it would be re-read
-        if( delete_after_save ) {
-            for( auto &submap_addr : submap_addrs ) {
-                if( submaps.count( submap_addr ) > 0 && submaps[submap_addr] != nullptr ) {
-                    submaps_to_delete.push_back( submap_addr );
-                }
+        for( auto &submap_addr : submap_addrs ) {
+            const auto iter = submaps.find( submap_addr );
+            if( iter != submaps.end() && iter->second != nullptr ) {
+                quad_submaps.push_back( submap_addr );
             }
         }
+        return false;
+    }
 
-        return;
+    std::vector<std::pair<tripoint, const submap *>> to_store;
+    for( auto &submap_addr : submap_addrs ) {
+        const auto iter = submaps.find( submap_addr );
+        if( iter == submaps.end() || iter->second == nullptr ) {
+            continue;
+        }
+        to_store.emplace_back( submap_addr, iter->second );
+        quad_submaps.push_back( submap_addr );
     }
 
-    // Don't create the directory if it would be empty
-    assure_dir_exist( dirname );
-    write_to_file( filename, [&]( std::ostream & fout ) {
+    std::ostringstream fout;
+    if( get_option<std::string>( "MAP_SAVE_FORMAT" ) == "binary" ) {
+        binary_writer out( fout );
+        out.write_bytes( binary_quad_magic, sizeof( binary_quad_magic ) );
+        out.write_u32( binary_quad_version );
+        out.write_u32( to_store.size() );
+        for( const auto &elem : to_store ) {
+            store_binary_submap( out, elem.first, *elem.second );
+        }
+    } else {
         JsonOut jsout( fout );
         jsout.start_array();
-        for( auto &submap_addr : submap_addrs ) {
-            if( submaps.count( submap_addr ) == 0 ) {
-                continue;
-            }
-
-            submap *sm = submaps[submap_addr];
-
-            if( sm == nullptr ) {
-                continue;
-            }
-
+        for( const auto &elem : to_store ) {
+            const tripoint &submap_addr = elem.first;
             jsout.start_object();
 
             jsout.member( "version", savegame_version );
@@ -224,23 +679,44 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
             jsout.write( submap_addr.z );
             jsout.end_array();
 
-            sm->store( jsout );
+            elem.second->store( jsout );
 
             jsout.end_object();
-
-            if( delete_after_save ) {
-                submaps_to_delete.push_back( submap_addr );
-            }
         }
 
         jsout.end_array();
-    } );
+    }
+    contents = fout.str();
+    return true;
+}
+
+void mapbuffer::queue_quad_write( const std::string &dirname, const std::string &filename,
+                                  std::string contents )
+{
+    quad_writer::quad_file file;
+    file.path = filename;
+    file.contents = std::move( contents );
+    file.hash = std::hash<std::string>()( file.contents );
+    // In a shared world another session may have replaced the file since we wrote it, so
+    // the hash of our own last write says nothing about what is on disk.
+    const auto hash_iter = written_quad_hashes.find( filename );
+    if( !MAP_SHARING::isSharing() && hash_iter != written_quad_hashes.end() &&
+        hash_iter->second == file.hash && file_exist( filename ) ) {
+        // Unchanged since we last wrote it.
+        return;
+    }
+    // Don't create the directory if it would be empty
+    assure_dir_exist( dirname );
+    writer->files.push_back( std::move( file ) );
 }
 
 // We're reading in way too many entities here to mess around with creating sub-objects and
 // seeking around in them, so we're using the json streaming API.
 submap *mapbuffer::unserialize_submaps( const tripoint &p )
 {
+    // The file may be one that is still being written.
+    finish_pending_writes();
+
     // Map the tripoint to the submap quad that stores it.
     const tripoint om_addr = sm_to_omt_copy( p );
     const std::string dirname = find_dirname( om_addr );
@@ -258,17 +734,64 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
         }
     }
 
-    using namespace std::placeholders;
-    if( !read_from_file_optional_json( quad_path, std::bind( &mapbuffer::deserialize, this, _1 ) ) ) {
+    const auto parse = [&]( std::istream & fin ) {
+        char magic[sizeof( binary_quad_magic )] = {};
+        fin.read( magic, sizeof( magic ) );
+        if( fin && std::equal( std::begin( magic ), std::end( magic ), std::begin( binary_quad_magic ) ) ) {
+            deserialize_binary( fin );
+        } else {
+            fin.clear();
+            fin.seekg( 0 );
+            JsonIn jsin( fin, quad_path );
+            deserialize( jsin );
+        }
+    };
+    bool read = false;
+    std::string prefetched;
+    const auto evicted = evicted_quads.find( om_addr );
+    if( evicted != evicted_quads.end() ) {
+        // Newer than the file, which is only updated on save.
+        std::istringstream fin( evicted->second );
+        parse( fin );
+        evicted_quads.erase( evicted );
+        read = true;
+    } else if( take_prefetched_quad( quad_path, prefetched ) ) {
+        std::istringstream fin( prefetched );
+        parse( fin );
+        read = true;
+    } else {
+        read = read_from_file_optional( quad_path, parse );
+    }
+    if( !read ) {
         // If it doesn't exist, trigger generating it.
         return nullptr;
     }
-    if( submaps.count( p ) == 0 ) {
+    const auto iter = submaps.find( p );
+    if( iter == submaps.end() ) {
         debugmsg( "file %s did not contain the expected submap %d,%d,%d",
                   quad_path, p.x, p.y, p.z );
         return nullptr;
     }
-    return submaps[ p ];
+    return iter->second;
+}
+
+void mapbuffer::deserialize_binary( std::istream &fin )
+{
+    // The magic has already been consumed by the caller.
+    binary_reader in( fin );
+    const uint32_t version = in.read_u32();
+    if( version != binary_quad_version ) {
+        throw std::runtime_error( string_format( "unsupported binary map version %d", version ) );
+    }
+    const uint32_t count = in.read_u32();
+    for( uint32_t i = 0; i < count; i++ ) {
+        tripoint submap_coordinates;
+        std::unique_ptr<submap> sm = load_binary_submap( in, submap_coordinates );
+        if( !add_submap( submap_coordinates, sm ) ) {
+            debugmsg( "submap %d,%d,%d was already loaded", submap_coordinates.x, submap_coordinates.y,
+                      submap_coordinates.z );
+        }
+    }
 }
 
 void mapbuffer::deserialize( JsonIn &jsin )
@@ -2,15 +2,19 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <iosfwd>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "point.h"
 
 class submap;
 class JsonIn;
+struct quad_reader;
+struct quad_writer;
 
 /**
  * Store, buffer, save and load the entire world map.
@@ -22,11 +26,33 @@ class mapbuffer
         ~mapbuffer();
 
         /** Store all submaps in this instance into savefiles.
+         * The submaps are serialized right away, but the files are written by a
+         * background thread, see @ref finish_pending_writes.
+         * Quads that are identical to what was last written are not written again.
          * @param delete_after_save If true, the saved submaps are removed
          * from the mapbuffer (and deleted).
          **/
         void save( bool delete_after_save = false );
 
+        /** Wait until the files of the last @ref save have been written.
+         * Reports any write failures to the user. **/
+        void finish_pending_writes();
+
+        /** Start reading the quad files of the submaps from @p sm_min to @p sm_max (inclusive,
+         * absolute submap coordinates) on a background thread, in the order @ref map::load
+         * asks for them. Loading those submaps then only has to parse what was read.
+         * Quads that are already in memory are skipped. **/
+        void prefetch_quads( const tripoint &sm_min, const tripoint &sm_max );
+
+        /** Stop reading ahead and drop whatever @ref prefetch_quads read but was not used. **/
+        void discard_prefetched_quads();
+
+        /** If more than @p max_submaps submaps are held, serialize the quads outside of the
+         * current map and free their submaps. The serialized quads are kept in memory
+         * until the next @ref save writes them, and are read back from there when needed.
+         * Must not be called while submaps outside of the map are in use elsewhere. **/
+        void evict_distant( size_t max_submaps );
+
         /** Delete all buffered submaps. **/
         void reset();
 
@@ -54,8 +80,16 @@ class mapbuffer
          */
         submap *lookup_submap( const tripoint &p );
 
+        /** Whether the submap at @p p is currently held in memory. Never loads anything. */
+        bool is_submap_loaded( const tripoint &p ) const;
+
+        /** Approximate bytes held by the buffered submaps and the items on them. */
+        size_t memory_usage() const;
+
     private:
-        using submap_map_t = std::map<tripoint, submap *>;
+        // Hashed for constant time lookups, the buffer regularly holds many thousands of submaps.
+        // Iteration order is unspecified, @ref save sorts the addresses itself.
+        using submap_map_t = std::unordered_map<tripoint, submap *>;
 
     public:
         inline submap_map_t::iterator begin() {
@@ -64,17 +98,37 @@ class mapbuffer
         inline submap_map_t::iterator end() {
             return submaps.end();
         }
+        inline size_t size() const {
+            return submaps.size();
+        }
 
     private:
         // There's a very good reason this is private,
         // if not handled carefully, this can erase in-use submaps and crash the game.
         void remove_submap( tripoint addr );
         submap *unserialize_submaps( const tripoint &p );
+        bool take_prefetched_quad( const std::string &path, std::string &contents );
         void deserialize( JsonIn &jsin );
+        void deserialize_binary( std::istream &fin );
         void save_quad( const std::string &dirname, const std::string &filename,
                         const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
                         bool delete_after_save );
+        /** Serializes the quad at @p om_addr into @p contents and lists its loaded submaps
+         * in @p quad_submaps. Returns false if the quad is uniform and needs no file. */
+        bool serialize_quad( const tripoint &om_addr, std::list<tripoint> &quad_submaps,
+                             std::string &contents );
+        void queue_quad_write( const std::string &dirname, const std::string &filename,
+                               std::string contents );
         submap_map_t submaps;
+        /** Files of the last @ref save that may still be in the process of being written. */
+        std::unique_ptr<quad_writer> writer;
+        /** Quad files being read ahead by @ref prefetch_quads. */
+        std::unique_ptr<quad_reader> reader;
+        /** Hash of the contents last written to each quad file, by path. */
+        std::unordered_map<std::string, size_t> written_quad_hashes;
+        /** Serialized quads freed by @ref evict_distant since the last save, by overmap
+         * terrain address. */
+        std::map<tripoint, std::string> evicted_quads;
 };
 
 extern mapbuffer MAPBUFFER;
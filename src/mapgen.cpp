@@ -15,6 +15,7 @@
 
 #include "basecamp.h"
 #include "calendar.h"
+#include "cata_utility.h"
 #include "catacharset.h"
 #include "character_id.h"
 #include "clzones.h"
@@ -110,6 +111,20 @@ void map::generate( const tripoint &p, const time_point &when )
 
     set_abs_sub( p );
 
+    // Nothing reads the caches of the map being generated, so don't update them tile by tile
+    defer_cache_invalidation = true;
+    on_out_of_scope invalidate_caches( [&]() {
+        defer_cache_invalidation = false;
+        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+            // A level cache that was never created has nothing stale in it
+            if( caches[z + OVERMAP_DEPTH] ) {
+                invalidate_map_cache( z );
+                get_cache( z ).map_memory_seen_cache.reset();
+            }
+            set_pathfinding_cache_dirty( z );
+        }
+    } );
+
     // First we have to create new submaps and initialize them to 0 all over
     // We create all the submaps, even if we're not a tinymap, so that map
     //  generation which overflows won't cause a crash.  At the bottom of this
@@ -2358,6 +2373,20 @@ void mapgen_function_json::setup()
 void mapgen_function_json_nested::setup()
 {
     setup_common();
+    deterministic = setmap_points.empty() && objects.empty();
+    rendered_format.clear();
+    if( !deterministic || !do_format ) {
+        return;
+    }
+    for( int y = 0; y < mapgensize.y; y++ ) {
+        for( int x = 0; x < mapgensize.x; x++ ) {
+            const point p( x, y );
+            const ter_furn_id &tdata = format[calc_index( p )];
+            if( tdata.ter != t_null || tdata.furn != f_null ) {
+                rendered_format.emplace_back( p, tdata );
+            }
+        }
+    }
 }
 
 void update_mapgen_function_json::setup()
@@ -2820,6 +2849,29 @@ void mapgen_function_json_nested::nest( mapgendata &dat, const point &offset ) c
     // TODO: Make rotation work for submaps, then pass this value into elem & objects apply.
     //int chosen_rotation = rotation.get() % 4;
 
+    if( deterministic ) {
+        // Nothing but the format was placed, so only those tiles can need resolving. Whatever
+        // the parent placed is resolved when the parent finishes.
+        const region_terrain_and_furniture_settings &region_tf =
+            dat.region.region_terrain_and_furniture;
+        for( const std::pair<point, ter_furn_id> &tile : rendered_format ) {
+            const point map_pos = tile.first + offset;
+            const ter_furn_id &tdata = tile.second;
+            const ter_id ter = tdata.ter != t_null ? region_tf.resolve( tdata.ter ) : t_null;
+            const furn_id furn = tdata.furn != f_null ? region_tf.resolve( tdata.furn ) : f_null;
+            if( furn != f_null ) {
+                if( ter != t_null ) {
+                    dat.m.set( map_pos, ter, furn );
+                } else {
+                    dat.m.furn_set( map_pos, furn );
+                }
+            } else {
+                dat.m.ter_set( map_pos, ter );
+            }
+        }
+        return;
+    }
+
     if( do_format ) {
         formatted_set_incredibly_simple( dat.m, offset );
     }
@@ -5858,8 +5910,7 @@ std::vector<item *> map::place_items( const item_group_id &loc, const int chance
 std::vector<item *> map::put_items_from_loc( const item_group_id &loc, const tripoint &p,
         const time_point &turn )
 {
-    const auto items = item_group::items_from( loc, turn );
-    return spawn_items( p, items );
+    return spawn_items( p, item_group::items_from( loc, turn ) );
 }
 
 void map::add_spawn( const mtype_id &type, int count, const tripoint &p, bool friendly,
@@ -6008,20 +6059,8 @@ std::unique_ptr<vehicle> map::add_vehicle_to_map(
             wreckage->pos = other_veh->pos;
             wreckage->sm_pos = other_veh->sm_pos;
 
-            //Where are we on the global scale?
-            const tripoint global_pos = wreckage->global_pos3();
-
-            for( auto &part : veh->parts ) {
-                const tripoint part_pos = veh->global_part_pos3( part ) - global_pos;
-                // TODO: change mount points to be tripoint
-                wreckage->install_part( part_pos.xy(), part );
-            }
-
-            for( auto &part : other_veh->parts ) {
-                const tripoint part_pos = other_veh->global_part_pos3( part ) - global_pos;
-                wreckage->install_part( part_pos.xy(), part );
-
-            }
+            wreckage->install_parts_from( *veh );
+            wreckage->install_parts_from( *other_veh );
 
             wreckage->name = _( "Wreckage" );
 
@@ -297,6 +297,10 @@ struct jmapgen_objects {
          **/
         bool has_vehicle_collision( mapgendata &dat, const point &offset ) const;
 
+        bool empty() const {
+            return objects.empty();
+        }
+
     private:
         /**
          * Combination of where to place something and what to place.
@@ -396,6 +400,13 @@ class mapgen_function_json_nested : public mapgen_function_json_base
 
     private:
         jmapgen_int rotation;
+        /**
+         * Set in @ref setup for nested mapgen that consists only of a format (no setmap and
+         * no objects), so its output is the same every time. The non-null tiles of the format
+         * are then stored in @ref rendered_format and blitted directly.
+         */
+        bool deterministic = false;
+        std::vector<std::pair<point, ter_furn_id>> rendered_format;
 };
 
 /////////////////////////////////////////////////////////
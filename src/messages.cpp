@@ -194,7 +194,7 @@ class messages_impl
                 messages.pop_front();
             }
 
-            messages.emplace_back( m );
+            messages.emplace_back( std::move( m ) );
         }
 
         /** Check if the current message needs to be prevented (hidden) or not from being displayed in the side bar.
@@ -453,6 +453,8 @@ class dialog
 
         // Message indices and folded strings
         std::vector<std::pair<size_t, std::string>> folded_all;
+        // msg_width the messages in folded_all were folded to
+        int folded_width = 0;
         // Indices of filtered messages
         std::vector<size_t> folded_filtered;
 
@@ -520,18 +522,19 @@ void Messages::dialog::init( ui_adaptor &ui )
     filter.window( w_filter_help, point( border_width + 2, w_fh_height - 1 ),
                    w_fh_width - border_width - 2 );
 
-    // Initialize folded messages
-    folded_all.clear();
-    folded_filtered.clear();
-    const size_t msg_count = size();
-    for( size_t ind = 0; ind < msg_count; ++ind ) {
-        const size_t msg_ind = log_from_top ? ind : msg_count - 1 - ind;
-        const game_message &msg = player_messages.history( msg_ind );
-        const auto &folded = foldstring( msg.get_with_count(), msg_width );
-        for( const auto &it : folded ) {
-            folded_filtered.emplace_back( folded_all.size() );
-            folded_all.emplace_back( msg_ind, it );
+    // Initialize folded messages. The log can't change while the dialog is open,
+    // so they only need to be folded again if the width changed on resize.
+    if( first_init || msg_width != folded_width ) {
+        folded_all.clear();
+        const size_t msg_count = size();
+        for( size_t ind = 0; ind < msg_count; ++ind ) {
+            const size_t msg_ind = log_from_top ? ind : msg_count - 1 - ind;
+            const game_message &msg = player_messages.history( msg_ind );
+            for( std::string &it : foldstring( msg.get_with_count(), msg_width ) ) {
+                folded_all.emplace_back( msg_ind, std::move( it ) );
+            }
         }
+        folded_width = msg_width;
     }
 
     do_filter( filter_str );
@@ -665,7 +668,8 @@ void Messages::dialog::do_filter( const std::string &filter_str )
         const size_t msg_ind = folded_all[folded_ind].first;
         const game_message &msg = player_messages.history( msg_ind );
         const bool match = ( !has_type_filter || filter_type == msg.type ) &&
-                           ci_find_substr( remove_color_tags( msg.get_with_count() ), filter_text ) >= 0;
+                           ( filter_text.empty() ||
+                             ci_find_substr( remove_color_tags( msg.get_with_count() ), filter_text ) >= 0 );
 
         // Always advance the index, but only add to filtered list if the original message matches
         for( ; folded_ind < folded_all.size() && folded_all[folded_ind].first == msg_ind; ++folded_ind ) {
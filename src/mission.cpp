@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <istream>
 #include <iterator>
 #include <list>
@@ -9,6 +10,7 @@
 #include <numeric>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "avatar.h"
 #include "creature.h"
@@ -61,6 +63,30 @@ std::string mission_type::tname() const
 
 static std::unordered_map<int, mission> world_missions;
 
+/**
+ * Missions only need processing while in progress, and then only for two reasons: their
+ * deadline passing, or being complete without a giver to report to. The first are kept in a
+ * min-heap of (deadline, uid), the second in a plain list. Entries of missions that have
+ * since ended are dropped when they come up.
+ */
+/**@{*/
+using deadline_entry = std::pair<time_point, int>;
+static std::vector<deadline_entry> mission_deadlines;
+static std::vector<int> giverless_missions;
+/**@}*/
+
+static void track_in_progress( const mission &m )
+{
+    if( m.get_deadline() > calendar::start_of_cataclysm ) {
+        mission_deadlines.emplace_back( m.get_deadline(), m.get_id() );
+        std::push_heap( mission_deadlines.begin(), mission_deadlines.end(),
+                        std::greater<deadline_entry>() );
+    }
+    if( !m.get_npc_id().is_valid() ) {
+        giverless_missions.push_back( m.get_id() );
+    }
+}
+
 mission *mission::reserve_new( const mission_type_id &type, const character_id &npc_id )
 {
     const auto tmp = mission_type::get( type )->create( npc_id );
@@ -93,13 +119,40 @@ std::vector<mission *> mission::get_all_active()
 void mission::add_existing( const mission &m )
 {
     world_missions[ m.uid ] = m;
+    if( m.in_progress() ) {
+        track_in_progress( m );
+    }
 }
 
 void mission::process_all()
 {
-    for( auto &e : world_missions ) {
-        e.second.process();
+    while( !mission_deadlines.empty() && calendar::turn > mission_deadlines.front().first ) {
+        const int id = mission_deadlines.front().second;
+        std::pop_heap( mission_deadlines.begin(), mission_deadlines.end(),
+                       std::greater<deadline_entry>() );
+        mission_deadlines.pop_back();
+        const auto iter = world_missions.find( id );
+        if( iter != world_missions.end() ) {
+            iter->second.process();
+        }
+    }
+
+    if( giverless_missions.empty() ) {
+        return;
+    }
+    // Wrapping up may start a follow up mission, which adds to the list.
+    const std::vector<int> candidates = giverless_missions;
+    for( const int id : candidates ) {
+        const auto iter = world_missions.find( id );
+        if( iter != world_missions.end() ) {
+            iter->second.process();
+        }
     }
+    giverless_missions.erase( std::remove_if( giverless_missions.begin(), giverless_missions.end(),
+    []( const int id ) {
+        const auto iter = world_missions.find( id );
+        return iter == world_missions.end() || !iter->second.in_progress();
+    } ), giverless_missions.end() );
 }
 
 std::vector<mission *> mission::to_ptr_vector( const std::vector<int> &vec )
@@ -127,6 +180,8 @@ std::vector<int> mission::to_uid_vector( const std::vector<mission *> &vec )
 void mission::clear_all()
 {
     world_missions.clear();
+    mission_deadlines.clear();
+    giverless_missions.clear();
 }
 
 void mission::on_creature_death( Creature &poor_dead_dude )
@@ -229,6 +284,7 @@ void mission::assign( avatar &u )
         }
         type->start( this );
         status = mission_status::in_progress;
+        track_in_progress( *this );
     }
 }
 
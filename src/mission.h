@@ -425,7 +425,8 @@ class mission
          */
         static void clear_all();
         /**
-         * Handles mission deadline processing.
+         * Handles mission deadline processing. Only looks at missions whose deadline has
+         * passed or that have no giver, so it costs next to nothing on most turns.
          */
         static void process_all();
 
@@ -33,6 +33,7 @@
 #include "monster_oracle.h"
 #include "mtype.h"
 #include "npc.h"
+#include "optional.h"
 #include "pathfinding.h"
 #include "pimpl.h"
 #include "player.h"
@@ -306,6 +307,19 @@ void monster::plan()
     bool smart_planning = has_flag( MF_PRIORITIZE_TARGETS );
     Creature *target = nullptr;
     int max_sight_range = std::max( type->vision_day, type->vision_night );
+    // Nothing further away than this can be seen (see Creature::sees), so other monsters
+    // are only looked up within that radius instead of scanning all of them.
+    std::vector<shared_ptr_fast<monster>> nearby_monsters_cache;
+    bool nearby_monsters_cached = false;
+    const auto nearby_monsters = [&]() -> const std::vector<shared_ptr_fast<monster>> & {
+        if( !nearby_monsters_cached )
+        {
+            nearby_monsters_cache = g->critter_tracker->find_in_radius( pos(),
+                                    std::max( max_sight_range, 1 ) );
+            nearby_monsters_cached = true;
+        }
+        return nearby_monsters_cache;
+    };
     // 8.6f is rating for tank drone 60 tiles away, moose 16 or boomer 33
     float dist = !smart_planning ? max_sight_range : 8.6f;
     bool fleeing = false;
@@ -361,7 +375,8 @@ void monster::plan()
             }
         }
     } else if( friendly != 0 && !docile && !waiting ) {
-        for( monster &tmp : g->all_monsters() ) {
+        for( const shared_ptr_fast<monster> &shared : nearby_monsters() ) {
+            monster &tmp = *shared;
             if( tmp.friendly == 0 ) {
                 float rating = rate_target( tmp, dist, smart_planning );
                 if( rating < dist ) {
@@ -434,35 +449,32 @@ void monster::plan()
 
     fleeing = fleeing || ( mood == MATT_FLEE );
     if( friendly == 0 ) {
-        for( const auto &fac : factions ) {
-            auto faction_att = faction.obj().attitude( fac.first );
+        static const mfaction_str_id playerfaction( "player" );
+        for( const shared_ptr_fast<monster> &shared : nearby_monsters() ) {
+            monster &mon = *shared;
+            // Same grouping as the tracker's faction map.
+            const mfaction_id mon_faction = mon.friendly == 0 ? mon.faction : playerfaction.id();
+            auto faction_att = faction.obj().attitude( mon_faction );
             if( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY ) {
                 continue;
             }
 
-            for( const weak_ptr_fast<monster> &weak : fac.second ) {
-                const shared_ptr_fast<monster> shared = weak.lock();
-                if( !shared ) {
-                    continue;
-                }
-                monster &mon = *shared;
-                float rating = rate_target( mon, dist, smart_planning );
-                if( rating == dist ) {
-                    ++valid_targets;
-                    if( one_in( valid_targets ) ) {
-                        target = &mon;
-                    }
-                }
-                if( rating < dist ) {
+            float rating = rate_target( mon, dist, smart_planning );
+            if( rating == dist ) {
+                ++valid_targets;
+                if( one_in( valid_targets ) ) {
                     target = &mon;
-                    dist = rating;
-                    valid_targets = 1;
-                }
-                if( rating <= 5 ) {
-                    anger += angers_hostile_near;
-                    morale -= fears_hostile_near;
                 }
             }
+            if( rating < dist ) {
+                target = &mon;
+                dist = rating;
+                valid_targets = 1;
+            }
+            if( rating <= 5 ) {
+                anger += angers_hostile_near;
+                morale -= fears_hostile_near;
+            }
         }
     }
 
@@ -673,36 +685,45 @@ void monster::move()
     tripoint drag_to = g->m.getabs( pos() );
 
     const bool pacified = has_effect( effect_pacified );
+    // Most of the time every attack is still cooling down, which is cheap to see by walking
+    // our own attacks, so only then look each of them up by name below.
+    const bool attack_ready = !pacified && !is_hallucination() &&
+                              std::any_of( special_attacks.begin(), special_attacks.end(),
+    []( const std::pair<const std::string, mon_special_attack> & sp ) {
+        return sp.second.enabled && sp.second.cooldown == 0;
+    } );
 
     // First, use the special attack, if we can!
     // The attack may change `monster::special_attacks` (e.g. by transforming
     // this into another monster type). Therefore we can not iterate over it
     // directly and instead iterate over the map from the monster type
     // (properties of monster types should never change).
-    for( const auto &sp_type : type->special_attacks ) {
-        const std::string &special_name = sp_type.first;
-        const auto local_iter = special_attacks.find( special_name );
-        if( local_iter == special_attacks.end() ) {
-            continue;
-        }
-        mon_special_attack &local_attack_data = local_iter->second;
-        if( !local_attack_data.enabled ) {
-            continue;
-        }
-
-        // Cooldowns are decremented in monster::process_turn
-
-        if( local_attack_data.cooldown == 0 && !pacified && !is_hallucination() ) {
-            if( !sp_type.second->call( *this ) ) {
+    if( attack_ready ) {
+        for( const auto &sp_type : type->special_attacks ) {
+            const std::string &special_name = sp_type.first;
+            const auto local_iter = special_attacks.find( special_name );
+            if( local_iter == special_attacks.end() ) {
                 continue;
             }
-
-            // `special_attacks` might have changed at this point. Sadly `reset_special`
-            // doesn't check the attack name, so we need to do it here.
-            if( special_attacks.count( special_name ) == 0 ) {
+            mon_special_attack &local_attack_data = local_iter->second;
+            if( !local_attack_data.enabled ) {
                 continue;
             }
-            reset_special( special_name );
+
+            // Cooldowns are decremented in monster::process_turn
+
+            if( local_attack_data.cooldown == 0 ) {
+                if( !sp_type.second->call( *this ) ) {
+                    continue;
+                }
+
+                // `special_attacks` might have changed at this point. Sadly `reset_special`
+                // doesn't check the attack name, so we need to do it here.
+                if( special_attacks.count( special_name ) == 0 ) {
+                    continue;
+                }
+                reset_special( special_name );
+            }
         }
     }
 
@@ -1156,20 +1177,18 @@ tripoint monster::scent_move()
     }
 
     const bool fleeing = is_fleeing( g->u );
+    const int smell_here = g->scent.get( pos() );
     if( fleeing ) {
-        bestsmell = g->scent.get( pos() );
+        bestsmell = smell_here;
     }
 
     tripoint next( -1, -1, posz() );
-    if( ( !fleeing && g->scent.get( pos() ) > smell_threshold ) ||
+    if( ( !fleeing && smell_here > smell_threshold ) ||
         ( fleeing && bestsmell == 0 ) ) {
         return next;
     }
-    const bool can_bash = bash_skill() > 0;
-    for( const auto &dest : g->m.points_in_radius( pos(), 1, SCENT_MAP_Z_REACH ) ) {
-        int smell = g->scent.get( dest );
-        const scenttype_id &type_scent = g->scent.get_type( dest );
 
+    const auto follows_scent = [&]( const scenttype_id & type_scent ) {
         bool right_scent = false;
         // is the monster tracking this scent
         if( !tracked_scents.empty() ) {
@@ -1190,6 +1209,25 @@ tripoint monster::scent_move()
         if( !ignored_scents.empty() && ( ignored_scents.find( type_scent ) != ignored_scents.end() ) ) {
             right_scent = false;
         }
+        return right_scent;
+    };
+    // A tile either has no scent type or the one type of the whole scent map, so the answer
+    // for each is worked out once instead of for every tile.
+    const bool follows_no_scent = follows_scent( scenttype_id() );
+    cata::optional<bool> follows_map_scent;
+
+    const bool can_bash = bash_skill() > 0;
+    for( const auto &dest : g->m.points_in_radius( pos(), 1, SCENT_MAP_Z_REACH ) ) {
+        scenttype_id type_scent;
+        const int smell = g->scent.get( dest, type_scent );
+
+        bool right_scent = follows_no_scent;
+        if( !type_scent.is_empty() ) {
+            if( !follows_map_scent ) {
+                follows_map_scent = follows_scent( type_scent );
+            }
+            right_scent = *follows_map_scent;
+        }
 
         if( ( !fleeing && smell < bestsmell ) || ( fleeing && smell > bestsmell ) || !right_scent ) {
             continue;
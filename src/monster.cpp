@@ -2371,10 +2371,10 @@ void monster::drop_items_on_death()
         if( remaining.empty() ) {
             return;
         }
-        items = remaining;
+        items = std::move( remaining );
     }
 
-    const auto dropped = g->m.spawn_items( pos(), items );
+    const auto dropped = g->m.spawn_items( pos(), std::move( items ) );
 
     if( has_flag( MF_FILTHY ) && get_option<bool>( "FILTHY_CLOTHES" ) ) {
         for( const auto &it : dropped ) {
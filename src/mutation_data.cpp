@@ -464,7 +464,11 @@ void mutation_branch::load( const JsonObject &jo, const std::string & )
         int neutral = wp.get_int( "neutral", 0 );
         int good = wp.get_int( "good", 0 );
         tripoint protect = tripoint( ignored, neutral, good );
-        protection[get_body_part_token( part_id )] = protect;
+        const body_part bp = get_body_part_token( part_id );
+        if( bp >= num_bp ) {
+            wp.throw_error( "invalid body part", "part" );
+        }
+        protection[bp] = protect;
     }
 
     for( JsonArray ea : jo.get_array( "encumbrance_always" ) ) {
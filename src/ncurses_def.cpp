@@ -47,7 +47,11 @@ void catacurses::wnoutrefresh( const window &win )
 
 void catacurses::wrefresh( const window &win )
 {
-    return curses_check_result( ::wrefresh( win.get<::WINDOW>() ), OK, "wrefresh" );
+    // Only stage the window in the virtual screen. The terminal is updated once by
+    // doupdate(), which runs before waiting for input and from refresh_display().
+    // That way windows redrawn below others in the same frame don't get sent out
+    // to the terminal only to be overwritten right after.
+    return curses_check_result( ::wnoutrefresh( win.get<::WINDOW>() ), OK, "wrefresh" );
 }
 
 void catacurses::werase( const window &win )
@@ -1230,18 +1230,18 @@ void npc::form_opinion( const player &u )
     }
 
     // is your health low
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_player_character().get_body() ) {
-        const int hp_max = elem.second.get_hp_max();
-        const int hp_cur = elem.second.get_hp_cur();
+    for( const bodypart &elem : get_player_character().get_body() ) {
+        const int hp_max = elem.get_hp_max();
+        const int hp_cur = elem.get_hp_cur();
         if( hp_cur <= hp_max / 2 ) {
             op_of_u.fear--;
         }
     }
 
     // is my health low
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-        const int hp_max = elem.second.get_hp_max();
-        const int hp_cur = elem.second.get_hp_cur();
+    for( const bodypart &elem : get_body() ) {
+        const int hp_max = elem.get_hp_max();
+        const int hp_cur = elem.get_hp_cur();
         if( hp_cur <= hp_max / 2 ) {
             op_of_u.fear++;
         }
@@ -1303,8 +1303,8 @@ void npc::form_opinion( const player &u )
 
     // VALUE
     op_of_u.value = 0;
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-        if( elem.second.get_hp_cur() < elem.second.get_hp_max() * 0.8f ) {
+    for( const bodypart &elem : get_body() ) {
+        if( elem.get_hp_cur() < elem.get_hp_max() * 0.8f ) {
             op_of_u.value++;
         }
     }
@@ -1745,7 +1745,7 @@ int npc::value( const item &it, int market_price ) const
     }
 
     int ret = 0;
-    // TODO: Cache own weapon value (it can be a bit expensive to compute 50 times/turn)
+    // The value of our own weapon is cached by player::weapon_value
     double weapon_val = weapon_value( it ) - weapon_value( weapon );
     if( weapon_val > 0 ) {
         ret += weapon_val;
@@ -408,19 +408,19 @@ void npc::assess_danger()
         cur_threat_map[ threat_dir ] = 0.25f * ai_cache.threat_map[ threat_dir ];
     }
     // first, check if we're about to be consumed by fire
-    // TODO: Use the field cache
-    for( const tripoint &pt : g->m.points_in_radius( pos(), 6 ) ) {
-        if( pt == pos() || g->m.has_flag( TFLAG_FIRE_CONTAINER,  pt ) ) {
+    // the field cache lets us skip the scan entirely when no submap nearby has fields
+    const bool fields_near = g->m.may_have_fields_near( pos(), 6 );
+    for( const tripoint &pt : g->m.points_in_radius( pos(), fields_near ? 6 : 0 ) ) {
+        if( pt == pos() || g->m.get_field( pt, fd_fire ) == nullptr ||
+            g->m.has_flag( TFLAG_FIRE_CONTAINER,  pt ) ) {
             continue;
         }
-        if( g->m.get_field( pt, fd_fire ) != nullptr ) {
-            int dist = rl_dist( pos(), pt );
-            cur_threat_map[direction_from( pos(), pt )] += 2.0f * ( NPC_DANGER_MAX - dist );
-            if( dist < 3 && !has_effect( effect_npc_fire_bad ) ) {
-                warn_about( "fire_bad", 1_minutes );
-                add_effect( effect_npc_fire_bad, 5_turns );
-                path.clear();
-            }
+        int dist = rl_dist( pos(), pt );
+        cur_threat_map[direction_from( pos(), pt )] += 2.0f * ( NPC_DANGER_MAX - dist );
+        if( dist < 3 && !has_effect( effect_npc_fire_bad ) ) {
+            warn_about( "fire_bad", 1_minutes );
+            add_effect( effect_npc_fire_bad, 5_turns );
+            path.clear();
         }
     }
 
@@ -1735,33 +1735,33 @@ healing_options npc::patient_assessment( const Character &c )
     healing_options try_to_fix;
     try_to_fix.clear_all();
 
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : c.get_body() ) {
+    for( const bodypart &elem : c.get_body() ) {
 
-        if( c.has_effect( effect_bleed, elem.first->token ) ) {
+        if( c.has_effect( effect_bleed, elem.get_id()->token ) ) {
             try_to_fix.bleed = true;
         }
 
-        if( c.has_effect( effect_bite, elem.first->token ) ) {
+        if( c.has_effect( effect_bite, elem.get_id()->token ) ) {
             try_to_fix.bite = true;
         }
 
-        if( c.has_effect( effect_infected, elem.first->token ) ) {
+        if( c.has_effect( effect_infected, elem.get_id()->token ) ) {
             try_to_fix.infect = true;
         }
         int part_threshold = 75;
-        if( elem.first == bodypart_str_id( "head" ) ) {
+        if( elem.get_id() == bodypart_str_id( "head" ) ) {
             part_threshold += 20;
-        } else if( elem.first == bodypart_str_id( "torso" ) ) {
+        } else if( elem.get_id() == bodypart_str_id( "torso" ) ) {
             part_threshold += 10;
         }
         part_threshold = std::min( 80, part_threshold );
-        part_threshold = part_threshold * elem.second.get_hp_max() / 100;
+        part_threshold = part_threshold * elem.get_hp_max() / 100;
 
-        if( elem.second.get_hp_cur() <= part_threshold ) {
-            if( !c.has_effect( effect_bandaged, elem.first->token ) ) {
+        if( elem.get_hp_cur() <= part_threshold ) {
+            if( !c.has_effect( effect_bandaged, elem.get_id()->token ) ) {
                 try_to_fix.bandage = true;
             }
-            if( !c.has_effect( effect_disinfected, elem.first->token ) ) {
+            if( !c.has_effect( effect_disinfected, elem.get_id()->token ) ) {
                 try_to_fix.disinfect = true;
             }
         }
@@ -2783,21 +2783,27 @@ void npc::find_item()
         return;
     }
 
+    // Looked up on the first item considered instead of once per item.
+    std::vector<npc *> followers;
+    bool followers_found = false;
     const auto consider_item =
-        [&wanted, &best_value, whitelisting, volume_allowed, weight_allowed, this]
+        [&wanted, &best_value, &followers, &followers_found, whitelisting, volume_allowed,
+                  weight_allowed, this]
     ( const item & it, const tripoint & p ) {
         if( it.made_of( LIQUID ) ) {
             // Don't even consider liquids.
             return;
         }
-        std::vector<npc *> followers;
-        for( auto &elem : g->get_follower_list() ) {
-            shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
-            if( !npc_to_get ) {
-                continue;
+        if( !followers_found ) {
+            followers_found = true;
+            for( auto &elem : g->get_follower_list() ) {
+                shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
+                if( !npc_to_get ) {
+                    continue;
+                }
+                npc *npc_to_add = npc_to_get.get();
+                followers.push_back( npc_to_add );
             }
-            npc *npc_to_add = npc_to_get.get();
-            followers.push_back( npc_to_add );
         }
         for( auto &elem : followers ) {
             if( !it.is_owned_by( *this, true ) && ( g->u.sees( this->pos() ) || g->u.sees( wanted_item_pos ) ||
@@ -2840,14 +2846,18 @@ void npc::find_item()
         }
     };
 
+    // Only look for the zone on each tile if there is one in range at all.
+    const bool check_no_pickup = is_player_ally() &&
+                                 zone_manager::get_manager().has_near( zone_type_no_npc_pickup,
+                                         global_square_location(), range );
+    const tripoint abs_offset = global_square_location() - pos();
     for( const tripoint &p : closest_tripoints_first( pos(), range ) ) {
         // TODO: Make this sight check not overdraw nearby tiles
-        // TODO: Optimize that zone check
-        if( is_player_ally() && g->check_zone( zone_type_no_npc_pickup, p ) ) {
+        if( check_no_pickup && g->check_zone( zone_type_no_npc_pickup, p ) ) {
             continue;
         }
 
-        const tripoint abs_p = global_square_location() - pos() + p;
+        const tripoint abs_p = abs_offset + p;
         const int prev_num_items = ai_cache.searched_tiles.get( abs_p, -1 );
         // Prefetch the number of items present so we can bail out if we already checked here.
         const map_stack m_stack = g->m.i_at( p );
@@ -3116,12 +3126,13 @@ void npc::drop_items( units::mass drop_weight, units::volume drop_volume, int mi
         item &it = slice[i]->front();
         double wgt_ratio = 0.0;
         double vol_ratio = 0.0;
-        if( value( it ) == 0 || value( it ) <= min_val ) {
+        const int it_value = value( it );
+        if( it_value == 0 || it_value <= min_val ) {
             wgt_ratio = 99999;
             vol_ratio = 99999;
         } else {
-            wgt_ratio = units::to_gram<double>( it.weight() ) / value( it );
-            vol_ratio = units::to_liter( it.volume() / value( it ) );
+            wgt_ratio = units::to_gram<double>( it.weight() ) / it_value;
+            vol_ratio = units::to_liter( it.volume() / it_value );
         }
         bool added_wgt = false;
         bool added_vol = false;
@@ -3917,10 +3928,11 @@ void npc::mug_player( player &mark )
     invslice slice = mark.inv.slice();
     for( std::list<item> *stack : slice ) {
         item &front_stack = stack->front();
-        if( value( front_stack ) >= best_value &&
+        const int front_value = value( front_stack );
+        if( front_value >= best_value &&
             can_pickVolume( front_stack, true ) &&
             can_pickWeight( front_stack, true ) ) {
-            best_value = value( front_stack );
+            best_value = front_value;
             to_steal = &front_stack;
         }
     }
@@ -4563,8 +4575,8 @@ bool npc::adjust_worn()
     }
     const auto covers_broken = [this]( const item & it, side s ) {
         const body_part_set covered = it.get_covered_body_parts( s );
-        for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-            if( elem.second.get_hp_cur() <= 0 && covered.test( elem.first->token ) ) {
+        for( const bodypart &elem : get_body() ) {
+            if( elem.get_hp_cur() <= 0 && covered.test( elem.get_id()->token ) ) {
                 return true;
             }
         }
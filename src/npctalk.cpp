@@ -1657,6 +1657,8 @@ talk_data talk_response::create_option_line( const dialogue &d, const char lette
 {
     std::string ftext;
     text = ( truefalse_condition( d ) ? truetext : falsetext ).translated();
+    // the trial may test conditions, so only calculate its chance once per line
+    const int chance = trial.calc_chance( d );
     // dialogue w/ a % chance to work
     if( trial.type == TALK_TRIAL_NONE || trial.type == TALK_TRIAL_CONDITION ) {
         // regular dialogue
@@ -1666,12 +1668,12 @@ talk_data talk_response::create_option_line( const dialogue &d, const char lette
         // dialogue w/ a % chance to work
         //~ %1$s is translated trial type, %2$d is a number, and %3$s is the translated response text
         ftext = string_format( pgettext( "talk option", "[%1$s %2$d%%] %3$s" ), trial.name(),
-                               trial.calc_chance( d ), text );
+                               chance, text );
     }
     parse_tags( ftext, *d.alpha, *d.beta, success.next_topic.item_type );
 
     nc_color color;
-    std::set<dialogue_consequence> consequences = get_consequences( d );
+    std::set<dialogue_consequence> consequences = get_consequences( d, chance );
     if( consequences.count( dialogue_consequence::hostile ) > 0 ) {
         color = c_red;
     } else if( text[0] == '*' || consequences.count( dialogue_consequence::helpless ) > 0 ) {
@@ -1686,7 +1688,12 @@ talk_data talk_response::create_option_line( const dialogue &d, const char lette
 
 std::set<dialogue_consequence> talk_response::get_consequences( const dialogue &d ) const
 {
-    int chance = trial.calc_chance( d );
+    return get_consequences( d, trial.calc_chance( d ) );
+}
+
+std::set<dialogue_consequence> talk_response::get_consequences( const dialogue &d,
+        const int chance ) const
+{
     if( chance >= 100 ) {
         return { success.get_consequence( d ) };
     } else if( chance <= 0 ) {
@@ -2055,6 +2055,11 @@ void options_manager::add_options_debug()
          false
        );
 
+    add( "SKIP_VERIFIED_DATA_CHECKS", "debug", translate_marker( "Skip repeated data checks" ),
+         translate_marker( "If true, the slower read-only consistency checks of the game data are skipped when the exact same data and game version already passed them without errors.  Speeds up startup, but don't use this while working on the game itself." ),
+         false
+       );
+
     add_empty_line();
 
     add_option_group( "debug", Group( "debug_log", to_translation( "Logging" ),
@@ -2179,6 +2184,17 @@ void options_manager::add_options_world_default()
     }, "reset"
        );
 
+    add( "MAP_SAVE_FORMAT", "world_default", translate_marker( "Map save format" ),
+    translate_marker( "Format of the saved map data.  Binary files are smaller and faster to load.  Either format can always be loaded, map data is converted to the selected one whenever it is saved again." ), {
+        { "json", translate_marker( "JSON" ) }, { "binary", translate_marker( "Binary" ) }
+    }, "json"
+       );
+
+    add( "COMPACT_SAVES", "world_default", translate_marker( "Compact save files" ),
+         translate_marker( "If true, character and world save files are written without indentation.  They are noticeably smaller and faster to write, but harder to read by hand.  Either layout can always be loaded." ),
+         false
+       );
+
     add_empty_line();
 
     add( "CITY_SIZE", "world_default", translate_marker( "Size of cities" ),
@@ -3270,6 +3286,8 @@ void options_manager::cache_to_globals()
     message_cooldown = ::get_option<int>( "MESSAGE_COOLDOWN" );
     fov_3d = ::get_option<bool>( "FOV_3D" );
     fov_3d_z_range = ::get_option<int>( "FOV_3D_Z_RANGE" );
+    item_health_bar = ::get_option<bool>( "ITEM_HEALTH_BAR" );
+    ammo_in_names = ::get_option<bool>( "AMMO_IN_NAMES" );
     PICKUP_RANGE = ::get_option<int>( "PICKUP_RANGE" );
 #if defined(SDL_SOUND)
     sounds::sound_enabled = ::get_option<bool>( "SOUND_ENABLED" );
@@ -48,7 +48,6 @@ class options_manager
         options_manager();
 
         void addOptionToPage( const std::string &name, const std::string &page );
-        void cache_to_globals(); // cache some options to globals due to heavy usage
 
     public:
         enum copt_hide_t {
@@ -194,6 +193,7 @@ class options_manager
         void add_options_android();
         void load();
         bool save();
+        void cache_to_globals(); // cache some options to globals due to heavy usage
         std::string show( bool ingame = false, bool world_options_only = false,
                           const std::function<bool()> &on_quit = nullptr );
 
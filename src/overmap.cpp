@@ -10,6 +10,8 @@
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -2168,8 +2170,15 @@ void overmap::move_hordes()
 */
 void overmap::signal_hordes( const tripoint &p, const int sig_power )
 {
-    for( auto &elem : zg ) {
-        mongroup &mg = elem.second;
+    if( sig_power < 0 ) {
+        return;
+    }
+    // Groups are keyed by their position, ordered by x first, and only those within
+    // sig_power squares of the signal can react, so only walk that slice of x.
+    const auto first = zg.lower_bound( tripoint( p.x - sig_power, INT_MIN, INT_MIN ) );
+    const auto last = zg.upper_bound( tripoint( p.x + sig_power, INT_MAX, INT_MAX ) );
+    for( auto it = first; it != last; ++it ) {
+        mongroup &mg = it->second;
         if( !mg.horde ) {
             continue;
         }
@@ -2457,8 +2466,17 @@ void overmap::place_lakes()
 {
     const om_noise::om_noise_layer_lake f( global_base_point(), g->get_seed() );
 
+    // The lake noise has many octaves, and the flood fill below asks about the shore around
+    // each lake several times, so remember the answers.
+    std::unordered_map<point, bool> lake_noise_cache;
     const auto is_lake = [&]( const point & p ) {
-        return f.noise_at( p ) > settings->overmap_lake.noise_threshold_lake;
+        const auto cached = lake_noise_cache.find( p );
+        if( cached != lake_noise_cache.end() ) {
+            return cached->second;
+        }
+        const bool lake = f.noise_at( p ) > settings->overmap_lake.noise_threshold_lake;
+        lake_noise_cache.emplace( p, lake );
+        return lake;
     };
 
     const oter_id lake_surface( "lake_surface" );
@@ -2781,15 +2799,20 @@ void overmap::place_swamps()
                 continue;
             }
 
+            // Both checks below use the noise of the same location, so only generate it once.
+            const float n = f.noise_at( pos.xy() );
+
             // If this was a part of our buffered floodplain, and the noise here meets the threshold, and the one_in rng
             // triggers, then we should flood this location and make it a swamp.
-            const bool should_flood = ( floodplain[x][y] > 0 && !one_in( floodplain[x][y] ) && f.noise_at( { x, y } )
-                                        > settings->overmap_forest.noise_threshold_swamp_adjacent_water );
+            const double flood_threshold =
+                settings->overmap_forest.noise_threshold_swamp_adjacent_water;
+            const bool should_flood = floodplain[x][y] > 0 && !one_in( floodplain[x][y] ) &&
+                                      n > flood_threshold;
 
             // If this location meets our isolated swamp threshold, regardless of floodplain values, we'll make it
             // into a swamp.
-            const bool should_isolated_swamp = f.noise_at( pos.xy() ) >
-                                               settings->overmap_forest.noise_threshold_swamp_isolated;
+            const bool should_isolated_swamp =
+                n > settings->overmap_forest.noise_threshold_swamp_isolated;
             if( should_flood || should_isolated_swamp )  {
                 ter_set( pos, forest_water );
             }
@@ -4604,7 +4627,13 @@ void overmap::open( overmap_special_batch &enabled_specials )
         const auto plr_reader = [&]( std::istream & fin ) {
             overmap::unserialize_view( fin, plrfilename );
         };
-        read_from_file_optional( plrfilename, plr_reader );
+        if( read_from_file_optional( plrfilename, plr_reader ) ) {
+            // What was just read is what a save would write back.
+            std::ostringstream view_stream;
+            serialize_view( view_stream );
+            last_saved_view = view_stream.str();
+            last_saved_view_path = plrfilename;
+        }
     } else { // No map exists!  Prepare neighbors, and generate one.
         std::vector<const overmap *> pointers;
         // Fetch south and north
@@ -4624,9 +4653,17 @@ void overmap::open( overmap_special_batch &enabled_specials )
 // Note: this may throw io errors from std::ofstream
 void overmap::save() const
 {
-    write_to_file( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
-        serialize_view( stream );
-    } );
+    std::ostringstream view_stream;
+    serialize_view( view_stream );
+    std::string view = view_stream.str();
+    std::string plrfilename = overmapbuffer::player_filename( loc );
+    if( view != last_saved_view || plrfilename != last_saved_view_path ) {
+        write_to_file( plrfilename, [&]( std::ostream & stream ) {
+            stream << view;
+        } );
+        last_saved_view = std::move( view );
+        last_saved_view_path = std::move( plrfilename );
+    }
 
     write_to_file( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
         serialize( stream );
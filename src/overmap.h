@@ -390,6 +390,12 @@ class overmap
         std::array<map_layer, OVERMAP_LAYERS> layer;
         std::unordered_map<tripoint, scent_trace> scents;
 
+        // The player's view of this overmap as it was last read or written, and the file
+        // it is in, so that saving again doesn't rewrite the file when nothing the player
+        // knows has changed.
+        mutable std::string last_saved_view;
+        mutable std::string last_saved_view_path;
+
         // Records the locations where a given overmap special was placed, which
         // can be used after placement to lookup whether a given location was created
         // as part of a special.
@@ -93,9 +93,21 @@ const overmap_connection::subtype *overmap_connection::pick_subtype_for(
 
 bool overmap_connection::has( const int_id<oter_t> &oter ) const
 {
-    return std::find_if( subtypes.cbegin(), subtypes.cend(), [&oter]( const subtype & elem ) {
+    const size_t cache_index = oter.to_i();
+    assert( cache_index < cached_has.size() );
+
+    if( cached_has[cache_index] >= 0 ) {
+        return cached_has[cache_index] != 0;
+    }
+
+    const bool result = std::find_if( subtypes.cbegin(), subtypes.cend(),
+    [&oter]( const subtype & elem ) {
         return oter->type_is( elem.terrain );
     } ) != subtypes.cend();
+
+    cached_has[cache_index] = result ? 1 : 0;
+
+    return result;
 }
 
 void overmap_connection::load( const JsonObject &jo, const std::string & )
@@ -125,6 +137,7 @@ void overmap_connection::check() const
 void overmap_connection::finalize()
 {
     cached_subtypes.resize( overmap_terrains::get_all().size() );
+    cached_has.assign( overmap_terrains::get_all().size(), -1 );
 }
 
 void overmap_connections::load( const JsonObject &jo, const std::string &src )
@@ -70,6 +70,8 @@ class overmap_connection
 
         std::list<subtype> subtypes;
         mutable std::vector<cache> cached_subtypes;
+        /** Memoized results of has(), indexed by oter id: -1 unknown, 0 false, 1 true. */
+        mutable std::vector<signed char> cached_has;
 };
 
 namespace overmap_connections
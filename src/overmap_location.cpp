@@ -33,10 +33,19 @@ const overmap_location &string_id<overmap_location>::obj() const
 
 bool overmap_location::test( const int_id<oter_t> &oter ) const
 {
-    return std::any_of( terrains.cbegin(), terrains.cend(),
-    [ &oter ]( const oter_type_str_id & type ) {
-        return oter->type_is( type );
-    } );
+    static constexpr signed char unknown = -1;
+    const size_t index = oter.to_i();
+    if( index >= test_cache.size() ) {
+        test_cache.resize( index + 1, unknown );
+    }
+    signed char &result = test_cache[index];
+    if( result == unknown ) {
+        result = std::any_of( terrains.cbegin(), terrains.cend(),
+        [ &oter ]( const oter_type_str_id & type ) {
+            return oter->type_is( type );
+        } );
+    }
+    return result;
 }
 
 oter_type_id overmap_location::get_random_terrain() const
@@ -73,6 +82,7 @@ void overmap_location::check() const
 
 void overmap_location::finalize()
 {
+    test_cache.clear();
     for( const std::string &elem : flags ) {
         auto it = oter_flags_map.find( elem );
         if( it == oter_flags_map.end() ) {
@@ -34,6 +34,11 @@ struct overmap_location {
     private:
         std::vector<oter_type_str_id> terrains;
         std::vector<std::string> flags;
+        /**
+         * Memoized results of @ref test, indexed by overmap terrain id. Flag based locations
+         * can list hundreds of terrain types, and overmap special placement tests them a lot.
+         */
+        mutable std::vector<signed char> test_cache;
 };
 
 namespace overmap_locations
@@ -12,6 +12,7 @@
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -855,8 +856,8 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
         nc_color color;
         size_t count;
     };
-    std::vector<tripoint> path_route;
-    std::vector<tripoint> player_path_route;
+    std::unordered_set<tripoint> path_route;
+    std::unordered_set<tripoint> player_path_route;
     std::unordered_map<tripoint, npc_coloring> npc_color;
     if( blink ) {
         // get seen NPCs
@@ -899,13 +900,12 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
             npc *npc_to_add = elem.get();
             if( npc_to_add->mission == NPC_MISSION_TRAVELLING && !npc_to_add->omt_path.empty() ) {
                 for( auto &elem : npc_to_add->omt_path ) {
-                    path_route.push_back( tripoint( elem.xy(), npc_to_add->posz() ) );
+                    path_route.insert( tripoint( elem.xy(), npc_to_add->posz() ) );
                 }
             }
         }
         for( auto &elem : g->u.omt_path ) {
-            tripoint tri_to_add = tripoint( elem.xy(), g->u.posz() );
-            player_path_route.push_back( tri_to_add );
+            player_path_route.insert( tripoint( elem.xy(), g->u.posz() ) );
         }
         for( const auto &np : followers ) {
             if( np->posz() != center.z ) {
@@ -940,21 +940,22 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
                 cur_ter = overmap_buffer.ter( omp );
             }
 
-            // Check if location is within player line-of-sight
-            const bool los = see && g->u.overmap_los( omp, sight_points );
-            const bool los_sky = g->u.overmap_los( omp, sight_points * 2 );
-            int mycount = std::count( path_route.begin(), path_route.end(), omp );
-            bool player_path_count = false;
-            std::vector<tripoint>::iterator it;
-            it = std::find( player_path_route.begin(), player_path_route.end(), omp );
-            if( it != player_path_route.end() ) {
-                player_path_count = true;
-            }
+            // Line-of-sight traces a line through the overmap, so it's only checked
+            // for the few cells that actually need it.
+            const auto los = [&]() {
+                return see && g->u.overmap_los( omp, sight_points );
+            };
+            const auto los_sky = [&]() {
+                return g->u.overmap_los( omp, sight_points * 2 );
+            };
+            const int horde_size = blink && showhordes && see ?
+                                   overmap_buffer.get_horde_size( omp ) : 0;
+            const auto npc_iter = npc_color.find( omp );
             if( blink && omp == orig ) {
                 // Display player pos, should always be visible
                 ter_color = g->u.symbol_color();
                 ter_sym = "@";
-            } else if( viewing_weather && ( data.debug_weather || los_sky ) ) {
+            } else if( viewing_weather && ( data.debug_weather || los_sky() ) ) {
                 const weather_type type = get_weather_at_point( omp );
                 ter_color = weather::map_color( type );
                 ter_sym = weather::glyph( type );
@@ -978,21 +979,20 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
                 ter_color = c_dark_gray;
                 ter_sym   = "#";
                 // All cases below assume that see is true.
-            } else if( blink && npc_color.count( omp ) != 0 ) {
+            } else if( blink && npc_iter != npc_color.end() ) {
                 // Visible NPCs are cached already
-                ter_color = npc_color[ omp ].color;
+                ter_color = npc_iter->second.color;
                 ter_sym   = "@";
-            } else if( blink && mycount != 0 && g->debug_pathfinding ) {
+            } else if( blink && g->debug_pathfinding && path_route.count( omp ) != 0 ) {
                 ter_color = c_red;
                 ter_sym   = "!";
-            } else if( blink && player_path_count ) {
+            } else if( blink && player_path_route.count( omp ) != 0 ) {
                 ter_color = c_blue;
                 ter_sym = "!";
-            } else if( blink && showhordes && los &&
-                       overmap_buffer.get_horde_size( omp ) >= HORDE_VISIBILITY_SIZE ) {
+            } else if( horde_size >= HORDE_VISIBILITY_SIZE && los() ) {
                 // Display Hordes only when within player line-of-sight
                 ter_color = c_green;
-                ter_sym   = overmap_buffer.get_horde_size( omp ) > HORDE_VISIBILITY_SIZE * 2 ? "Z" : "z";
+                ter_sym   = horde_size > HORDE_VISIBILITY_SIZE * 2 ? "Z" : "z";
             } else if( blink && overmap_buffer.has_vehicle( omp ) ) {
                 // Display Vehicles only when player can see the location
                 ter_color = c_cyan;
@@ -1038,7 +1038,7 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
                     }
                     // Set the color only if we encountered an eligible group.
                     if( ter_sym == "+" || ter_sym == "-" ) {
-                        if( los ) {
+                        if( los() ) {
                             ter_color = c_light_blue;
                         } else {
                             ter_color = c_blue;
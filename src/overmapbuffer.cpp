@@ -200,6 +200,28 @@ void overmapbuffer::save()
     }
 }
 
+void overmapbuffer::unload_distant( const point &center, const int radius )
+{
+    for( auto it = overmaps.begin(); it != overmaps.end(); ) {
+        overmap &om = *it->second;
+        if( square_dist( om.pos(), center ) <= radius || !om.npcs.empty() ) {
+            ++it;
+            continue;
+        }
+        // Note: this may throw io errors from std::ofstream
+        om.save();
+        if( last_requested_overmap == &om ) {
+            last_requested_overmap = nullptr;
+        }
+        it = overmaps.erase( it );
+    }
+}
+
+size_t overmapbuffer::memory_usage() const
+{
+    return overmaps.size() * ( sizeof( overmap ) + sizeof( decltype( overmaps )::value_type ) );
+}
+
 void overmapbuffer::clear()
 {
     overmaps.clear();
@@ -908,25 +930,30 @@ static omt_find_params assign_params(
     return params;
 }
 
-bool overmapbuffer::is_findable_location( const tripoint &location, const omt_find_params &params )
+bool overmapbuffer::is_findable_location( const tripoint &location, const omt_find_params &params,
+        std::vector<signed char> &type_matches )
 {
-    bool type_matches = false;
-    if( params.existing_only ) {
-        for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
-            type_matches = check_ot_existing( elem.first, elem.second, location );
-            if( type_matches ) {
-                break;
-            }
-        }
-    } else {
-        for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
-            type_matches = check_ot( elem.first, elem.second, location );
-            if( type_matches ) {
-                break;
-            }
-        }
+    if( params.types.empty() ) {
+        return false;
+    }
+    const overmap_with_local_coords om_loc = params.existing_only ?
+            get_existing_om_global( location ) : get_om_global( location );
+    if( !om_loc || !overmap::inbounds( om_loc.local ) ) {
+        return false;
+    }
+    const oter_id &oter = om_loc.om->ter( om_loc.local );
+    static constexpr signed char unknown = -1;
+    const size_t index = oter.to_i();
+    if( index >= type_matches.size() ) {
+        type_matches.resize( index + 1, unknown );
+    }
+    if( type_matches[index] == unknown ) {
+        type_matches[index] = std::any_of( params.types.begin(), params.types.end(),
+        [&oter]( const std::pair<std::string, ot_match_type> &elem ) {
+            return is_ot_match( elem.first, oter, elem.second );
+        } );
     }
-    if( !type_matches ) {
+    if( !type_matches[index] ) {
         return false;
     }
 
@@ -965,8 +992,9 @@ tripoint overmapbuffer::find_closest( const tripoint &origin, const std::string
 
 tripoint overmapbuffer::find_closest( const tripoint &origin, const omt_find_params &params )
 {
+    std::vector<signed char> type_matches;
     // Check the origin before searching adjacent tiles!
-    if( params.min_distance == 0 && is_findable_location( origin, params ) ) {
+    if( params.min_distance == 0 && is_findable_location( origin, params, type_matches ) ) {
         return origin;
     }
 
@@ -1009,7 +1037,7 @@ tripoint overmapbuffer::find_closest( const tripoint &origin, const omt_find_par
                 continue;
             }
 
-            if( is_findable_location( loc, params ) ) {
+            if( is_findable_location( loc, params, type_matches ) ) {
                 found_dist = dist;
                 result.push_back( loc );
             }
@@ -1037,8 +1065,9 @@ std::vector<tripoint> overmapbuffer::find_all( const tripoint &origin,
     size_t num_overmaps = overmaps.size();
     size_t counter = 0;
 
+    std::vector<signed char> type_matches;
     for( const tripoint &loc : closest_tripoints_first( origin, min_dist, max_dist ) ) {
-        if( is_findable_location( loc, params ) ) {
+        if( is_findable_location( loc, params, type_matches ) ) {
             result.push_back( loc );
         }
 
@@ -156,6 +156,19 @@ class overmapbuffer
         overmap &get( const point & );
         void save();
         void clear();
+        /**
+         * Saves and drops the loaded overmaps that are more than radius overmaps away from
+         * center (in overmap coordinates), they are loaded from disk again when needed.
+         * Overmaps holding NPCs stay loaded, as NPCs are only searched in loaded overmaps.
+         * Like @ref save, this may throw io errors.
+         */
+        void unload_distant( const point &center, int radius );
+        /** Number of overmaps currently held in memory. */
+        size_t loaded_count() const {
+            return overmaps.size();
+        }
+        /** Approximate bytes held by the loaded overmaps, not counting their NPCs. */
+        size_t memory_usage() const;
         void create_custom_overmap( const point &, overmap_special_batch &specials );
 
         /**
@@ -495,8 +508,12 @@ class overmapbuffer
          * findable based on the specified criteria.
          * @param location Location of search
          * see omt_find_params for definitions of the terms
+         * @param type_matches Remembers which terrains match params.types, indexed by terrain
+         * id. Owned by the caller and shared by all locations of one search, so matching the
+         * type names is done once per terrain rather than once per location.
          */
-        bool is_findable_location( const tripoint &location, const omt_find_params &params );
+        bool is_findable_location( const tripoint &location, const omt_find_params &params,
+                                   std::vector<signed char> &type_matches );
 
         std::unordered_map< point, std::unique_ptr< overmap > > overmaps;
         /**
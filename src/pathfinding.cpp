@@ -1,5 +1,6 @@
 #include "pathfinding.h"
 
+#include <climits>
 #include <cstdlib>
 #include <algorithm>
 #include <queue>
@@ -9,12 +10,14 @@
 #include <utility>
 #include <vector>
 
+#include "calendar.h"
 #include "cata_utility.h"
 #include "coordinates.h"
 #include "debug.h"
 #include "map.h"
 #include "mapdata.h"
 #include "optional.h"
+#include "profiler.h"
 #include "submap.h"
 #include "trap.h"
 #include "veh_type.h"
@@ -147,34 +150,276 @@ bool vertical_move_destination( const map &m, tripoint &t )
     return false;
 }
 
-template<class Set1, class Set2>
-bool is_disjoint( const Set1 &set1, const Set2 &set2 )
+int map::route_step_cost( const tripoint &cur, const tripoint &p, const pf_special p_special,
+                          const pathfinding_settings &settings, bool &close_p, bool &ledge ) const
 {
-    if( set1.empty() || set2.empty() ) {
-        return true;
+    static const auto non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP | PF_SHARP;
+    const int bash = settings.bash_strength;
+    const int climb_cost = settings.climb_cost;
+    const bool doors = settings.allow_open_doors;
+
+    // TODO: De-uglify, de-huge-n
+    if( !( p_special & non_normal ) ) {
+        // Boring flat dirt - the most common case above the ground
+        return 2;
+    }
+    if( settings.avoid_rough_terrain ) {
+        close_p = true; // Close all rough terrain tiles
+        return -1;
+    }
+
+    int part = -1;
+    const maptile &tile = maptile_at_internal( p );
+    const auto &terrain = tile.get_ter_t();
+    const auto &furniture = tile.get_furn_t();
+    const vehicle *veh = veh_at_internal( p, part );
+
+    const int cost = move_cost_internal( furniture, terrain, veh, part );
+    // Don't calculate bash rating unless we intend to actually use it
+    const int rating = ( bash == 0 || cost != 0 ) ? -1 :
+                       bash_rating_internal( bash, furniture, terrain, false, veh, part );
+
+    if( cost == 0 && rating <= 0 && ( !doors || !terrain.open || !furniture.open ) && veh == nullptr &&
+        climb_cost <= 0 ) {
+        close_p = true; // Close it so that next time we won't try to calculate costs
+        return -1;
     }
 
-    typename Set1::const_iterator it1 = set1.begin();
-    typename Set1::const_iterator it1_end = set1.end();
+    int newg = cost;
+    if( cost == 0 ) {
+        if( climb_cost > 0 && p_special & PF_CLIMBABLE ) {
+            // Climbing fences
+            newg += climb_cost;
+        } else if( doors && ( terrain.open || furniture.open ) &&
+                   ( !terrain.has_flag( "OPENCLOSE_INSIDE" ) || !furniture.has_flag( "OPENCLOSE_INSIDE" ) ||
+                     !is_outside( cur ) ) ) {
+            // Only try to open INSIDE doors from the inside
+            // To open and then move onto the tile
+            newg += 4;
+        } else if( veh != nullptr ) {
+            const auto vpobst = vpart_position( const_cast<vehicle &>( *veh ), part ).obstacle_at_part();
+            part = vpobst ? vpobst->part_index() : -1;
+            int dummy = -1;
+            if( doors && veh->part_flag( part, VPFLAG_OPENABLE ) &&
+                ( !veh->part_flag( part, "OPENCLOSE_INSIDE" ) ||
+                  veh_at_internal( cur, dummy ) == veh ) ) {
+                // Handle car doors, but don't try to path through curtains
+                newg += 10; // One turn to open, 4 to move there
+            } else if( part >= 0 && bash > 0 ) {
+                // Car obstacle that isn't a door
+                // TODO: Account for armor
+                int hp = veh->parts[part].hp();
+                if( hp / 20 > bash ) {
+                    // Threshold damage thing means we just can't bash this down
+                    close_p = true;
+                    return -1;
+                } else if( hp / 10 > bash ) {
+                    // Threshold damage thing means we will fail to deal damage pretty often
+                    hp *= 2;
+                }
+
+                newg += 2 * hp / bash + 8 + 4;
+            } else if( part >= 0 ) {
+                if( !doors || !veh->part_flag( part, VPFLAG_OPENABLE ) ) {
+                    // Won't be openable, don't try from other sides
+                    close_p = true;
+                }
 
-    typename Set2::const_iterator it2 = set2.begin();
-    typename Set2::const_iterator it2_end = set2.end();
+                return -1;
+            }
+        } else if( rating > 1 ) {
+            // Expected number of turns to bash it down, 1 turn to move there
+            // and 5 turns of penalty not to trash everything just because we can
+            newg += ( 20 / rating ) + 2 + 10;
+        } else if( rating == 1 ) {
+            // Desperate measures, avoid whenever possible
+            newg += 500;
+        } else {
+            // Unbashable and unopenable from here
+            if( !doors || !terrain.open || !furniture.open ) {
+                // Or anywhere else for that matter
+                close_p = true;
+            }
 
-    if( *set2.rbegin() < *it1 || *set1.rbegin() < *it2 ) {
-        return true;
+            return -1;
+        }
     }
 
-    while( it1 != it1_end && it2 != it2_end ) {
-        if( *it1 == *it2 ) {
-            return false;
+    if( settings.avoid_traps && p_special & PF_TRAP ) {
+        const auto &ter_trp = terrain.trap.obj();
+        const auto &trp = ter_trp.is_benign() ? tile.get_trap_t() : ter_trp;
+        if( !trp.is_benign() ) {
+            // For now make them detect all traps
+            if( has_zlevels() && terrain.has_flag( TFLAG_NO_FLOOR ) ) {
+                // Special case - ledge in z-levels
+                // Warning: really expensive, needs a cache
+                if( valid_move( p, tripoint( p.xy(), p.z - 1 ), false, true ) ) {
+                    tripoint below( p.xy(), p.z - 1 );
+                    // Otherwise this would have been a huge fall
+                    ledge = !has_flag( TFLAG_NO_FLOOR, below );
+                    // Close p, because we won't be walking on it
+                    close_p = true;
+                    return -1;
+                }
+            } else {
+                // Otherwise it's walkable
+                newg += 500;
+            }
         }
-        if( *it1 < *it2 ) {
-            it1++;
-        } else {
-            it2++;
+    }
+
+    if( settings.avoid_sharp && p_special & PF_SHARP ) {
+        close_p = true; // Avoid sharp things
+    }
+
+    return newg;
+}
+
+bool route_cache::find( const tripoint &from, const tripoint &to,
+                        const pathfinding_settings &settings, std::vector<tripoint> &result ) const
+{
+    for( const entry &e : entries ) {
+        if( e.destination != to || e.settings != settings ) {
+            continue;
+        }
+        const auto iter = e.index.find( from );
+        if( iter != e.index.end() ) {
+            result.assign( e.route.begin() + iter->second + 1, e.route.end() );
+            return true;
+        }
+    }
+    return false;
+}
+
+void route_cache::add( const tripoint &from, const tripoint &to,
+                       const pathfinding_settings &settings, const std::vector<tripoint> &route )
+{
+    if( entries.size() >= max_entries ) {
+        return;
+    }
+    entry e;
+    e.destination = to;
+    e.settings = settings;
+    e.route.reserve( route.size() + 1 );
+    e.route.push_back( from );
+    e.route.insert( e.route.end(), route.begin(), route.end() );
+    for( size_t i = 0; i < e.route.size(); ++i ) {
+        e.index.emplace( e.route[i], i );
+    }
+    entries.emplace_back( std::move( e ) );
+}
+
+const flow_field *route_cache::find_flow_field( const tripoint &to,
+        const pathfinding_settings &settings ) const
+{
+    for( size_t i = 0; i < flow_fields_used; ++i ) {
+        const flow_field &field = *flow_fields[i];
+        if( field.destination == to && field.settings == settings ) {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+flow_field *route_cache::count_search( const tripoint &to, const pathfinding_settings &settings )
+{
+    auto iter = std::find_if( searches.begin(), searches.end(), [&]( const search_count & sc ) {
+        return sc.destination == to && sc.settings == settings;
+    } );
+    if( iter == searches.end() ) {
+        searches.push_back( search_count{ to, settings, 0 } );
+        iter = searches.end() - 1;
+    }
+    if( ++iter->count < flow_field_threshold || flow_fields_used >= max_flow_fields ) {
+        return nullptr;
+    }
+    if( flow_fields_used == flow_fields.size() ) {
+        flow_fields.emplace_back( std::make_unique<flow_field>() );
+    }
+    flow_field &field = *flow_fields[flow_fields_used++];
+    field.destination = to;
+    field.settings = settings;
+    return &field;
+}
+
+void map::build_flow_field( flow_field &field ) const
+{
+    const tripoint &t = field.destination;
+    const pathfinding_settings &settings = field.settings;
+
+    // Same padding route() uses, around every start it would accept
+    const int pad = 16 + settings.max_dist;
+    int minx = t.x - pad;
+    int miny = t.y - pad;
+    int minz = t.z;
+    int maxx = t.x + pad;
+    int maxy = t.y + pad;
+    int maxz = t.z;
+    clip_to_bounds( minx, miny, minz );
+    clip_to_bounds( maxx, maxy, maxz );
+    field.min = point( minx, miny );
+    field.max = point( maxx, maxy );
+    for( int x = minx; x < maxx; ++x ) {
+        std::fill_n( &field.cost[flat_index( tripoint( x, miny, t.z ) )], maxy - miny, INT_MAX );
+    }
+
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( t.z );
+    std::priority_queue< std::pair<int, point>, std::vector< std::pair<int, point> >, pair_greater_cmp_first >
+    open;
+    field.cost[flat_index( t )] = 0;
+    open.emplace( 0, t.xy() );
+    while( !open.empty() ) {
+        const std::pair<int, point> top = open.top();
+        open.pop();
+        const tripoint p( top.second, t.z );
+        if( top.first > field.cost[flat_index( p )] ) {
+            // Already reached through a cheaper route
+            continue;
+        }
+        const pf_special p_special = pf_cache.special[p.x][p.y];
+        for( const tripoint &offset : eight_horizontal_neighbors ) {
+            // Search backwards: from where can we step onto p?
+            const tripoint from = p + offset;
+            if( !field.contains( from.xy() ) ) {
+                continue;
+            }
+            bool close_p = false;
+            bool ledge = false;
+            const int step_cost = route_step_cost( from, p, p_special, settings, close_p, ledge );
+            if( close_p ) {
+                // Nobody can step onto p, don't bother with other neighbours
+                break;
+            }
+            if( step_cost < 0 ) {
+                continue;
+            }
+            // Same diagonal penalty as in route()
+            const int cost = top.first + step_cost + ( offset.x != 0 && offset.y != 0 ? 1 : 0 );
+            const int index = flat_index( from );
+            if( cost <= settings.max_length && cost < field.cost[index] ) {
+                field.cost[index] = cost;
+                field.next[index] = p.xy();
+                open.emplace( cost, from.xy() );
+            }
         }
     }
+}
 
+// Sets `route` to the route from `from` to the destination of `field`, like map::route would.
+// Returns false if `from` can't reach the destination within the field.
+static bool follow_flow_field( const flow_field &field, const tripoint &from,
+                               std::vector<tripoint> &route )
+{
+    if( !field.contains( from.xy() ) || field.cost[flat_index( from )] == INT_MAX ) {
+        return false;
+    }
+    route.clear();
+    // Costs are strictly decreasing along `next`, so this always ends at the destination
+    tripoint cur = from;
+    while( cur != field.destination ) {
+        cur = tripoint( field.next[flat_index( cur )], cur.z );
+        route.push_back( cur );
+    }
     return true;
 }
 
@@ -182,6 +427,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                                   const pathfinding_settings &settings,
                                   const std::set<tripoint> &pre_closed ) const
 {
+    profiler::scoped_zone zone( "map::route" );
     /* TODO: If the origin or destination is out of bound, figure out the closest
      * in-bounds point and go to that, then to the real origin/destination.
      */
@@ -203,14 +449,12 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         const auto line_path = line_to( f, t );
         const auto &pf_cache = get_pathfinding_cache_ref( f.z );
         // Check all points for any special case (including just hard terrain)
-        if( std::all_of( line_path.begin(), line_path.end(), [&pf_cache]( const tripoint & p ) {
-        return !( pf_cache.special[p.x][p.y] & non_normal );
+        // The line is short and pre_closed usually empty, so probe it directly instead of
+        // building a sorted copy of the line to intersect with
+        if( std::all_of( line_path.begin(), line_path.end(), [&]( const tripoint & p ) {
+        return !( pf_cache.special[p.x][p.y] & non_normal ) && pre_closed.count( p ) == 0;
         } ) ) {
-            const std::set<tripoint> sorted_line( line_path.begin(), line_path.end() );
-
-            if( is_disjoint( sorted_line, pre_closed ) ) {
-                return line_path;
-            }
+            return line_path;
         }
     }
 
@@ -219,13 +463,32 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         return ret;
     }
 
+    // Routes avoiding specific tiles are tailored to whoever asked, don't share them
+    const bool use_route_cache = pre_closed.empty();
+    if( use_route_cache ) {
+        if( cached_routes->turn != calendar::turn ) {
+            cached_routes->clear();
+            cached_routes->turn = calendar::turn;
+        }
+        if( cached_routes->find( f, t, settings, ret ) ) {
+            return ret;
+        }
+        if( f.z == t.z ) {
+            const flow_field *field = cached_routes->find_flow_field( t, settings );
+            if( field == nullptr ) {
+                flow_field *new_field = cached_routes->count_search( t, settings );
+                if( new_field != nullptr ) {
+                    build_flow_field( *new_field );
+                    field = new_field;
+                }
+            }
+            if( field != nullptr && follow_flow_field( *field, f, ret ) ) {
+                return ret;
+            }
+        }
+    }
+
     int max_length = settings.max_length;
-    int bash = settings.bash_strength;
-    int climb_cost = settings.climb_cost;
-    bool doors = settings.allow_open_doors;
-    bool trapavoid = settings.avoid_traps;
-    bool roughavoid = settings.avoid_rough_terrain;
-    bool sharpavoid = settings.avoid_sharp;
 
     const int pad = 16;  // Should be much bigger - low value makes pathfinders dumb!
     int minx = std::min( f.x, t.x ) - pad;
@@ -301,129 +564,25 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             // Penalize for diagonals or the path will look "unnatural"
             int newg = layer.gscore[parent_index] + ( ( cur.x != p.x && cur.y != p.y ) ? 1 : 0 );
 
-            const auto p_special = pf_cache.special[p.x][p.y];
-            // TODO: De-uglify, de-huge-n
-            if( !( p_special & non_normal ) ) {
-                // Boring flat dirt - the most common case above the ground
-                newg += 2;
-            } else {
-                if( roughavoid ) {
-                    layer.state[index] = ASL_CLOSED; // Close all rough terrain tiles
-                    continue;
-                }
-
-                int part = -1;
-                const maptile &tile = maptile_at_internal( p );
-                const auto &terrain = tile.get_ter_t();
-                const auto &furniture = tile.get_furn_t();
-                const vehicle *veh = veh_at_internal( p, part );
-
-                const int cost = move_cost_internal( furniture, terrain, veh, part );
-                // Don't calculate bash rating unless we intend to actually use it
-                const int rating = ( bash == 0 || cost != 0 ) ? -1 :
-                                   bash_rating_internal( bash, furniture, terrain, false, veh, part );
-
-                if( cost == 0 && rating <= 0 && ( !doors || !terrain.open || !furniture.open ) && veh == nullptr &&
-                    climb_cost <= 0 ) {
-                    layer.state[index] = ASL_CLOSED; // Close it so that next time we won't try to calculate costs
-                    continue;
-                }
-
-                newg += cost;
-                if( cost == 0 ) {
-                    if( climb_cost > 0 && p_special & PF_CLIMBABLE ) {
-                        // Climbing fences
-                        newg += climb_cost;
-                    } else if( doors && ( terrain.open || furniture.open ) &&
-                               ( !terrain.has_flag( "OPENCLOSE_INSIDE" ) || !furniture.has_flag( "OPENCLOSE_INSIDE" ) ||
-                                 !is_outside( cur ) ) ) {
-                        // Only try to open INSIDE doors from the inside
-                        // To open and then move onto the tile
-                        newg += 4;
-                    } else if( veh != nullptr ) {
-                        const auto vpobst = vpart_position( const_cast<vehicle &>( *veh ), part ).obstacle_at_part();
-                        part = vpobst ? vpobst->part_index() : -1;
-                        int dummy = -1;
-                        if( doors && veh->part_flag( part, VPFLAG_OPENABLE ) &&
-                            ( !veh->part_flag( part, "OPENCLOSE_INSIDE" ) ||
-                              veh_at_internal( cur, dummy ) == veh ) ) {
-                            // Handle car doors, but don't try to path through curtains
-                            newg += 10; // One turn to open, 4 to move there
-                        } else if( part >= 0 && bash > 0 ) {
-                            // Car obstacle that isn't a door
-                            // TODO: Account for armor
-                            int hp = veh->parts[part].hp();
-                            if( hp / 20 > bash ) {
-                                // Threshold damage thing means we just can't bash this down
-                                layer.state[index] = ASL_CLOSED;
-                                continue;
-                            } else if( hp / 10 > bash ) {
-                                // Threshold damage thing means we will fail to deal damage pretty often
-                                hp *= 2;
-                            }
-
-                            newg += 2 * hp / bash + 8 + 4;
-                        } else if( part >= 0 ) {
-                            if( !doors || !veh->part_flag( part, VPFLAG_OPENABLE ) ) {
-                                // Won't be openable, don't try from other sides
-                                layer.state[index] = ASL_CLOSED;
-                            }
-
-                            continue;
-                        }
-                    } else if( rating > 1 ) {
-                        // Expected number of turns to bash it down, 1 turn to move there
-                        // and 5 turns of penalty not to trash everything just because we can
-                        newg += ( 20 / rating ) + 2 + 10;
-                    } else if( rating == 1 ) {
-                        // Desperate measures, avoid whenever possible
-                        newg += 500;
-                    } else {
-                        // Unbashable and unopenable from here
-                        if( !doors || !terrain.open || !furniture.open ) {
-                            // Or anywhere else for that matter
-                            layer.state[index] = ASL_CLOSED;
-                        }
-
-                        continue;
-                    }
-                }
-
-                if( trapavoid && p_special & PF_TRAP ) {
-                    const auto &ter_trp = terrain.trap.obj();
-                    const auto &trp = ter_trp.is_benign() ? tile.get_trap_t() : ter_trp;
-                    if( !trp.is_benign() ) {
-                        // For now make them detect all traps
-                        if( has_zlevels() && terrain.has_flag( TFLAG_NO_FLOOR ) ) {
-                            // Special case - ledge in z-levels
-                            // Warning: really expensive, needs a cache
-                            if( valid_move( p, tripoint( p.xy(), p.z - 1 ), false, true ) ) {
-                                tripoint below( p.xy(), p.z - 1 );
-                                if( !has_flag( TFLAG_NO_FLOOR, below ) ) {
-                                    // Otherwise this would have been a huge fall
-                                    auto &layer = pf.get_layer( p.z - 1 );
-                                    // From cur, not p, because we won't be walking on air
-                                    pf.add_point( layer.gscore[parent_index] + 10,
-                                                  layer.score[parent_index] + 10 + 2 * rl_dist( below, t ),
-                                                  cur, below );
-                                }
-
-                                // Close p, because we won't be walking on it
-                                layer.state[index] = ASL_CLOSED;
-                                continue;
-                            }
-                        } else if( trapavoid ) {
-                            // Otherwise it's walkable
-                            newg += 500;
-                        }
-                    }
-                }
-
-                if( sharpavoid && p_special & PF_SHARP ) {
-                    layer.state[index] = ASL_CLOSED; // Avoid sharp things
-                }
-
+            bool close_p = false;
+            bool ledge = false;
+            const int step_cost = route_step_cost( cur, p, pf_cache.special[p.x][p.y], settings, close_p,
+                                                   ledge );
+            if( close_p ) {
+                layer.state[index] = ASL_CLOSED;
+            }
+            if( ledge ) {
+                const tripoint below( p.xy(), p.z - 1 );
+                auto &layer = pf.get_layer( p.z - 1 );
+                // From cur, not p, because we won't be walking on air
+                pf.add_point( layer.gscore[parent_index] + 10,
+                              layer.score[parent_index] + 10 + 2 * rl_dist( below, t ),
+                              cur, below );
             }
+            if( step_cost < 0 ) {
+                continue;
+            }
+            newg += step_cost;
 
             // If not visited, add as open
             // If visited, add it only if we can do so with better score
@@ -494,6 +653,9 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         }
 
         std::reverse( ret.begin(), ret.end() );
+        if( use_route_cache ) {
+            cached_routes->add( f, t, settings, ret );
+        }
     }
 
     return ret;
@@ -2,7 +2,16 @@
 #ifndef CATA_SRC_PATHFINDING_H
 #define CATA_SRC_PATHFINDING_H
 
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "calendar.h"
 #include "game_constants.h"
+#include "point.h"
 
 enum pf_special : int {
     PF_NORMAL = 0x00,    // Plain boring tile (grass, dirt, floor etc.)
@@ -42,7 +51,8 @@ struct pathfinding_cache {
     pathfinding_cache();
     ~pathfinding_cache();
 
-    bool dirty;
+    // Submaps whose part of `special` has to be recalculated, indexed by smx * MAPSIZE + smy
+    std::bitset<MAPSIZE *MAPSIZE> dirty_submaps;
 
     pf_special special[MAPSIZE_X][MAPSIZE_Y];
 };
@@ -70,6 +80,98 @@ struct pathfinding_settings {
         : bash_strength( bs ), max_dist( md ), max_length( ml ), climb_cost( cc ),
           allow_open_doors( aod ), avoid_traps( at ), allow_climb_stairs( acs ), avoid_rough_terrain( art ),
           avoid_sharp( as ) {}
+
+    bool operator==( const pathfinding_settings &rhs ) const {
+        return bash_strength == rhs.bash_strength && max_dist == rhs.max_dist &&
+               max_length == rhs.max_length && climb_cost == rhs.climb_cost &&
+               allow_open_doors == rhs.allow_open_doors && avoid_traps == rhs.avoid_traps &&
+               allow_climb_stairs == rhs.allow_climb_stairs &&
+               avoid_rough_terrain == rhs.avoid_rough_terrain && avoid_sharp == rhs.avoid_sharp;
+    }
+    bool operator!=( const pathfinding_settings &rhs ) const {
+        return !( *this == rhs );
+    }
+};
+
+/**
+ * Cheapest routes to a single destination from every tile around it on the same z-level,
+ * found by map::build_flow_field with a single search outwards from the destination.
+ * Creatures heading to the same place (a horde converging on a noise, for example) follow
+ * it instead of each one searching for its own route.
+ */
+struct flow_field {
+    tripoint destination;
+    pathfinding_settings settings;
+    // Searched area in local coords, `max` is exclusive like in map::route
+    point min;
+    point max;
+    // Cost of the route from each tile, INT_MAX if it can't reach the destination
+    std::array<int, MAPSIZE_X *MAPSIZE_Y> cost;
+    // Next tile on the route from each tile with a finite cost
+    std::array<point, MAPSIZE_X *MAPSIZE_Y> next;
+
+    bool contains( const point &p ) const {
+        return p.x >= min.x && p.x < max.x && p.y >= min.y && p.y < max.y;
+    }
+};
+
+/**
+ * Routes found by map::route during the current turn.
+ * The rest of a route from any tile on it is a route to the same destination, so creatures
+ * standing on a route that was already found for their destination and settings (which is
+ * common for monsters converging on the same target) can reuse it instead of searching again.
+ * Must be cleared whenever the pathfinding cache changes.
+ */
+struct route_cache {
+    struct entry {
+        tripoint destination;
+        pathfinding_settings settings;
+        // Starts with the tile the route was requested from
+        std::vector<tripoint> route;
+        // Position of each tile in `route`
+        std::unordered_map<tripoint, size_t> index;
+    };
+
+    struct search_count {
+        tripoint destination;
+        pathfinding_settings settings;
+        int count;
+    };
+
+    // Never keep more than this many routes, to bound the cost of a lookup
+    static constexpr size_t max_entries = 256;
+    // Searches for the same destination in one turn after which a flow field is built for it
+    static constexpr int flow_field_threshold = 3;
+    static constexpr size_t max_flow_fields = 8;
+
+    time_point turn = calendar::before_time_starts;
+    std::vector<entry> entries;
+    std::vector<search_count> searches;
+    // Only the first `flow_fields_used` are valid, the rest are kept to avoid reallocating them
+    std::vector<std::unique_ptr<flow_field>> flow_fields;
+    size_t flow_fields_used = 0;
+
+    void clear() {
+        entries.clear();
+        searches.clear();
+        flow_fields_used = 0;
+    }
+    /**
+     * If `from` is on a route to `to` found with the same settings, sets `result` to the
+     * remainder of that route (excluding `from`, like map::route) and returns true.
+     */
+    bool find( const tripoint &from, const tripoint &to, const pathfinding_settings &settings,
+               std::vector<tripoint> &result ) const;
+    /** Remembers `route` (as returned by map::route) from `from` to `to`. */
+    void add( const tripoint &from, const tripoint &to, const pathfinding_settings &settings,
+              const std::vector<tripoint> &route );
+
+    const flow_field *find_flow_field( const tripoint &to, const pathfinding_settings &settings ) const;
+    /**
+     * Counts a search for a route to `to` with `settings`.
+     * Returns a flow field for the caller to build once there were enough of them, else nullptr.
+     */
+    flow_field *count_search( const tripoint &to, const pathfinding_settings &settings );
 };
 
 #endif // CATA_SRC_PATHFINDING_H
@@ -87,17 +87,15 @@ static bool select_autopickup_items( std::vector<std::list<item_stack::iterator>
                 const std::string sItemName = begin_iterator->tname( 1, false );
 
                 //Check the Pickup Rules
-                if( get_auto_pickup().check_item( sItemName ) == RULE_WHITELISTED ) {
-                    bPickup = true;
-                } else if( get_auto_pickup().check_item( sItemName ) != RULE_BLACKLISTED ) {
-                    //No prematched pickup rule found
+                cata::optional<rule_state> found_state = get_auto_pickup().find_item( sItemName );
+                if( !found_state ) {
+                    //Not checked against the rules yet
                     //check rules in more detail
                     get_auto_pickup().create_rule( &*begin_iterator );
-
-                    if( get_auto_pickup().check_item( sItemName ) == RULE_WHITELISTED ) {
-                        bPickup = true;
-                    }
+                    found_state = get_auto_pickup().find_item( sItemName );
                 }
+                const rule_state pickup_state = found_state.value_or( RULE_NONE );
+                bPickup = pickup_state == RULE_WHITELISTED;
 
                 //Auto Pickup all items with Volume <= AUTO_PICKUP_VOL_LIMIT * 50 and Weight <= AUTO_PICKUP_ZERO * 50
                 //items will either be in the autopickup list ("true") or unmatched ("")
@@ -107,7 +105,7 @@ static bool select_autopickup_items( std::vector<std::list<item_stack::iterator>
                     if( weight_limit && volume_limit ) {
                         if( begin_iterator->volume() <= units::from_milliliter( volume_limit * 50 ) &&
                             begin_iterator->weight() <= weight_limit * 50_gram &&
-                            get_auto_pickup().check_item( sItemName ) != RULE_BLACKLISTED ) {
+                            pickup_state != RULE_BLACKLISTED ) {
                             bPickup = true;
                         }
                     }
@@ -633,16 +631,23 @@ void Pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
         units::mass weight_predict = 0_gram;
         units::volume volume_predict = 0_ml;
 
+        // Info of the selected item, only regenerated when the selection changes
+        const item *info_item = nullptr;
+        std::vector<iteminfo> info_item_data;
+
         const std::string all_pickup_chars = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ:;";
 
         ui.on_redraw( [&]( const ui_adaptor & ) {
             const item &selected_item = *stacked_here[matches[selected]].front();
 
             if( selected >= 0 && selected <= static_cast<int>( stacked_here.size() ) - 1 ) {
-                std::vector<iteminfo> vThisItem;
-                selected_item.info( true, vThisItem );
+                if( info_item != &selected_item ) {
+                    info_item = &selected_item;
+                    info_item_data.clear();
+                    selected_item.info( true, info_item_data );
+                }
 
-                item_info_data dummy( {}, {}, vThisItem, {}, iScrollPos );
+                item_info_data dummy( {}, {}, info_item_data, {}, iScrollPos );
                 dummy.without_getch = true;
                 dummy.without_border = true;
 
@@ -513,29 +513,43 @@ void pixel_minimap::render_critters( const tripoint &center )
         std::max<int>( projector->get_tile_size().y *settings.beacon_size / 2, 2 )
     };
 
+    // Only visit the tiles that have a creature on them, instead of looking up
+    // every tile of the minimap, but keep drawing them in row order.
+    std::vector<point> occupied;
+    for( Creature &critter : g->all_creatures() ) {
+        const tripoint &pos = critter.pos();
+        const point rel( pos.x - start_x, pos.y - start_y );
+        if( pos.z == center.z && rel.x >= 0 && rel.x < total_tiles_count.x &&
+            rel.y >= 0 && rel.y < total_tiles_count.y ) {
+            occupied.push_back( rel );
+        }
+    }
+    std::sort( occupied.begin(), occupied.end(), []( const point & a, const point & b ) {
+        return a.y < b.y || ( a.y == b.y && a.x < b.x );
+    } );
+    occupied.erase( std::unique( occupied.begin(), occupied.end() ), occupied.end() );
+
     cached_has_animated_beacons = false;
-    for( int y = 0; y < total_tiles_count.y; y++ ) {
-        for( int x = 0; x < total_tiles_count.x; x++ ) {
-            const tripoint p = tripoint{ start_x + x, start_y + y, center.z };
-            const lit_level lighting = access_cache.visibility_cache[p.x][p.y];
+    for( const point &rel : occupied ) {
+        const tripoint p = tripoint{ start_x + rel.x, start_y + rel.y, center.z };
+        const lit_level lighting = access_cache.visibility_cache[p.x][p.y];
 
-            if( lighting == LL_DARK || lighting == LL_BLANK ) {
-                continue;
-            }
+        if( lighting == LL_DARK || lighting == LL_BLANK ) {
+            continue;
+        }
 
-            const auto critter = g->critter_at( p, true );
+        const auto critter = g->critter_at( p, true );
 
-            if( critter == nullptr || !g->u.sees( *critter ) ) {
-                continue;
-            }
+        if( critter == nullptr || !g->u.sees( *critter ) ) {
+            continue;
+        }
 
-            const point critter_pos = projector->get_tile_pos( { x, y }, total_tiles_count );
-            const SDL_Rect critter_rect = SDL_Rect{ critter_pos.x, critter_pos.y, beacon_size.x, beacon_size.y };
-            const SDL_Color critter_color = get_critter_color( critter, flicker, mixture );
-            cached_has_animated_beacons = cached_has_animated_beacons || is_critter_animated( critter );
+        const point critter_pos = projector->get_tile_pos( rel, total_tiles_count );
+        const SDL_Rect critter_rect = SDL_Rect{ critter_pos.x, critter_pos.y, beacon_size.x, beacon_size.y };
+        const SDL_Color critter_color = get_critter_color( critter, flicker, mixture );
+        cached_has_animated_beacons = cached_has_animated_beacons || is_critter_animated( critter );
 
-            draw_beacon( critter_rect, critter_color );
-        }
+        draw_beacon( critter_rect, critter_color );
     }
 }
 
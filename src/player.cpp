@@ -1358,9 +1358,9 @@ int player::hp_percentage() const
     // Head and torso HP are weighted 3x and 2x, respectively
     total_cur = get_part_hp_cur( head_id ) * 3 + get_part_hp_cur( torso_id ) * 2;
     total_max = get_part_hp_max( head_id ) * 3 + get_part_hp_max( torso_id ) * 2;
-    for( const std::pair< const bodypart_str_id, bodypart> &elem : get_body() ) {
-        total_cur += elem.second.get_hp_cur();
-        total_max += elem.second.get_hp_max();
+    for( const bodypart &elem : get_body() ) {
+        total_cur += elem.get_hp_cur();
+        total_max += elem.get_hp_max();
     }
 
     return ( 100 * total_cur ) / total_max;
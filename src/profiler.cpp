@@ -0,0 +1,200 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+
+#if defined(CATA_TRACK_ALLOCATIONS)
+#include <cstdlib>
+#include <new>
+#endif
+
+#if defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#endif
+
+#include "fstream_utils.h"
+
+namespace profiler
+{
+
+bool enabled = false;
+
+// Only a handful of zones exist, so a flat list beats a map here.
+static std::vector<zone_stats> zones;
+
+#if defined(CATA_TRACK_ALLOCATIONS)
+thread_local const char *current_zone = nullptr;
+
+namespace
+{
+struct allocation_slot {
+    const char *name = nullptr;
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+} // namespace
+
+// Filled from operator new, so this must not allocate itself: a fixed table keyed by the
+// zone name pointer. Zones beyond its capacity are simply not counted.
+static std::array<allocation_slot, 64> allocation_slots;
+
+static void note_allocation( const std::size_t size )
+{
+    const char *const zone = current_zone;
+    if( zone == nullptr ) {
+        return;
+    }
+    for( allocation_slot &slot : allocation_slots ) {
+        if( slot.name == nullptr ) {
+            slot.name = zone;
+        }
+        if( slot.name == zone ) {
+            slot.count++;
+            slot.bytes += size;
+            return;
+        }
+    }
+}
+#endif
+
+void set_enabled( bool value )
+{
+    enabled = value;
+    reset();
+}
+
+void record( const char *name, std::chrono::nanoseconds elapsed )
+{
+    auto it = std::find_if( zones.begin(), zones.end(), [name]( const zone_stats & z ) {
+        return std::strcmp( z.name.c_str(), name ) == 0;
+    } );
+    if( it == zones.end() ) {
+        zones.emplace_back();
+        it = zones.end() - 1;
+        it->name = name;
+    }
+    it->calls++;
+    it->total += elapsed;
+    it->max = std::max( it->max, elapsed );
+}
+
+std::vector<zone_stats> collected()
+{
+    std::vector<zone_stats> result = zones;
+#if defined(CATA_TRACK_ALLOCATIONS)
+    for( const allocation_slot &slot : allocation_slots ) {
+        if( slot.name == nullptr ) {
+            break;
+        }
+        // The same name may be a different literal in each translation unit.
+        for( zone_stats &zone : result ) {
+            if( std::strcmp( zone.name.c_str(), slot.name ) == 0 ) {
+                zone.allocations += slot.count;
+                zone.allocated_bytes += slot.bytes;
+                break;
+            }
+        }
+    }
+#endif
+    std::sort( result.begin(), result.end(), []( const zone_stats & a, const zone_stats & b ) {
+        return a.total > b.total;
+    } );
+    return result;
+}
+
+void reset()
+{
+    zones.clear();
+#if defined(CATA_TRACK_ALLOCATIONS)
+    allocation_slots.fill( allocation_slot() );
+#endif
+}
+
+std::string metrics_file;
+
+static turn_histogram turn_counts = {};
+
+void record_turn( std::chrono::nanoseconds elapsed )
+{
+    const int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>( elapsed ).count();
+    size_t bucket = 0;
+    while( bucket + 1 < turn_counts.size() && ms >= ( int64_t( 1 ) << bucket ) ) {
+        bucket++;
+    }
+    turn_counts[bucket]++;
+}
+
+/** Resident set size in bytes, or -1 where it can not be determined. */
+static int64_t resident_memory()
+{
+#if defined(__linux__)
+    std::ifstream statm( "/proc/self/statm" );
+    int64_t size = 0;
+    int64_t resident = 0;
+    if( statm >> size >> resident ) {
+        return resident * sysconf( _SC_PAGESIZE );
+    }
+#endif
+    return -1;
+}
+
+void write_metrics( const std::vector<std::pair<std::string, int64_t>> &counters )
+{
+    write_to_file( metrics_file, [&]( std::ostream & fout ) {
+        for( const std::pair<std::string, int64_t> &counter : counters ) {
+            fout << counter.first << ' ' << counter.second << '\n';
+        }
+        for( size_t i = 0; i < turn_counts.size(); i++ ) {
+            fout << "turn_ms_bucket_" << i << ' ' << turn_counts[i] << '\n';
+        }
+        fout << "rss_bytes " << resident_memory() << '\n';
+    }, nullptr );
+}
+
+static cata_ofstream action_log;
+
+void open_action_log( const std::string &path, const unsigned int seed )
+{
+    action_log.mode( cata_ios_mode::app ).open( path );
+    if( action_log.is_open() ) {
+        *action_log << "seed " << seed << '\n';
+    }
+}
+
+bool action_log_enabled()
+{
+    return action_log.is_open();
+}
+
+void log_action( const int turn, const std::string &action, const std::chrono::nanoseconds elapsed )
+{
+    // Flushed right away so the log is complete up to a crash or a hang.
+    *action_log << turn << ' ' << action << ' '
+                << std::chrono::duration_cast<std::chrono::microseconds>( elapsed ).count() << "us"
+                << std::endl;
+}
+
+} // namespace profiler
+
+#if defined(CATA_TRACK_ALLOCATIONS)
+void *operator new( std::size_t size )
+{
+    profiler::note_allocation( size );
+    if( void *const ptr = std::malloc( size == 0 ? 1 : size ) ) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete( void *ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void *ptr, std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+#endif
@@ -0,0 +1,103 @@
+#pragma once
+#ifndef CATA_SRC_PROFILER_H
+#define CATA_SRC_PROFILER_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Lightweight per-subsystem timing.
+ *
+ * Place a @ref profiler::scoped_zone at the top of an expensive function to
+ * accumulate the wall time spent in it. Collection is off by default, in which
+ * case a zone costs a single branch. It is toggled together with the debug
+ * hour timer, which prints the collected totals once per in-game hour.
+ *
+ * Builds with CATA_TRACK_ALLOCATIONS (TRACK_ALLOCATIONS=1) also replace the global
+ * operator new and charge every allocation to the innermost active zone.
+ */
+namespace profiler
+{
+
+struct zone_stats {
+    std::string name;
+    uint64_t calls = 0;
+    std::chrono::nanoseconds total{ 0 };
+    std::chrono::nanoseconds max{ 0 };
+    /** Only counted with CATA_TRACK_ALLOCATIONS, excludes nested zones. */
+    uint64_t allocations = 0;
+    uint64_t allocated_bytes = 0;
+};
+
+extern bool enabled;
+#if defined(CATA_TRACK_ALLOCATIONS)
+/** Innermost zone of this thread that allocations are charged to. */
+extern thread_local const char *current_zone;
+#endif
+
+void set_enabled( bool value );
+/** Adds one measurement to the zone named @p name. */
+void record( const char *name, std::chrono::nanoseconds elapsed );
+/** Returns collected zones, most expensive first. */
+std::vector<zone_stats> collected();
+void reset();
+
+/**
+ * Path given by --metrics-file. When set, the game periodically replaces that file
+ * with a snapshot of session metrics, one "name value" pair per line.
+ */
+extern std::string metrics_file;
+
+/** Turn durations by power of two milliseconds: <1, <2, <4 ... and the rest in the last one. */
+using turn_histogram = std::array<uint64_t, 12>;
+
+void record_turn( std::chrono::nanoseconds elapsed );
+/** Writes @p counters, the turn histogram and the process memory use to @ref metrics_file. */
+void write_metrics( const std::vector<std::pair<std::string, int64_t>> &counters );
+
+/**
+ * Starts appending to the log at @p path, given by --action-log: first the RNG @p seed,
+ * then one line per player action with the turn, the action id and the time the game
+ * took to carry it out, not counting the wait for input.
+ */
+void open_action_log( const std::string &path, unsigned int seed );
+bool action_log_enabled();
+void log_action( int turn, const std::string &action, std::chrono::nanoseconds elapsed );
+
+class scoped_zone
+{
+    public:
+        explicit scoped_zone( const char *name ) : name( enabled ? name : nullptr ) {
+            if( this->name ) {
+                start = std::chrono::steady_clock::now();
+#if defined(CATA_TRACK_ALLOCATIONS)
+                outer = current_zone;
+                current_zone = name;
+#endif
+            }
+        }
+        scoped_zone( const scoped_zone & ) = delete;
+        scoped_zone &operator=( const scoped_zone & ) = delete;
+        ~scoped_zone() {
+            if( name ) {
+#if defined(CATA_TRACK_ALLOCATIONS)
+                current_zone = outer;
+#endif
+                record( name, std::chrono::steady_clock::now() - start );
+            }
+        }
+    private:
+        const char *name;
+        std::chrono::steady_clock::time_point start;
+#if defined(CATA_TRACK_ALLOCATIONS)
+        const char *outer = nullptr;
+#endif
+};
+
+} // namespace profiler
+
+#endif // CATA_SRC_PROFILER_H
@@ -475,6 +475,10 @@ int player::fire_gun( const tripoint &target, const int max_shots, item &gun )
     dispersion_sources dispersion = calculate_dispersion( g->m, *this, gun, recoil_total(),
                                     max_shots > 1 );
 
+    // If this is a vehicle mounted turret, which vehicle is it mounted on?
+    const vehicle *in_veh = has_effect( effect_on_roof ) ? veh_pointer_or_null( g->m.veh_at(
+                                pos() ) ) : nullptr;
+
     tripoint aim = target;
     int curshot = 0;
     int hits = 0; // total shots on target
@@ -489,9 +493,6 @@ int player::fire_gun( const tripoint &target, const int max_shots, item &gun )
             break;
         }
 
-        // If this is a vehicle mounted turret, which vehicle is it mounted on?
-        const vehicle *in_veh = has_effect( effect_on_roof ) ? veh_pointer_or_null( g->m.veh_at(
-                                    pos() ) ) : nullptr;
         projectile projectile = make_gun_projectile( gun );
         if( has_trait( trait_NORANGEDCRIT ) ) {
             projectile.proj_effects.insert( "NO_CRIT" );
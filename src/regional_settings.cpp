@@ -969,10 +969,31 @@ void region_terrain_and_furniture_settings::finalize()
             furniture[template_fid.id()].add( fid.id(), actual_pr.second );
         }
     }
+
+    terrain_is_template.clear();
+    for( const auto &pr : terrain ) {
+        const size_t index = pr.first.to_i();
+        if( index >= terrain_is_template.size() ) {
+            terrain_is_template.resize( index + 1, false );
+        }
+        terrain_is_template[index] = true;
+    }
+    furniture_is_template.clear();
+    for( const auto &pr : furniture ) {
+        const size_t index = pr.first.to_i();
+        if( index >= furniture_is_template.size() ) {
+            furniture_is_template.resize( index + 1, false );
+        }
+        furniture_is_template[index] = true;
+    }
 }
 
 ter_id region_terrain_and_furniture_settings::resolve( const ter_id &tid ) const
 {
+    const size_t index = tid.to_i();
+    if( index >= terrain_is_template.size() || !terrain_is_template[index] ) {
+        return tid;
+    }
     ter_id result = tid;
     auto region_list = terrain.find( result );
     while( region_list != terrain.end() ) {
@@ -984,6 +1005,10 @@ ter_id region_terrain_and_furniture_settings::resolve( const ter_id &tid ) const
 
 furn_id region_terrain_and_furniture_settings::resolve( const furn_id &fid ) const
 {
+    const size_t index = fid.to_i();
+    if( index >= furniture_is_template.size() || !furniture_is_template[index] ) {
+        return fid;
+    }
     furn_id result = fid;
     auto region_list = furniture.find( result );
     while( region_list != furniture.end() ) {
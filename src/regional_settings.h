@@ -215,6 +215,11 @@ struct region_terrain_and_furniture_settings {
     std::map<std::string, std::map<std::string, int>> unfinalized_furniture;
     std::map<ter_id, weighted_int_list<ter_id>> terrain;
     std::map<furn_id, weighted_int_list<furn_id>> furniture;
+    // Whether an id is a key of terrain / furniture, indexed by id and built by finalize().
+    // Mapgen resolves every tile and most have no regional template, so this spares
+    // resolve() the map lookup for them.
+    std::vector<bool> terrain_is_template;
+    std::vector<bool> furniture_is_template;
 
     void finalize();
     ter_id resolve( const ter_id & ) const;
@@ -20,6 +20,9 @@ int rng( int lo, int hi )
     static std::uniform_int_distribution<int> rng_int_dist;
     if( lo > hi ) {
         std::swap( lo, hi );
+    } else if( lo == hi ) {
+        // No need to draw anything, callers often pass an empty range.
+        return lo;
     }
     return rng_int_dist( rng_get_engine(), std::uniform_int_distribution<>::param_type( lo, hi ) );
 }
@@ -68,7 +71,14 @@ bool one_turn_in( const time_duration &duration )
 
 bool x_in_y( double x, double y )
 {
-    return rng_float( 0.0, 1.0 ) <= x / y;
+    // Certain outcomes don't draw; a double takes two calls of the engine.
+    const double chance = x / y;
+    if( chance >= 1.0 ) {
+        return true;
+    } else if( chance <= 0.0 ) {
+        return false;
+    }
+    return rng_float( 0.0, 1.0 ) <= chance;
 }
 
 int dice( int number, int sides )
@@ -75,7 +75,7 @@ void game::serialize( std::ostream &fout )
     // Header
     fout << "# version " << savegame_version << std::endl;
 
-    JsonOut json( fout, true ); // pretty-print
+    JsonOut json( fout, !get_option<bool>( "COMPACT_SAVES" ) );
 
     json.start_object();
     // basic game state information.
@@ -115,31 +115,33 @@ void game::serialize( std::ostream &fout )
 
 std::string scent_map::serialize( bool is_type ) const
 {
-    std::ostringstream rle_out;
-    rle_out.imbue( std::locale::classic() );
     if( is_type ) {
-        rle_out << typescent.str();
-    } else {
-        int rle_lastval = -1;
-        int rle_count = 0;
-        for( auto &elem : grscent ) {
-            for( auto &val : elem ) {
-                if( val == rle_lastval ) {
-                    rle_count++;
-                } else {
-                    if( rle_count ) {
-                        rle_out << rle_count << " ";
-                    }
-                    rle_out << val << " ";
-                    rle_lastval = val;
-                    rle_count = 1;
+        return typescent.str();
+    }
+    // Built directly into a string rather than through an ostringstream; the
+    // grid is mostly long runs, so a small reservation usually suffices.
+    std::string rle_out;
+    rle_out.reserve( 256 );
+    int rle_lastval = -1;
+    int rle_count = 0;
+    for( auto &elem : grscent ) {
+        for( auto &val : elem ) {
+            if( val == rle_lastval ) {
+                rle_count++;
+            } else {
+                if( rle_count ) {
+                    rle_out += std::to_string( rle_count );
+                    rle_out += ' ';
                 }
+                rle_out += std::to_string( val );
+                rle_out += ' ';
+                rle_lastval = val;
+                rle_count = 1;
             }
         }
-        rle_out << rle_count;
     }
-
-    return rle_out.str();
+    rle_out += std::to_string( rle_count );
+    return rle_out;
 }
 
 static void chkversion( std::istream &fin )
@@ -1246,7 +1248,7 @@ void game::serialize_master( std::ostream &fout )
 {
     fout << "# version " << savegame_version << std::endl;
     try {
-        JsonOut json( fout, true ); // pretty-print
+        JsonOut json( fout, !get_option<bool>( "COMPACT_SAVES" ) );
         json.start_object();
 
         json.member( "next_mission_id", next_mission_id );
@@ -56,6 +56,7 @@
 #include "field.h"
 #include "field_type.h"
 #include "flat_set.h"
+#include "fstream_utils.h"
 #include "game.h"
 #include "game_constants.h"
 #include "int_id.h"
@@ -3043,7 +3044,12 @@ void Creature::store( JsonOut &jsout ) const
     jsout.member( "block_bonus", block_bonus );
     jsout.member( "hit_bonus", hit_bonus );
 
-    jsout.member( "body", body );
+    jsout.member( "body" );
+    jsout.start_object();
+    for( const bodypart &part : body ) {
+        jsout.member( part.get_id().id().str(), part );
+    }
+    jsout.end_object();
 
     // fake is not stored, it's temporary anyway, only used to fire with a gun.
 }
@@ -3102,7 +3108,10 @@ void Creature::load( const JsonObject &jsin )
 
     jsin.read( "underwater", underwater );
 
-    jsin.read( "body", body );
+    std::map<bodypart_str_id, bodypart> stored_body;
+    if( jsin.read( "body", stored_body ) ) {
+        set_body( stored_body );
+    }
 
     fake = false; // see Creature::load
 
@@ -3627,6 +3636,10 @@ void event_multiset::deserialize( JsonIn &jsin )
     std::vector<std::pair<cata::event::data_type, int>> copy;
     jo.read( "event_counts", copy );
     counts_ = { copy.begin(), copy.end() };
+    total_count_ = 0;
+    for( const counts_type::value_type &elem : counts_ ) {
+        total_count_ += elem.second;
+    }
 }
 
 void stats_tracker::serialize( JsonOut &jsout ) const
@@ -3646,9 +3659,17 @@ void stats_tracker::deserialize( JsonIn &jsin )
         d.second.set_type( d.first );
     }
     jo.read( "initial_scores", initial_scores );
+    // Cached statistics were computed from the replaced data.
+    stat_values.clear();
 }
 
 void submap::store( JsonOut &jsout ) const
+{
+    store_layers( jsout );
+    store_contents( jsout );
+}
+
+void submap::store_layers( JsonOut &jsout ) const
 {
     jsout.member( "turn_last_touched", last_touched );
     jsout.member( "temperature", temperature );
@@ -3738,20 +3759,6 @@ void submap::store( JsonOut &jsout ) const
     }
     jsout.end_array();
 
-    jsout.member( "items" );
-    jsout.start_array();
-    for( int j = 0; j < SEEY; j++ ) {
-        for( int i = 0; i < SEEX; i++ ) {
-            if( itm[i][j].empty() ) {
-                continue;
-            }
-            jsout.write( i );
-            jsout.write( j );
-            jsout.write( itm[i][j] );
-        }
-    }
-    jsout.end_array();
-
     jsout.member( "traps" );
     jsout.start_array();
     for( int j = 0; j < SEEY; j++ ) {
@@ -3769,6 +3776,65 @@ void submap::store( JsonOut &jsout ) const
         }
     }
     jsout.end_array();
+}
+
+/**
+ * Writes the items of one tile. Runs of items that serialize identically (spilled cans,
+ * piles of rags) are written once as `[ count, item ]` instead of once per item.
+ */
+static void store_items( JsonOut &jsout, const cata::colony<item> &items )
+{
+    std::string run_item;
+    int run_length = 0;
+    const auto write_run = [&]() {
+        if( run_length > 1 ) {
+            jsout.start_array();
+            jsout.write( run_length );
+        }
+        if( jsout.get_need_separator() ) {
+            jsout.write_separator();
+        }
+        *jsout.get_stream() << run_item;
+        jsout.set_need_separator();
+        if( run_length > 1 ) {
+            jsout.end_array();
+        }
+    };
+
+    jsout.start_array();
+    for( const item &it : items ) {
+        std::string serialized = serialize( it );
+        if( run_length > 0 && serialized == run_item ) {
+            run_length++;
+            continue;
+        }
+        if( run_length > 0 ) {
+            write_run();
+        }
+        run_item = std::move( serialized );
+        run_length = 1;
+    }
+    if( run_length > 0 ) {
+        write_run();
+    }
+    jsout.end_array();
+}
+
+void submap::store_contents( JsonOut &jsout ) const
+{
+    jsout.member( "items" );
+    jsout.start_array();
+    for( int j = 0; j < SEEY; j++ ) {
+        for( int i = 0; i < SEEX; i++ ) {
+            if( itm[i][j].empty() ) {
+                continue;
+            }
+            jsout.write( i );
+            jsout.write( j );
+            store_items( jsout, itm[i][j] );
+        }
+    }
+    jsout.end_array();
 
     jsout.member( "fields" );
     jsout.start_array();
@@ -3941,20 +4007,34 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
             const point p( i, j );
             jsin.start_array();
             while( !jsin.end_array() ) {
+                // a run of identical items is stored as [ count, item ]
+                int count = 1;
+                const bool is_run = jsin.test_array();
+                if( is_run ) {
+                    jsin.start_array();
+                    count = jsin.get_int();
+                }
                 item tmp;
                 jsin.read( tmp );
-
-                if( tmp.is_emissive() ) {
-                    update_lum_add( p, tmp );
+                if( is_run && !jsin.end_array() ) {
+                    jsin.error( "expected end of item run" );
                 }
 
                 if( savegame_loading_version >= 27 && version < 27 ) {
                     tmp.legacy_fast_forward_time();
                 }
 
-                const cata::colony<item>::iterator it = itm[p.x][p.y].insert( tmp );
-                if( tmp.needs_processing() ) {
-                    active_items.add( *it, p );
+                for( int n = 0; n < count; n++ ) {
+                    if( tmp.is_emissive() ) {
+                        update_lum_add( p, tmp );
+                    }
+
+                    const cata::colony<item>::iterator it = n + 1 == count ?
+                                                            itm[p.x][p.y].insert( std::move( tmp ) ) :
+                                                            itm[p.x][p.y].insert( tmp );
+                    if( it->needs_processing() ) {
+                        active_items.add( *it, p );
+                    }
                 }
             }
         }
@@ -3997,6 +4077,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                     field_count++;
                 }
                 fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) );
+                mark_field_tile( { i, j } );
             }
         }
     } else if( member_name == "graffiti" ) {
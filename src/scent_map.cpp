@@ -99,6 +99,17 @@ int scent_map::get( const tripoint &p ) const
     return 0;
 }
 
+int scent_map::get( const tripoint &p, scenttype_id &type ) const
+{
+    // Only checks the bounds once, which may involve a map lookup off the player's z-level.
+    if( inbounds( p ) && grscent[p.x][p.y] > 0 ) {
+        type = typescent;
+        return get_unsafe( p );
+    }
+    type = scenttype_id();
+    return 0;
+}
+
 void scent_map::set( const tripoint &p, int value, const scenttype_id &type )
 {
     if( inbounds( p ) ) {
@@ -159,13 +170,17 @@ void scent_map::update( const tripoint &center, map &m )
         return;
     }
 
-    // note: the next four intermediate matrices need to be at least
-    // [2*SCENT_RADIUS+3][2*SCENT_RADIUS+1] in size to hold enough data
+    // note: the intermediate matrices need to be at least
+    // [2*SCENT_RADIUS+3][2*SCENT_RADIUS+3] in size to hold enough data
     // The code I'm modifying used [MAPSIZE_X]. I'm staying with that to avoid new bugs.
 
-    // These two matrices are transposed so that x addresses are contiguous in memory
+    // All matrices are indexed [x][y], so the inner loops over y walk contiguous memory
+    // and stay free of branches, which lets the compiler vectorize them.
     scent_array<int> sum_3_scent_y;
     scent_array<int> squares_used_y;
+    // how much each square takes part in diffusion: 0 blocks it, 2 reduces it, 10 otherwise
+    scent_array<int> weight;
+    scent_array<int> weighted_scent;
 
     // these are for caching flag lookups
     scent_array<bool> blocks_scent; // currently only TFLAG_NO_SCENT blocks scent
@@ -191,22 +206,19 @@ void scent_map::update( const tripoint &center, map &m )
     // than the final scent matrix. I think this is fine since SCENT_RADIUS is less than
     // MAPSIZE_X, but if that changes, this may need tweaking.
     for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
+        // resolve the flags once per square instead of once per neighbor
+        for( int y = scentmap_miny - 1; y <= scentmap_maxy + 1; ++y ) {
+            // only 20% of scent can diffuse on REDUCE_SCENT squares
+            weight[x][y] = blocks_scent[x][y] ? 0 : reduces_scent[x][y] ? 2 : 10;
+        }
+        for( int y = scentmap_miny - 1; y <= scentmap_maxy + 1; ++y ) {
+            weighted_scent[x][y] = weight[x][y] * grscent[x][y];
+        }
+        // remember the sum of the scent val for the 3 neighboring squares that can defuse into
         for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
-            // remember the sum of the scent val for the 3 neighboring squares that can defuse into
-            sum_3_scent_y[y][x] = 0;
-            squares_used_y[y][x] = 0;
-            for( int i = y - 1; i <= y + 1; ++i ) {
-                if( !blocks_scent[x][i] ) {
-                    if( reduces_scent[x][i] ) {
-                        // only 20% of scent can diffuse on REDUCE_SCENT squares
-                        sum_3_scent_y[y][x] += 2 * grscent[x][i];
-                        squares_used_y[y][x] += 2;
-                    } else {
-                        sum_3_scent_y[y][x] += 10 * grscent[x][i];
-                        squares_used_y[y][x] += 10;
-                    }
-                }
-            }
+            sum_3_scent_y[x][y] = weighted_scent[x][y - 1] + weighted_scent[x][y]
+                                  + weighted_scent[x][y + 1];
+            squares_used_y[x][y] = weight[x][y - 1] + weight[x][y] + weight[x][y + 1];
         }
     }
 
@@ -217,9 +229,9 @@ void scent_map::update( const tripoint &center, map &m )
             if( !blocks_scent[x][y] ) {
                 // to how many neighboring squares do we diffuse out? (include our own square
                 // since we also include our own square when diffusing in)
-                const int squares_used = squares_used_y[y][x - 1]
-                                         + squares_used_y[y][x]
-                                         + squares_used_y[y][x + 1];
+                const int squares_used = squares_used_y[x - 1][y]
+                                         + squares_used_y[x][y]
+                                         + squares_used_y[x + 1][y];
 
                 int this_diffusivity;
                 if( !reduces_scent[x][y] ) {
@@ -236,9 +248,9 @@ void scent_map::update( const tripoint &center, map &m )
                 // diffuses into our current square.
                 scent_here =
                     ( temp_scent
-                      + this_diffusivity * ( sum_3_scent_y[y][x - 1]
-                                             + sum_3_scent_y[y][x]
-                                             + sum_3_scent_y[y][x + 1] )
+                      + this_diffusivity * ( sum_3_scent_y[x - 1][y]
+                                             + sum_3_scent_y[x][y]
+                                             + sum_3_scent_y[x + 1][y] )
                     ) / ( 1000 * 10 );
             } else {
                 // this cell blocks scent via NO_SCENT (in json)
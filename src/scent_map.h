@@ -73,6 +73,8 @@ class scent_map
         /**@{*/
         void set( const tripoint &p, int value, const scenttype_id &type = scenttype_id() );
         int get( const tripoint &p ) const;
+        /** As above, also setting @p type to what @ref get_type would return. */
+        int get( const tripoint &p, scenttype_id &type ) const;
         /**@}*/
         void set_unsafe( const tripoint &p, int value, const scenttype_id &type = scenttype_id() );
         int get_unsafe( const tripoint &p ) const;
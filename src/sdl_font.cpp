@@ -1,5 +1,8 @@
 #if defined(TILES)
 #include "sdl_font.h"
+
+#include <algorithm>
+
 #include "output.h"
 #include "platform_win.h"
 #include "string_utils.h"
@@ -176,6 +179,7 @@ CachedTTFFont::CachedTTFFont(
     std::string typeface, int fontsize,
     const bool fontblending )
     : Font( w, h, palette )
+    , atlas_size( std::max( 1024, w * 4 ), std::max( 1024, h * 4 ) )
     , fontblending( fontblending )
 {
     int faceIndex = 0;
@@ -270,8 +274,7 @@ CachedTTFFont::CachedTTFFont(
 }
 
 
-SDL_Texture_Ptr CachedTTFFont::create_glyph( SDL_Renderer_Ptr &renderer, const std::string &ch,
-        const int color )
+SDL_Surface_Ptr CachedTTFFont::create_glyph( const std::string &ch, const int color )
 {
     const auto function = fontblending ? TTF_RenderUTF8_Blended : TTF_RenderUTF8_Solid;
     SDL_Surface_Ptr sglyph( function( font.get(), ch.c_str(), windowsPalette[color] ) );
@@ -319,7 +322,47 @@ SDL_Texture_Ptr CachedTTFFont::create_glyph( SDL_Renderer_Ptr &renderer, const s
         sglyph = std::move( surface );
     }
 
-    return CreateTextureFromSurface( renderer, sglyph );
+    return sglyph;
+}
+
+void CachedTTFFont::add_to_atlas( SDL_Renderer_Ptr &renderer, const SDL_Surface_Ptr &glyph,
+                                  cached_t &entry )
+{
+    const SDL_Surface_Ptr converted(
+        SDL_ConvertSurfaceFormat( glyph.get(), SDL_PIXELFORMAT_ARGB8888, 0 ) );
+    if( printErrorIf( !converted, "SDL_ConvertSurfaceFormat failed" ) ) {
+        return;
+    }
+    if( converted->w > atlas_size.x || converted->h > atlas_size.y ) {
+        dbg( DL::Error ) << "Glyph of " << converted->w << "x" << converted->h
+                         << " does not fit into the font atlas";
+        return;
+    }
+    // One pixel between glyphs keeps scaled draws from picking up their neighbors.
+    if( atlas_cursor.x + converted->w > atlas_size.x ) {
+        atlas_cursor = point( 0, atlas_cursor.y + atlas_row_height + 1 );
+        atlas_row_height = 0;
+    }
+    if( atlas.empty() || atlas_cursor.y + converted->h > atlas_size.y ) {
+        SDL_Texture_Ptr page = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888,
+                                              SDL_TEXTUREACCESS_STATIC,
+                                              atlas_size.x, atlas_size.y );
+        if( !page ) {
+            return;
+        }
+        SetTextureBlendMode( page, SDL_BLENDMODE_BLEND );
+        atlas.push_back( std::move( page ) );
+        atlas_cursor = point_zero;
+        atlas_row_height = 0;
+    }
+    entry.src = { atlas_cursor.x, atlas_cursor.y, converted->w, converted->h };
+    if( printErrorIf( SDL_UpdateTexture( atlas.back().get(), &entry.src, converted->pixels,
+                                         converted->pitch ) != 0, "SDL_UpdateTexture failed" ) ) {
+        return;
+    }
+    entry.page = static_cast<int>( atlas.size() ) - 1;
+    atlas_cursor.x += converted->w + 1;
+    atlas_row_height = std::max( atlas_row_height, converted->h );
 }
 
 bool CachedTTFFont::isGlyphProvided( const std::string &ch ) const
@@ -336,24 +379,29 @@ void CachedTTFFont::OutputChar( SDL_Renderer_Ptr &renderer, GeometryRenderer_Ptr
     auto it = glyph_cache_map.find( key );
     if( it == std::end( glyph_cache_map ) ) {
         cached_t new_entry {
-            create_glyph( renderer, key.codepoints, key.color ),
+            -1, SDL_Rect(),
             static_cast<int>( width * utf8_wrapper( key.codepoints ).display_width() )
         };
+        const SDL_Surface_Ptr glyph = create_glyph( key.codepoints, key.color );
+        if( glyph ) {
+            add_to_atlas( renderer, glyph, new_entry );
+        }
         it = glyph_cache_map.insert( std::make_pair( std::move( key ), std::move( new_entry ) ) ).first;
     }
     const cached_t &value = it->second;
 
-    if( !value.texture ) {
+    if( value.page < 0 ) {
         // Nothing we can do here )-:
         return;
     }
+    const SDL_Texture_Ptr &texture = atlas[value.page];
     SDL_Rect rect {p.x, p.y, value.width, height};
     if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), opacity * 255.0f );
+        SDL_SetTextureAlphaMod( texture.get(), opacity * 255.0f );
     }
-    RenderCopy( renderer, value.texture, nullptr, &rect );
+    RenderCopy( renderer, texture, &value.src, &rect );
     if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), 255 );
+        SDL_SetTextureAlphaMod( texture.get(), 255 );
     }
 }
 
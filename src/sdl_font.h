@@ -83,10 +83,10 @@ class CachedTTFFont : public Font
                          const point &p,
                          unsigned char color, float opacity = 1.0f ) override;
     protected:
-        SDL_Texture_Ptr create_glyph( SDL_Renderer_Ptr &renderer, const std::string &ch, int color );
+        SDL_Surface_Ptr create_glyph( const std::string &ch, int color );
 
         TTF_Font_Ptr font;
-        // Maps (character code, color) to SDL_Texture*
+        // Maps (character code, color) to the glyph's place in the atlas
 
         struct key_t {
             std::string   codepoints;
@@ -108,12 +108,27 @@ class CachedTTFFont : public Font
         };
 
         struct cached_t {
-            SDL_Texture_Ptr texture;
+            // Index into @ref atlas, -1 if the glyph could not be rendered.
+            int          page;
+            SDL_Rect     src;
             int          width;
         };
 
+        /// Copies @p glyph into the last atlas page, starting a new one when it is full.
+        /// Leaves @p entry without a page if that fails.
+        void add_to_atlas( SDL_Renderer_Ptr &renderer, const SDL_Surface_Ptr &glyph,
+                           cached_t &entry );
+
         std::unordered_map<key_t, cached_t, key_t_hash> glyph_cache_map;
 
+        // Glyphs are packed row by row into a few large textures instead of getting one each,
+        // so consecutive characters come from the same texture and the renderer can batch them.
+        std::vector<SDL_Texture_Ptr> atlas;
+        point atlas_size;
+        // Where the next glyph goes in the last page, and the height of the row it is in.
+        point atlas_cursor;
+        int atlas_row_height = 0;
+
         const bool fontblending;
 };
 
@@ -12,6 +12,7 @@
 #include <exception>
 #include <memory>
 #include <ostream>
+#include <set>
 #include <utility>
 
 #if defined(_MSC_VER) && defined(USE_VCPKG)
@@ -20,7 +21,9 @@
 #    include <SDL_mixer.h>
 #endif
 
+#include "cata_parallel.h"
 #include "debug.h"
+#include "filesystem.h"
 #include "init.h"
 #include "json.h"
 #include "loading_ui.h"
@@ -290,6 +293,40 @@ static inline Mix_Chunk *get_sfx_resource( int resource_id )
     return resource.chunk.get();
 }
 
+/**
+ * Loads all of @p resource_ids that are not loaded yet. The files are read on several
+ * threads, but SDL_mixer is not thread-safe, so they are decoded one by one afterwards.
+ * Only a batch of files is held in memory at a time.
+ */
+static void preload_sfx_resources( const std::set<int> &resource_ids )
+{
+    static constexpr size_t batch_size = 64;
+    const std::vector<int> ids( resource_ids.begin(), resource_ids.end() );
+    std::vector<std::string> contents( std::min( batch_size, ids.size() ) );
+    for( size_t first = 0; first < ids.size(); first += batch_size ) {
+        const size_t count = std::min( batch_size, ids.size() - first );
+        cata::parallel_for( 0, static_cast<int>( count ), [&]( const int i ) {
+            const sound_effect_resource &resource = sfx_resources.resource[ids[first + i]];
+            contents[i] = read_entire_file( current_soundpack_path + "/" + resource.path );
+        } );
+        for( size_t i = 0; i < count; i++ ) {
+            Mix_Chunk *loaded = nullptr;
+            if( !contents[i].empty() ) {
+                SDL_RWops *const source = SDL_RWFromConstMem( contents[i].data(),
+                                          static_cast<int>( contents[i].size() ) );
+                loaded = source ? Mix_LoadWAV_RW( source, 1 ) : nullptr;
+            }
+            if( loaded ) {
+                sfx_resources.resource[ids[first + i]].chunk.reset( loaded );
+            } else {
+                // Try again from the file, which also reports the error.
+                get_sfx_resource( ids[first + i] );
+            }
+            std::string().swap( contents[i] );
+        }
+    }
+}
+
 static inline int add_sfx_path( const std::string &path )
 {
     auto find_result = unique_paths.find( path );
@@ -591,14 +628,18 @@ void load_soundset()
     }
 
     // Preload sound effects
+    std::set<int> preload_ids;
     for( const id_and_variant &preload : sfx_preload ) {
         const auto find_result = sfx_resources.sound_effects.find( preload );
         if( find_result != sfx_resources.sound_effects.end() ) {
             for( const auto &sfx : find_result->second ) {
-                get_sfx_resource( sfx.resource_id );
+                if( !sfx_resources.resource[sfx.resource_id].chunk ) {
+                    preload_ids.insert( sfx.resource_id );
+                }
             }
         }
     }
+    preload_sfx_resources( preload_ids );
 
     // Memory of unique_paths no longer required, swap with locally scoped unordered_map
     // to force deallocation of resources.
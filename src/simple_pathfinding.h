@@ -2,7 +2,9 @@
 #ifndef CATA_SRC_SIMPLE_PATHFINDING_H
 #define CATA_SRC_SIMPLE_PATHFINDING_H
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 #include <queue>
 #include <vector>
 
@@ -34,6 +36,83 @@ struct path {
     std::vector<node> nodes;
 };
 
+namespace detail
+{
+
+/**
+ * Per-node bookkeeping of a search. It is kept around between searches, and entries are
+ * stamped with the search that wrote them, so a search only pays for the nodes it touches
+ * instead of clearing the whole area up front.
+ */
+struct search_state {
+    std::vector<unsigned int> generation;
+    std::vector<int> open;
+    std::vector<short> dirs;
+    std::vector<bool> closed;
+    unsigned int current = 0;
+
+    void start( size_t size ) {
+        if( generation.size() < size ) {
+            generation.resize( size, 0 );
+            open.resize( size );
+            dirs.resize( size );
+            closed.resize( size );
+        }
+        if( ++current == 0 ) {
+            // Wrapped around, old stamps could be mistaken for the current search.
+            std::fill( generation.begin(), generation.end(), 0 );
+            current = 1;
+        }
+    }
+
+    // Resets the entry to "not seen yet" unless the current search already wrote it.
+    void touch( size_t n ) {
+        if( generation[n] != current ) {
+            generation[n] = current;
+            open[n] = 0;
+            dirs[n] = 0;
+            closed[n] = false;
+        }
+    }
+};
+
+/**
+ * Borrows a search state for the duration of one search. Searches can nest (the estimator
+ * may generate an overmap, which searches for roads), so each one gets its own.
+ */
+class search_state_lease
+{
+    public:
+        search_state_lease() {
+            std::vector<std::unique_ptr<search_state>> &pool = free_states();
+            if( pool.empty() ) {
+                state = std::make_unique<search_state>();
+            } else {
+                state = std::move( pool.back() );
+                pool.pop_back();
+            }
+        }
+        ~search_state_lease() {
+            free_states().push_back( std::move( state ) );
+        }
+        search_state_lease( const search_state_lease & ) = delete;
+        search_state_lease &operator=( const search_state_lease & ) = delete;
+
+        search_state &operator*() const {
+            return *state;
+        }
+
+    private:
+        static std::vector<std::unique_ptr<search_state>> &free_states() {
+            static std::vector<std::unique_ptr<search_state>> states;
+            return states;
+        }
+
+        std::unique_ptr<search_state> state;
+};
+
+} // namespace detail
+
 /**
  * @param source Starting point of path
  * @param dest End point of path
@@ -78,12 +157,16 @@ path find_path( const point &source,
 
     const size_t map_size = max.x * max.y;
 
-    std::vector<bool> closed( map_size, false );
-    std::vector<int> open( map_size, 0 );
-    std::vector<short> dirs( map_size, 0 );
+    const detail::search_state_lease lease;
+    detail::search_state &state = *lease;
+    state.start( map_size );
+    std::vector<bool> &closed = state.closed;
+    std::vector<int> &open = state.open;
+    std::vector<short> &dirs = state.dirs;
     std::priority_queue<node, std::vector<node>> nodes;
 
     nodes.push( first_node );
+    state.touch( map_index( source ) );
     open[map_index( source )] = std::numeric_limits<int>::max();
 
     // use A* to find the shortest path from (x1,y1) to (x2,y2)
@@ -94,6 +177,7 @@ path find_path( const point &source,
 
         nodes.pop();
         // mark it visited
+        state.touch( map_index( mn.pos ) );
         closed[map_index( mn.pos )] = true;
 
         // if we've reached the end, draw the path and return
@@ -120,7 +204,11 @@ path find_path( const point &source,
             // don't allow:
             // * out of bounds
             // * already traversed tiles
-            if( !inbounds( p ) || closed[n] ) {
+            if( !inbounds( p ) ) {
+                continue;
+            }
+            state.touch( n );
+            if( closed[n] ) {
                 continue;
             }
 
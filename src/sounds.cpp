@@ -1,6 +1,7 @@
 #include "sounds.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -14,6 +15,7 @@
 #include "avatar.h"
 #include "bodypart.h"
 #include "calendar.h"
+#include "cata_utility.h"
 #include "coordinate_conversions.h"
 #include "creature.h"
 #include "debug.h"
@@ -297,10 +299,62 @@ static int get_signal_for_hordes( const centroid &centr )
     return 0;
 }
 
+namespace
+{
+// Monsters bucketed by the submap they stand on, so each sound cluster only has to look at
+// the monsters that may be close enough to hear it.
+class listener_index
+{
+    public:
+        listener_index() {
+            for( monster &critter : g->all_monsters() ) {
+                const point sm = bucket_of( critter.pos().xy() );
+                buckets[sm.x][sm.y].push_back( listeners.size() );
+                listeners.push_back( &critter );
+            }
+        }
+
+        // Calls f on every monster within range squares of source (horizontally), in the
+        // same order g->all_monsters() yields them.
+        template<typename F>
+        void for_each_near( const tripoint &source, int range, F &&f ) {
+            if( range < 0 ) {
+                return;
+            }
+            const point lo = bucket_of( source.xy() - point( range, range ) );
+            const point hi = bucket_of( source.xy() + point( range, range ) );
+            candidates.clear();
+            for( int x = lo.x; x <= hi.x; ++x ) {
+                for( int y = lo.y; y <= hi.y; ++y ) {
+                    const std::vector<size_t> &bucket = buckets[x][y];
+                    candidates.insert( candidates.end(), bucket.begin(), bucket.end() );
+                }
+            }
+            std::sort( candidates.begin(), candidates.end() );
+            for( const size_t i : candidates ) {
+                f( *listeners[i] );
+            }
+        }
+
+    private:
+        // Positions outside the map are clamped onto the edge buckets, which keeps the range
+        // lookups conservative.
+        static point bucket_of( const point &p ) {
+            return point( clamp( p.x / SEEX, 0, MAPSIZE - 1 ),
+                          clamp( p.y / SEEY, 0, MAPSIZE - 1 ) );
+        }
+
+        std::vector<monster *> listeners;
+        std::array<std::array<std::vector<size_t>, MAPSIZE>, MAPSIZE> buckets;
+        std::vector<size_t> candidates;
+};
+} // namespace
+
 void sounds::process_sounds()
 {
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = weather::sound_attn( g->weather.weather );
+    listener_index listeners;
     for( const auto &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
         // If they later get physical effects from loud noises we'll have to change this
@@ -318,14 +372,16 @@ void sounds::process_sounds()
             overmap_buffer.signal_hordes( target, sig_power );
         }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        // sound_distance is never below the horizontal square distance, so only monsters
+        // closer than vol * 2 squares can pass the check below.
+        listeners.for_each_near( source, vol * 2 - 1, [&]( monster & critter ) {
             // TODO: Generalize this to Creature::hear_sound
             const int dist = sound_distance( source, critter.pos() );
             if( vol * 2 > dist ) {
                 // Exclude monsters that certainly won't hear the sound
                 critter.hear_sound( source, vol, dist );
             }
-        }
+        } );
     }
     recent_sounds.clear();
 }
@@ -29,11 +29,7 @@ void event_multiset::set_type( event_type type )
 
 int event_multiset::count() const
 {
-    int total = 0;
-    for( const auto &pair : counts_ ) {
-        total += pair.second;
-    }
-    return total;
+    return total_count_;
 }
 
 int event_multiset::count( const cata::event::data_type &criteria ) const
@@ -102,11 +98,13 @@ int event_multiset::maximum( const std::string &field ) const
 void event_multiset::add( const cata::event &e )
 {
     counts_[e.data()]++;
+    total_count_++;
 }
 
 void event_multiset::add( const counts_type::value_type &e )
 {
     counts_[e.first] += e.second;
+    total_count_ += e.second;
 }
 
 base_watcher::~base_watcher()
@@ -153,6 +151,10 @@ event_multiset stats_tracker::get_events(
 
 cata_variant stats_tracker::value_of( const string_id<event_statistic> &stat )
 {
+    auto it = stat_values.find( stat );
+    if( it != stat_values.end() ) {
+        return it->second;
+    }
     return stat->value( *this );
 }
 
@@ -180,6 +182,7 @@ void stats_tracker::add_watcher( const string_id<event_statistic> &id, stat_watc
     std::unique_ptr<stats_tracker_state> &state = stat_states[ id ];
     if( !state ) {
         state = id->watch( *this );
+        stat_values[id] = id->value( *this );
     }
 }
 
@@ -227,6 +230,10 @@ void stats_tracker::transformed_set_changed( const string_id<event_transformatio
 void stats_tracker::stat_value_changed( const string_id<event_statistic> &id,
                                         const cata_variant &new_value )
 {
+    auto cached = stat_values.find( id );
+    if( cached != stat_values.end() ) {
+        cached->second = new_value;
+    }
     auto it = stat_watchers.find( id );
     if( it != stat_watchers.end() ) {
         it->second.send_to_all( &stat_watcher::new_value, new_value, *this );
@@ -250,6 +257,7 @@ void stats_tracker::clear()
     data.clear();
     event_transformation_states.clear();
     stat_states.clear();
+    stat_values.clear();
     initial_scores.clear();
 }
 
@@ -76,6 +76,8 @@ class event_multiset
     private:
         event_type type_;
         counts_type counts_;
+        // Sum of all counts, kept up to date so the plain count() is O(1).
+        int total_count_ = 0;
 };
 
 class base_watcher
@@ -190,6 +192,9 @@ class stats_tracker : public event_subscriber
                 event_transformation_states;
         std::unordered_map<string_id<event_statistic>, std::unique_ptr<stats_tracker_state>>
                 stat_states;
+        // Current values of the statistics in stat_states, which keep them up to date via
+        // stat_value_changed, so value_of need not rescan the events for them.
+        std::unordered_map<string_id<event_statistic>, cata_variant> stat_values;
 
         std::unordered_set<string_id<score>> initial_scores;
 };
@@ -23,8 +23,15 @@ inline static ReverseLookupVecType &get_reverse_lookup_vec()
 template<typename S>
 inline static int universal_string_id_intern( S &&s )
 {
+    InternMapType &map = get_intern_map();
+    // Almost all ids are already interned, look them up first: `emplace` would
+    // allocate a node (and copy the string) before finding out it's not needed.
+    const auto iter = map.find( s );
+    if( iter != map.end() ) {
+        return iter->second;
+    }
     int next_id = get_reverse_lookup_vec().size();
-    const auto &pair = get_intern_map().emplace( std::forward<S>( s ), next_id );
+    const auto &pair = map.emplace( std::forward<S>( s ), next_id );
     if( pair.second ) { // inserted
         get_reverse_lookup_vec().push_back( &pair.first->first );
     }
@@ -11,8 +11,10 @@
 
 bool lcmatch( const std::string &str, const std::string &qry )
 {
-    if( std::locale().name() != "en_US.UTF-8" && std::locale().name() != "C" ) {
-        auto &f = std::use_facet<std::ctype<wchar_t>>( std::locale() );
+    const std::locale loc;
+    const std::string loc_name = loc.name();
+    if( loc_name != "en_US.UTF-8" && loc_name != "C" ) {
+        auto &f = std::use_facet<std::ctype<wchar_t>>( loc );
         std::wstring wneedle = utf8_to_wstr( qry );
         std::wstring whaystack = utf8_to_wstr( str );
 
@@ -227,6 +227,49 @@ bool submap::contains_vehicle( vehicle *veh )
     return match != vehicles.end();
 }
 
+int submap::next_field_tile( int from ) const
+{
+    for( size_t word = from / 64; word < field_tiles.size(); ++word ) {
+        std::uint64_t bits = field_tiles[word];
+        size_t index = word * 64;
+        if( word == static_cast<size_t>( from ) / 64 ) {
+            bits >>= from % 64;
+            index = from;
+        }
+        if( bits == 0 ) {
+            continue;
+        }
+        while( ( bits & 1 ) == 0 ) {
+            bits >>= 1;
+            ++index;
+        }
+        return std::min( static_cast<int>( index ), static_cast<int>( elements ) );
+    }
+    return elements;
+}
+
+const std::vector<std::pair<point, int>> &submap::get_light_emitters()
+{
+    if( !light_emitters_dirty ) {
+        return light_emitters;
+    }
+    light_emitters.clear();
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            const int ter_light = ter[x][y].obj().light_emitted;
+            if( ter_light > 0 ) {
+                light_emitters.emplace_back( point( x, y ), ter_light );
+            }
+            const int furn_light = frn[x][y].obj().light_emitted;
+            if( furn_light > 0 ) {
+                light_emitters.emplace_back( point( x, y ), furn_light );
+            }
+        }
+    }
+    light_emitters_dirty = false;
+    return light_emitters;
+}
+
 void submap::rotate( int turns )
 {
     turns = turns % 4;
@@ -234,6 +277,7 @@ void submap::rotate( int turns )
     if( turns == 0 ) {
         return;
     }
+    light_emitters_dirty = true;
 
     const auto rotate_point = [turns]( const point & p ) {
         return p.rotate( turns, { SEEX, SEEY } );
@@ -270,6 +314,11 @@ void submap::rotate( int turns )
         }
     }
 
+    if( field_count > 0 ) {
+        // fields moved along with their tiles
+        mark_all_field_tiles();
+    }
+
     active_items.rotate_locations( turns, { SEEX, SEEY } );
 
     for( auto &elem : cosmetics ) {
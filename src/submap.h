@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_SUBMAP_H
 #define CATA_SRC_SUBMAP_H
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -9,6 +10,7 @@
 #include <string>
 #include <iterator>
 #include <map>
+#include <utility>
 
 #include "active_item_cache.h"
 #include "active_tile_data.h"
@@ -89,10 +91,12 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_furn( const point &p, furn_id furn ) {
             is_uniform = false;
+            light_emitters_dirty = true;
             frn[p.x][p.y] = furn;
         }
 
         void set_all_furn( const furn_id &furn ) {
+            light_emitters_dirty = true;
             std::uninitialized_fill_n( &frn[0][0], elements, furn );
         }
 
@@ -102,10 +106,12 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_ter( const point &p, ter_id terr ) {
             is_uniform = false;
+            light_emitters_dirty = true;
             ter[p.x][p.y] = terr;
         }
 
         void set_all_ter( const ter_id &terr ) {
+            light_emitters_dirty = true;
             std::uninitialized_fill_n( &ter[0][0], elements, terr );
         }
 
@@ -226,6 +232,11 @@ class submap : maptile_soa<SEEX, SEEY>
         void rotate( int turns );
 
         void store( JsonOut &jsout ) const;
+        /** The per tile layers written by @ref store: terrain, furniture, traps and radiation,
+         * as well as the submap temperature and last touched time. */
+        void store_layers( JsonOut &jsout ) const;
+        /** Everything else @ref store writes: items, fields, vehicles and so on. */
+        void store_contents( JsonOut &jsout ) const;
         void load( JsonIn &jsin, const std::string &member_name, int version );
 
         // If is_uniform is true, this submap is a solid block of terrain
@@ -237,6 +248,35 @@ class submap : maptile_soa<SEEX, SEEY>
         active_item_cache active_items;
 
         int field_count = 0;
+        /**
+         * Tracks the tiles that may hold a field, so field processing can skip the rest.
+         * Tiles are marked whenever a field is added to them and unmarked only by field
+         * processing once it finds them empty, so a marked tile can be empty but an
+         * unmarked tile never holds a field.
+         */
+        /**@{*/
+        void mark_field_tile( const point &p ) {
+            const size_t index = p.x * SEEY + p.y;
+            field_tiles[index / 64] |= std::uint64_t( 1 ) << ( index % 64 );
+        }
+        void unmark_field_tile( const point &p ) {
+            const size_t index = p.x * SEEY + p.y;
+            field_tiles[index / 64] &= ~( std::uint64_t( 1 ) << ( index % 64 ) );
+        }
+        void mark_all_field_tiles() {
+            field_tiles.fill( ~std::uint64_t( 0 ) );
+        }
+        /**
+         * First marked tile at or after @p from, as an index of `x * SEEY + y`.
+         * @returns SEEX * SEEY if there is none.
+         */
+        int next_field_tile( int from ) const;
+        /**@}*/
+        /**
+         * Tiles whose terrain or furniture emits light, with the amount emitted, one entry
+         * per emitting layer. Rebuilt on the first call after either layer changed.
+         */
+        const std::vector<std::pair<point, int>> &get_light_emitters();
         time_point last_touched = calendar::turn_zero;
         std::vector<spawn_point> spawns;
         /**
@@ -257,6 +297,11 @@ class submap : maptile_soa<SEEX, SEEY>
         void update_legacy_computer();
 
         static constexpr size_t elements = SEEX * SEEY;
+
+        std::array<std::uint64_t, ( elements + 63 ) / 64> field_tiles = {};
+
+        std::vector<std::pair<point, int>> light_emitters;
+        bool light_emitters_dirty = true;
 };
 
 /**
@@ -175,20 +175,20 @@ static float addiction_scaling( float at_min, float at_max, float add_lvl )
 
 void Character::suffer_water_damage( const mutation_branch &mdata )
 {
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-        const float wetness_percentage = static_cast<float>( body_wetness[elem.first->token] ) /
-                                         drench_capacity[elem.first->token];
+    for( const bodypart &elem : get_body() ) {
+        const float wetness_percentage = static_cast<float>( body_wetness[elem.get_id()->token] ) /
+                                         drench_capacity[elem.get_id()->token];
         const int dmg = mdata.weakness_to_water * wetness_percentage;
         if( dmg > 0 ) {
-            apply_damage( nullptr, elem.first, dmg );
+            apply_damage( nullptr, elem.get_id(), dmg );
             add_msg_player_or_npc( m_bad, _( "Your %s is damaged by the water." ),
                                    _( "<npcname>'s %s is damaged by the water." ),
-                                   body_part_name( elem.first ) );
-        } else if( dmg < 0 && elem.second.is_at_max_hp() ) {
-            heal( elem.first, std::abs( dmg ) );
+                                   body_part_name( elem.get_id() ) );
+        } else if( dmg < 0 && elem.is_at_max_hp() ) {
+            heal( elem.get_id(), std::abs( dmg ) );
             add_msg_player_or_npc( m_good, _( "Your %s is healed by the water." ),
                                    _( "<npcname>'s %s is healed by the water." ),
-                                   body_part_name( elem.first ) );
+                                   body_part_name( elem.get_id() ) );
         }
     }
 }
@@ -1405,9 +1405,9 @@ void Character::suffer()
 {
     const int current_stim = get_stim();
     // TODO: Remove this section and encapsulate hp_cur
-    for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
-        if( elem.second.get_hp_cur() <= 0 ) {
-            add_effect( effect_disabled, 1_turns, elem.first->token );
+    for( const bodypart &elem : get_body() ) {
+        if( elem.get_hp_cur() <= 0 ) {
+            add_effect( effect_disabled, 1_turns, elem.get_id()->token );
         }
     }
 
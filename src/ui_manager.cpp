@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "cached_options.h"
 #include "cursesdef.h"
 #include "game_ui.h"
 #include "point.h"
@@ -240,7 +241,8 @@ void ui_adaptor::redraw_invalidated()
              it != ui_stack_copy.cend(); ++it ) {
             const ui_adaptor &ui = *it;
             if( ui.invalidated ) {
-                if( ui.redraw_cb ) {
+                // Nothing is displayed in test mode, so only keep the UI state consistent.
+                if( ui.redraw_cb && !test_mode ) {
                     ui.redraw_cb( ui );
                 }
                 ui.invalidated = false;
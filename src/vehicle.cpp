@@ -855,20 +855,16 @@ void vehicle::drive_to_local_target( const tripoint &target, bool follow_protoco
                 break;
             }
         }
-        bool its_a_pet = false;
         if( g->critter_at( tripoint( elem, sm_pos.z ) ) ) {
             npc *guy = g->critter_at<npc>( tripoint( elem, sm_pos.z ) );
             if( guy && !guy->in_vehicle ) {
                 stop = true;
                 break;
             }
-            for( const auto &p : parts ) {
-                monster *mon = get_pet( index_of_part( &p ) );
-                if( mon && mon->pos().xy() == elem ) {
-                    its_a_pet = true;
-                    break;
-                }
-            }
+            // A pet riding on one of our boardable parts is no obstacle. Any vehicle here is
+            // us (others stopped us above), so check that tile instead of every part.
+            const bool its_a_pet = ovp && ovp->part_with_feature( VPFLAG_BOARDABLE, false ) &&
+                                   g->critter_at<monster>( tripoint( elem, sm_pos.z ), true );
             if( !its_a_pet ) {
                 stop = true;
                 break;
@@ -1629,6 +1625,23 @@ int vehicle::install_part( const point &dp, const vpart_id &id, item &&obj, bool
 }
 
 int vehicle::install_part( const point &dp, const vehicle_part &new_part )
+{
+    const int result = install_part_without_refresh( dp, new_part );
+    refresh();
+    return result;
+}
+
+void vehicle::install_parts_from( const vehicle &other )
+{
+    const tripoint origin = global_pos3();
+    for( const vehicle_part &part : other.parts ) {
+        // TODO: change mount points to be tripoint
+        install_part_without_refresh( ( other.global_part_pos3( part ) - origin ).xy(), part );
+    }
+    refresh();
+}
+
+int vehicle::install_part_without_refresh( const point &dp, const vehicle_part &new_part )
 {
     // Should be checked before installing the part
     bool enable = false;
@@ -1675,7 +1688,6 @@ int vehicle::install_part( const point &dp, const vehicle_part &new_part )
 
     pt.mount = dp;
 
-    refresh();
     coeff_air_changed = true;
     return parts.size() - 1;
 }
@@ -2477,16 +2489,27 @@ std::vector<int> vehicle::parts_at_relative( const point &dp,
         }
         return res;
     } else {
-        const auto &iter = relative_parts.find( dp );
-        if( iter != relative_parts.end() ) {
-            return iter->second;
-        } else {
-            std::vector<int> res;
-            return res;
-        }
+        return parts_at_relative_cached( dp );
     }
 }
 
+const std::vector<int> &vehicle::parts_at_relative_cached( const point &dp ) const
+{
+    static const std::vector<int> no_parts;
+    const int index = relative_parts_index( dp );
+    return index < 0 ? no_parts : relative_parts[index];
+}
+
+int vehicle::relative_parts_index( const point &dp ) const
+{
+    const point rel = dp - relative_parts_origin;
+    if( rel.x < 0 || rel.y < 0 || rel.x >= relative_parts_size.x ||
+        rel.y >= relative_parts_size.y ) {
+        return -1;
+    }
+    return rel.x * relative_parts_size.y + rel.y;
+}
+
 cata::optional<vpart_reference> vpart_position::obstacle_at_part() const
 {
     const cata::optional<vpart_reference> part = part_with_feature( VPFLAG_OBSTACLE, true );
@@ -2557,13 +2580,9 @@ int vehicle::part_with_feature( int part, vpart_bitflags const flag, bool unbrok
     if( part_flag( part, flag ) && ( !unbroken || !parts[part].is_broken() ) ) {
         return part;
     }
-    const auto it = relative_parts.find( parts[part].mount );
-    if( it != relative_parts.end() ) {
-        const std::vector<int> &parts_here = it->second;
-        for( auto &i : parts_here ) {
-            if( part_flag( i, flag ) && ( !unbroken || !parts[i].is_broken() ) ) {
-                return i;
-            }
+    for( const int i : parts_at_relative_cached( parts[part].mount ) ) {
+        if( part_flag( i, flag ) && ( !unbroken || !parts[i].is_broken() ) ) {
+            return i;
         }
     }
     return -1;
@@ -2698,10 +2717,10 @@ void vpart_position::set_label( const std::string &text ) const
 
 int vehicle::next_part_to_close( int p, bool outside ) const
 {
-    std::vector<int> parts_here = parts_at_relative( parts[p].mount, true );
+    const std::vector<int> &parts_here = parts_at_relative_cached( parts[p].mount );
 
     // We want reverse, since we close the outermost thing first (curtains), and then the innermost thing (door)
-    for( std::vector<int>::reverse_iterator part_it = parts_here.rbegin();
+    for( std::vector<int>::const_reverse_iterator part_it = parts_here.rbegin();
          part_it != parts_here.rend();
          ++part_it ) {
 
@@ -2717,7 +2736,7 @@ int vehicle::next_part_to_close( int p, bool outside ) const
 
 int vehicle::next_part_to_open( int p, bool outside ) const
 {
-    std::vector<int> parts_here = parts_at_relative( parts[p].mount, true );
+    const std::vector<int> &parts_here = parts_at_relative_cached( parts[p].mount );
 
     // We want forwards, since we open the innermost thing first (curtains), and then the innermost thing (door)
     for( auto &elem : parts_here ) {
@@ -3029,8 +3048,7 @@ int vehicle::part_displayed_at( const point &dp ) const
 
 int vehicle::roof_at_part( const int part ) const
 {
-    std::vector<int> parts_in_square = parts_at_relative( parts[part].mount, true );
-    for( const int p : parts_in_square ) {
+    for( const int p : parts_at_relative_cached( parts[part].mount ) ) {
         if( part_info( p ).location == "on_roof" || part_flag( p, "ROOF" ) ) {
             return p;
         }
@@ -3268,7 +3286,7 @@ int vehicle::fuel_left( const itype_id &ftype, bool recurse ) const
             }
         }
         // As do any other engine flagged as perpetual
-    } else if( item( ftype ).has_flag( "PERPETUAL" ) ) {
+    } else if( item::find_type( ftype )->has_flag( flag_PERPETUAL ) ) {
         fl += 10;
     }
 
@@ -3708,7 +3726,7 @@ void vehicle::spew_field( double joules, int part, field_type_id type, int inten
     point p = parts[part].mount;
     intensity = std::max( joules / 10000, static_cast<double>( intensity ) );
     // Move back from engine/muffler until we find an open space
-    while( relative_parts.find( p ) != relative_parts.end() ) {
+    while( !parts_at_relative_cached( p ).empty() ) {
         p.x += ( velocity < 0 ? 1 : -1 );
     }
     point q = coord_translate( p );
@@ -3895,7 +3913,7 @@ double vehicle::coeff_air_drag() const
                   p.info().has_flag( "OPENABLE" ) );
     };
 
-    const auto d_protrusion = [&]( std::vector<int> parts_at ) {
+    const auto d_protrusion = [&]( const std::vector<int> &parts_at ) {
         if( parts_at.size() > 1 ) {
             return false;
         } else {
@@ -3918,7 +3936,7 @@ double vehicle::coeff_air_drag() const
             continue;
         }
         int col = parts[ p ].mount.y - mount_min.y;
-        std::vector<int> parts_at = parts_at_relative( parts[ p ].mount, true );
+        const std::vector<int> &parts_at = parts_at_relative_cached( parts[ p ].mount );
         d_check_min( drag[ col ].pro, parts[ p ], d_protrusion( parts_at ) );
         for( int pa_index : parts_at ) {
             const vehicle_part &pa = parts[ pa_index ];
@@ -4983,8 +5001,9 @@ int vehicle::charge_battery( int amount, bool include_other_vehicles )
 {
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> chargeable_parts;
-    for( vehicle_part &p : parts ) {
-        if( p.is_available() && p.is_battery() && p.ammo_capacity() > p.ammo_remaining() ) {
+    for( const int bat : batteries ) {
+        vehicle_part &p = parts[bat];
+        if( p.is_available() && p.ammo_capacity() > p.ammo_remaining() ) {
             chargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
         }
     }
@@ -5028,8 +5047,9 @@ int vehicle::discharge_battery( int amount, bool recurse )
 {
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> dischargeable_parts;
-    for( vehicle_part &p : parts ) {
-        if( p.is_available() && p.is_battery() && p.ammo_remaining() > 0 ) {
+    for( const int bat : batteries ) {
+        vehicle_part &p = parts[bat];
+        if( p.is_available() && p.ammo_remaining() > 0 ) {
             dischargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
         }
     }
@@ -5540,7 +5560,6 @@ void vehicle::refresh()
     water_wheels.clear();
     funnels.clear();
     emitters.clear();
-    relative_parts.clear();
     loose_parts.clear();
     wheelcache.clear();
     rail_wheelcache.clear();
@@ -5548,6 +5567,7 @@ void vehicle::refresh()
     steering.clear();
     speciality.clear();
     floating.clear();
+    batteries.clear();
     alternator_load = 0;
     extra_drag = 0;
     all_wheels_on_one_axis = true;
@@ -5573,6 +5593,27 @@ void vehicle::refresh()
 
     bool refresh_done = false;
 
+    // Size the part grid to the bounding box of the mount points.
+    point grid_min( INT_MAX, INT_MAX );
+    point grid_max( INT_MIN, INT_MIN );
+    for( const vehicle_part &vp : parts ) {
+        if( !vp.removed ) {
+            grid_min.x = std::min( grid_min.x, vp.mount.x );
+            grid_min.y = std::min( grid_min.y, vp.mount.y );
+            grid_max.x = std::max( grid_max.x, vp.mount.x );
+            grid_max.y = std::max( grid_max.y, vp.mount.y );
+        }
+    }
+    relative_parts.clear();
+    if( grid_min.x <= grid_max.x ) {
+        relative_parts_origin = grid_min;
+        relative_parts_size = grid_max - grid_min + point( 1, 1 );
+    } else {
+        relative_parts_origin = point_zero;
+        relative_parts_size = point_zero;
+    }
+    relative_parts.resize( relative_parts_size.x * relative_parts_size.y );
+
     // Main loop over all vehicle parts.
     for( const vpart_reference &vp : get_all_parts() ) {
         const size_t p = vp.part_index();
@@ -5590,14 +5631,18 @@ void vehicle::refresh()
         mount_max.y = std::max( mount_max.y, pt.y );
 
         // This will keep the parts at point pt sorted
-        std::vector<int>::iterator vii = std::lower_bound( relative_parts[pt].begin(),
-                                         relative_parts[pt].end(),
+        std::vector<int> &parts_here = relative_parts[relative_parts_index( pt )];
+        std::vector<int>::iterator vii = std::lower_bound( parts_here.begin(), parts_here.end(),
                                          static_cast<int>( p ), svpv );
-        relative_parts[pt].insert( vii, p );
+        parts_here.insert( vii, p );
 
         if( vpi.has_flag( VPFLAG_FLOATS ) ) {
             floating.push_back( p );
         }
+        // Broken batteries are skipped where the list is used
+        if( vp.part().is_battery() ) {
+            batteries.push_back( p );
+        }
 
         if( vp.part().is_unavailable() ) {
             continue;
@@ -5700,6 +5745,35 @@ void vehicle::refresh()
     invalidate_mass();
 }
 
+/**
+ * A part that breaks only drops out of the lists of available parts, so it is erased from
+ * those instead of rebuilding everything. Parts whose state affects other parts or the
+ * bounding boxes computed by refresh() still get a full refresh.
+ */
+void vehicle::refresh_broken_part( const int p )
+{
+    if( no_refresh ) {
+        return;
+    }
+    const vpart_info &vpi = part_info( p );
+    if( vpi.has_flag( "STEERABLE" ) || vpi.has_flag( "TRACKED" ) || vpi.has_flag( VPFLAG_RAIL ) ||
+        vpi.has_flag( "EXTRA_DRAG" ) || vpi.has_flag( "TURRET_CONTROLS" ) ) {
+        refresh();
+        return;
+    }
+    for( std::vector<int> *part_list : {
+             &alternators, &engines, &reactors, &solar_panels, &rotors, &wind_turbines, &sails,
+             &water_wheels, &funnels, &loose_parts, &emitters, &wheelcache, &speciality
+         } ) {
+        std::vector<int> &l = *part_list;
+        l.erase( std::remove( l.begin(), l.end(), p ), l.end() );
+    }
+    check_environmental_effects = true;
+    insides_dirty = true;
+    zones_dirty = true;
+    invalidate_mass();
+}
+
 const point &vehicle::pivot_point() const
 {
     if( pivot_dirty ) {
@@ -6525,6 +6599,7 @@ int vehicle::damage_direct( int p, int dmg, damage_type type )
 
     dmg -= std::min<int>( dmg, part_info( p ).damage_reduction[ type ] );
     int dres = dmg - parts[p].hp();
+    const bool was_available = parts[p].is_available();
     if( mod_hp( parts[ p ], 0 - dmg, type ) ) {
         insides_dirty = true;
         pivot_dirty = true;
@@ -6541,7 +6616,11 @@ int vehicle::damage_direct( int p, int dmg, damage_type type )
         coeff_air_changed = true;
 
         // refresh cache in case the broken part has changed the status
-        refresh();
+        if( was_available ) {
+            refresh_broken_part( p );
+        } else {
+            refresh();
+        }
     }
 
     if( parts[p].is_fuel_store() ) {
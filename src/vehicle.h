@@ -688,6 +688,10 @@ class vehicle
 
         //Refresh all caches and re-locate all parts
         void refresh();
+        // Cheaper refresh() for when part p just broke, see there
+        void refresh_broken_part( int p );
+        // install_part without the refresh, for installing several parts in a row
+        int install_part_without_refresh( const point &dp, const vehicle_part &part );
 
         // Do stuff like clean up blood and produce smoke from broken parts. Returns false if nothing needs doing.
         bool do_environmental_effects();
@@ -875,6 +879,12 @@ class vehicle
 
         // Install a copy of the given part, skips possibility check
         int install_part( const point &dp, const vehicle_part &part );
+        /**
+         * Install copies of all parts of the other vehicle, at the same global positions,
+         * skips possibility checks. Refreshes only once at the end, unlike calling
+         * install_part for each part.
+         */
+        void install_parts_from( const vehicle &other );
 
         /** install item specified item to vehicle as a vehicle part */
         int install_part( const point &dp, const vpart_id &id, item &&obj, bool force = false );
@@ -970,6 +980,8 @@ class vehicle
 
         // returns the list of indices of parts at certain position (not accounting frame direction)
         std::vector<int> parts_at_relative( const point &dp, bool use_cache ) const;
+        // same as parts_at_relative( dp, true ), without copying; invalidated by refresh()
+        const std::vector<int> &parts_at_relative_cached( const point &dp ) const;
 
         // returns index of part, inner to given, with certain flag, or -1
         int part_with_feature( int p, const std::string &f, bool unbroken ) const;
@@ -1754,6 +1766,7 @@ class vehicle
         // List of parts that will not be on a vehicle very often, or which only one will be present
         std::vector<int> speciality;
         std::vector<int> floating;         // List of parts that provide buoyancy to boats
+        std::vector<int> batteries;        // List of battery indices
 
         // config values
         std::string name;   // vehicle name
@@ -1763,8 +1776,6 @@ class vehicle
          * spawned with the default constructor).
          */
         vproto_id type;
-        // parts_at_relative(dp) is used a lot (to put it mildly)
-        std::map<point, std::vector<int>> relative_parts;
         std::set<label> labels;            // stores labels
         std::set<std::string> tags;        // Properties of the vehicle
         // After fuel consumption, this tracks the remainder of fuel < 1, and applies it the next time.
@@ -1786,6 +1797,13 @@ class vehicle
          */
         mutable point mount_max;
         mutable point mount_min;
+        // parts_at_relative(dp) is used a lot (to put it mildly), so refresh() stores the
+        // parts of each mount point in a grid over the mount points, see relative_parts_index
+        std::vector<std::vector<int>> relative_parts;
+        point relative_parts_origin;
+        point relative_parts_size;
+        // index into relative_parts, -1 if dp is outside the grid
+        int relative_parts_index( const point &dp ) const;
         mutable point mass_center_precalc;
         mutable point mass_center_no_precalc;
         tripoint autodrive_local_target = tripoint_zero; // current node the autopilot is aiming for
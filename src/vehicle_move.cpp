@@ -499,12 +499,9 @@ veh_collision vehicle::part_collision( int part, const tripoint &p,
     // Vertical collisions need to be handled differently
     // All collisions have to be either fully vertical or fully horizontal for now
     const bool vert_coll = bash_floor || p.z != sm_pos.z;
-    const bool pl_ctrl = player_in_control( g->u );
     Creature *critter = g->critter_at( p, true );
     player *ph = dynamic_cast<player *>( critter );
 
-    Creature *driver = pl_ctrl ? &g->u : nullptr;
-
     // If in a vehicle assume it's this one
     if( ph != nullptr && ph->in_vehicle ) {
         critter = nullptr;
@@ -593,12 +590,13 @@ veh_collision vehicle::part_collision( int part, const tripoint &p,
     } else if( ( bash_floor && g->m.is_bashable_ter_furn( p, true ) ) ||
                ( g->m.is_bashable_ter_furn( p, false ) && g->m.move_cost_ter_furn( p ) != 2 &&
                  // Don't collide with tiny things, like flowers, unless we have a wheel in our space.
-                 ( part_with_feature( ret.part, VPFLAG_WHEEL, true ) >= 0 ||
-                   !g->m.has_flag_ter_or_furn( "TINY", p ) ) &&
+                 ( !g->m.has_flag_ter_or_furn( "TINY", p ) ||
+                   part_with_feature( ret.part, VPFLAG_WHEEL, true ) >= 0 ) &&
                  // Protrusions don't collide with short terrain.
                  // Tiny also doesn't, but it's already excluded unless there's a wheel present.
-                 !( part_with_feature( ret.part, "PROTRUSION", true ) >= 0 &&
-                    g->m.has_flag_ter_or_furn( "SHORT", p ) ) &&
+                 // The map flags are checked first, the part lookups are much slower.
+                 !( g->m.has_flag_ter_or_furn( "SHORT", p ) &&
+                    part_with_feature( ret.part, "PROTRUSION", true ) >= 0 ) &&
                  // These are bashable, but don't interact with vehicles.
                  !g->m.has_flag_ter_or_furn( "NOCOLLIDE", p ) &&
                  // Do not collide with track tiles if we can use rails
@@ -621,6 +619,9 @@ veh_collision vehicle::part_collision( int part, const tripoint &p,
         // Hit nothing or we aren't actually hitting
         return ret;
     }
+    // Only looked up once something is hit, this has to search the parts of the vehicle.
+    const bool pl_ctrl = player_in_control( g->u );
+    Creature *driver = pl_ctrl ? &g->u : nullptr;
     stop_autodriving();
     // Calculate mass AFTER checking for collision
     //  because it involves iterating over all cargo
@@ -28,6 +28,8 @@
 static const itype_id fuel_type_battery( "battery" );
 static const itype_id fuel_type_none( "null" );
 
+static const ammotype ammo_battery( "battery" );
+
 /*-----------------------------------------------------------------------------
  *                              VEHICLE_PART
  *-----------------------------------------------------------------------------*/
@@ -208,7 +210,7 @@ bool vehicle_part::fuel_set( const itype_id &fuel )
 itype_id vehicle_part::ammo_current() const
 {
     if( is_battery() ) {
-        return "battery";
+        return fuel_type_battery;
     }
 
     if( is_tank() && !base.contents.empty() ) {
@@ -490,7 +492,7 @@ bool vehicle_part::is_tank() const
 
 bool vehicle_part::is_battery() const
 {
-    return base.is_magazine() && base.ammo_types().count( ammotype( "battery" ) );
+    return base.is_magazine() && base.ammo_types().count( ammo_battery );
 }
 
 bool vehicle_part::is_reactor() const
@@ -141,7 +141,7 @@ static int has_quality_from_vpart( const vehicle &veh, int part, const quality_i
     int qty = 0;
 
     auto pos = veh.parts[ part ].mount;
-    for( const auto &n : veh.parts_at_relative( pos, true ) ) {
+    for( const int n : veh.parts_at_relative_cached( pos ) ) {
 
         // only unbroken parts can provide tool qualities
         if( !veh.parts[ n ].is_broken() ) {
@@ -235,7 +235,7 @@ static int max_quality_from_vpart( const vehicle &veh, int part, const quality_i
     int res = INT_MIN;
 
     auto pos = veh.parts[ part ].mount;
-    for( const auto &n : veh.parts_at_relative( pos, true ) ) {
+    for( const int n : veh.parts_at_relative_cached( pos ) ) {
 
         // only unbroken parts can provide tool qualities
         if( !veh.parts[ n ].is_broken() ) {
@@ -449,12 +449,18 @@ VisitResponse visitable<map_cursor>::visit_items(
 {
     auto cur = static_cast<map_cursor *>( this );
 
+    map_stack stack = g->m.i_at( *cur );
+    // checking the terrain flags costs more than an empty stack, so do that first
+    if( stack.empty() ) {
+        return VisitResponse::NEXT;
+    }
+
     // skip inaccessible items
     if( g->m.has_flag( "SEALED", *cur ) && !g->m.has_flag( "LIQUIDCONT", *cur ) ) {
         return VisitResponse::NEXT;
     }
 
-    for( auto &e : g->m.i_at( *cur ) ) {
+    for( auto &e : stack ) {
         if( visit_internal( func, &e ) == VisitResponse::ABORT ) {
             return VisitResponse::ABORT;
         }
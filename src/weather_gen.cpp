@@ -1,6 +1,7 @@
 #include "weather_gen.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ostream>
 #include <random>
@@ -82,7 +83,8 @@ static double weather_temperature_from_common_data( const weather_generator &wg,
     // Interpolate seasons temperature
     // Scale year_fraction [0, 1) to [0.0, 4.0). So [0.0, 1.0] - spring, [1.0, 2.0] - summer, [2.0, 3.0] - autumn, [3.0, 4.0) - winter.
     const double quadrum = common.year_fraction * 4;
-    const std::vector<std::pair<float, float>> mid_season_temps = { {
+    // An array, this runs for every temperature lookup and shouldn't allocate.
+    const std::array<std::pair<float, float>, 6> mid_season_temps = { {
             { -0.5f, wg.winter_temp }, // midwinter
             { 0.5f, wg.spring_temp }, // midspring
             { 1.5f, wg.summer_temp }, // midsummer
@@ -272,8 +272,17 @@ void worldfactory::init()
 
     // get the master files. These determine the validity of a world
     // worlds exist by having an option file
+    // Worlds are only ever directly inside the save directory (or the save directory itself,
+    // see the conversion below), so there is no need to walk their map folders.
+    std::vector<std::string> world_dirs = get_directories_with( qualifiers, PATH_INFO::savedir() );
+    for( const std::string &dir : get_subdirectories( PATH_INFO::savedir() ) ) {
+        if( file_exist( dir + "/" + PATH_INFO::worldoptions() ) ||
+            file_exist( dir + "/" + SAVE_MASTER ) ) {
+            world_dirs.push_back( dir );
+        }
+    }
     // create worlds
-    for( const auto &world_dir : get_directories_with( qualifiers, PATH_INFO::savedir(), true ) ) {
+    for( const auto &world_dir : world_dirs ) {
         // get the save files
         auto world_sav_files = get_files_from_path( SAVE_EXTENSION, world_dir, false );
         // split the save file names between the directory and the extension
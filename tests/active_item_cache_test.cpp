@@ -1,6 +1,8 @@
+#include <list>
 #include <memory>
 #include <set>
 
+#include "active_item_cache.h"
 #include "calendar.h"
 #include "catch/catch.hpp"
 #include "game.h"
@@ -46,3 +48,44 @@ TEST_CASE( "place_active_item_at_various_coordinates", "[item]" )
         }
     }
 }
+
+TEST_CASE( "active_item_cache_processes_items_in_turn", "[item]" )
+{
+    active_item_cache cache;
+    std::list<item> apples;
+    for( int i = 0; i < 10; ++i ) {
+        apples.emplace_back( "apple" );
+        cache.add( apples.back(), point( i, 0 ) );
+    }
+    // Adding again does nothing
+    cache.add( apples.front(), point_zero );
+    REQUIRE( cache.get().size() == 10 );
+    REQUIRE( apples.front().processing_speed() > 10 );
+
+    // Slow items are processed one at a time, each of them once before any is repeated.
+    std::set<const item *> processed;
+    for( int i = 0; i < 10; ++i ) {
+        const std::vector<item_reference> &batch = cache.get_for_processing();
+        REQUIRE( batch.size() == 1 );
+        processed.insert( batch.front().item_ref.get() );
+    }
+    CHECK( processed.size() == 10 );
+
+    cache.remove( &apples.front() );
+    apples.pop_front();
+    // Destroyed items are dropped from the cache.
+    apples.pop_back();
+    CHECK( cache.get().size() == 8 );
+    processed.clear();
+    for( int i = 0; i < 8; ++i ) {
+        for( const item_reference &ref : cache.get_for_processing() ) {
+            processed.insert( ref.item_ref.get() );
+        }
+    }
+    CHECK( processed.size() == 8 );
+
+    for( const item &apple : apples ) {
+        cache.remove( &apple );
+    }
+    CHECK( cache.empty() );
+}
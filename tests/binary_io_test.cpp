@@ -0,0 +1,55 @@
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "catch/catch.hpp"
+#include "binary_io.h"
+
+TEST_CASE( "binary_io_round_trip", "[binary]" )
+{
+    std::ostringstream os;
+    binary_writer out( os );
+    out.write_u8( 0xAB );
+    out.write_u16( 0xBEEF );
+    out.write_u32( 0xDEADBEEF );
+    out.write_i32( -123456 );
+    out.write_i64( -5000000000LL );
+    out.write_short_string( "t_floor" );
+    out.write_string( std::string( "with\0null", 9 ) );
+    out.write_string( "" );
+
+    const std::string data = os.str();
+    // Fixed width, independent of the platform
+    CHECK( data.size() == 1 + 2 + 4 + 4 + 8 + ( 2 + 7 ) + ( 4 + 9 ) + 4 );
+    // Little endian
+    CHECK( static_cast<unsigned char>( data[1] ) == 0xEF );
+    CHECK( static_cast<unsigned char>( data[2] ) == 0xBE );
+
+    std::istringstream is( data );
+    binary_reader in( is );
+    CHECK( in.read_u8() == 0xAB );
+    CHECK( in.read_u16() == 0xBEEF );
+    CHECK( in.read_u32() == 0xDEADBEEF );
+    CHECK( in.read_i32() == -123456 );
+    CHECK( in.read_i64() == -5000000000LL );
+    CHECK( in.read_short_string() == "t_floor" );
+    CHECK( in.read_string() == std::string( "with\0null", 9 ) );
+    CHECK( in.read_string().empty() );
+    CHECK_THROWS_AS( in.read_u8(), std::runtime_error );
+}
+
+TEST_CASE( "binary_io_rejects_truncated_data", "[binary]" )
+{
+    std::ostringstream os;
+    binary_writer out( os );
+    out.write_short_string( "a longer string" );
+    const std::string data = os.str();
+
+    std::istringstream is( data.substr( 0, data.size() - 3 ) );
+    binary_reader in( is );
+    CHECK_THROWS_AS( in.read_short_string(), std::runtime_error );
+
+    std::istringstream is2( data.substr( 0, 3 ) );
+    binary_reader in2( is2 );
+    CHECK_THROWS_AS( in2.read_i32(), std::runtime_error );
+}
@@ -0,0 +1,57 @@
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "cata_parallel.h"
+#include "debug.h"
+
+TEST_CASE( "parallel_for_visits_every_index_once", "[parallel]" )
+{
+    const int old_count = cata::parallel_thread_count();
+    const int threads = GENERATE( 1, 2, 7 );
+    cata::set_parallel_thread_count( threads );
+    CAPTURE( threads );
+
+    std::vector<int> visits( 20, 0 );
+    cata::parallel_for( 3, 17, [&]( const int i ) {
+        visits[i]++;
+    } );
+    for( int i = 0; i < 20; ++i ) {
+        CAPTURE( i );
+        CHECK( visits[i] == ( i >= 3 && i < 17 ? 1 : 0 ) );
+    }
+
+    // Empty ranges do nothing
+    cata::parallel_for( 5, 5, [&]( const int i ) {
+        visits[i]++;
+    } );
+    CHECK( visits[5] == 1 );
+
+    cata::set_parallel_thread_count( old_count );
+}
+
+TEST_CASE( "debugmsgs_of_parallel_work_are_reported_in_order", "[parallel]" )
+{
+    const int old_count = cata::parallel_thread_count();
+    cata::set_parallel_thread_count( 4 );
+
+    std::vector<std::vector<deferred_debugmsg>> messages( 8 );
+    cata::parallel_for( 0, 8, [&]( const int i ) {
+        defer_debugmsgs_during( messages[i], [i]() {
+            debugmsg( "message %d", i );
+        } );
+    } );
+    for( int i = 0; i < 8; ++i ) {
+        REQUIRE( messages[i].size() == 1 );
+        CHECK( messages[i][0].text == "message " + std::to_string( i ) );
+    }
+
+    const std::string reported = capture_debugmsg_during( [&]() {
+        for( const std::vector<deferred_debugmsg> &m : messages ) {
+            report_deferred_debugmsgs( m );
+        }
+    } );
+    CHECK( reported == "message 0message 1message 2message 3message 4message 5message 6message 7" );
+
+    cata::set_parallel_thread_count( old_count );
+}
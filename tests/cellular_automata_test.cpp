@@ -0,0 +1,40 @@
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "cellular_automata.h"
+#include "point.h"
+#include "rng.h"
+
+// One step of the rules, spelled out with neighbor_count.
+static std::vector<std::vector<int>> reference_step( const std::vector<std::vector<int>> &cells,
+                                  const point &size, const int birth_limit, const int stasis_limit )
+{
+    std::vector<std::vector<int>> next( size.x, std::vector<int>( size.y, 0 ) );
+    for( int i = 1; i < size.x - 1; i++ ) {
+        for( int j = 1; j < size.y - 1; j++ ) {
+            const int neighbors = CellularAutomata::neighbor_count( cells, size, point( i, j ) );
+            const int limit = cells[i][j] == 0 ? birth_limit : stasis_limit;
+            next[i][j] = neighbors > limit;
+        }
+    }
+    return next;
+}
+
+TEST_CASE( "cellular_automaton_follows_its_rules", "[cellular_automata]" )
+{
+    const point size( 24, 17 );
+    const int birth_limit = 4;
+    const int stasis_limit = 3;
+
+    rng_set_engine_seed( 1234 );
+    std::vector<std::vector<int>> expected = CellularAutomata::generate_cellular_automaton( size,
+            55, 0, birth_limit, stasis_limit );
+    for( int iteration = 0; iteration < 5; iteration++ ) {
+        expected = reference_step( expected, size, birth_limit, stasis_limit );
+    }
+
+    rng_set_engine_seed( 1234 );
+    const std::vector<std::vector<int>> actual = CellularAutomata::generate_cellular_automaton(
+                size, 55, 5, birth_limit, stasis_limit );
+    CHECK( actual == expected );
+}
@@ -1,6 +1,7 @@
 #include <cstddef>
 #include <algorithm> // std::find
 #include <functional> // std::greater
+#include <list> // benchmark comparison
 #include <utility> // std::move
 #include <vector> // range-insert testing
 
@@ -1147,3 +1148,72 @@ TEST_CASE( "colony splice", "[colony]" )
         CHECK( test_colony_1.empty() );
     }
 }
+
+// Sizes are in the range of items on a busy map tile up to a large submap's active list.
+TEST_CASE( "colony_benchmark", "[.][colony][benchmark]" )
+{
+    constexpr int size = 2000;
+
+    BENCHMARK( "colony insert" ) {
+        cata::colony<int> c;
+        for( int i = 0; i < size; i++ ) {
+            c.insert( i );
+        }
+        return c.size();
+    };
+    BENCHMARK( "list insert" ) {
+        std::list<int> c;
+        for( int i = 0; i < size; i++ ) {
+            c.push_back( i );
+        }
+        return c.size();
+    };
+
+    cata::colony<int> full_colony;
+    std::list<int> full_list;
+    for( int i = 0; i < size; i++ ) {
+        full_colony.insert( i );
+        full_list.push_back( i );
+    }
+    BENCHMARK( "colony iterate" ) {
+        long long sum = 0;
+        for( int i : full_colony ) {
+            sum += i;
+        }
+        return sum;
+    };
+    BENCHMARK( "list iterate" ) {
+        long long sum = 0;
+        for( int i : full_list ) {
+            sum += i;
+        }
+        return sum;
+    };
+
+    BENCHMARK_ADVANCED( "colony erase every other" )( Catch::Benchmark::Chronometer meter ) {
+        std::vector<cata::colony<int>> copies( meter.runs(), full_colony );
+        meter.measure( [&copies]( const int run ) {
+            cata::colony<int> &c = copies[run];
+            for( auto it = c.begin(); it != c.end(); ) {
+                it = c.erase( it );
+                if( it != c.end() ) {
+                    ++it;
+                }
+            }
+            return c.size();
+        } );
+    };
+    BENCHMARK_ADVANCED( "list erase every other" )( Catch::Benchmark::Chronometer meter ) {
+        std::vector<std::list<int>> copies( meter.runs(), full_list );
+        meter.measure( [&copies]( const int run ) {
+            std::list<int> &c = copies[run];
+            for( auto it = c.begin(); it != c.end(); ) {
+                it = c.erase( it );
+                if( it != c.end() ) {
+                    ++it;
+                }
+            }
+            return c.size();
+        } );
+    };
+}
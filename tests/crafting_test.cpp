@@ -16,6 +16,7 @@
 #include "crafting.h"
 #include "distribution_grid.h"
 #include "game.h"
+#include "inventory.h"
 #include "item.h"
 #include "itype.h"
 #include "map.h"
@@ -33,8 +34,6 @@
 #include "type_id.h"
 #include "value_ptr.h"
 
-class inventory;
-
 TEST_CASE( "recipe_subset" )
 {
     recipe_subset subset;
@@ -601,3 +600,25 @@ TEST_CASE( "oven electric grid test", "[crafting][overmap][grids][slow]" )
         }
     }
 }
+
+TEST_CASE( "map_inventory_stacks_items_by_type", "[crafting][inventory]" )
+{
+    clear_map();
+    map &m = g->m;
+    const tripoint pos( 60, 60, 0 );
+    for( int i = 0; i < 5; i++ ) {
+        m.add_item( pos, item( "rock" ) );
+        m.add_item( pos + point_east, item( "2x4" ) );
+    }
+    m.add_item( pos + point_west, item( "rock" ) );
+    m.add_item( pos + point_south, item( "nail", calendar::turn, 10 ) );
+    m.add_item( pos + point_north, item( "nail", calendar::turn, 15 ) );
+
+    inventory map_inv;
+    map_inv.form_from_map( pos, 1, nullptr, false, false );
+
+    CHECK( map_inv.size() == 3 );
+    CHECK( map_inv.amount_of( itype_id( "rock" ) ) == 6 );
+    CHECK( map_inv.amount_of( itype_id( "2x4" ) ) == 5 );
+    CHECK( map_inv.charges_of( itype_id( "nail" ) ) == 25 );
+}
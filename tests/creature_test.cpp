@@ -1,9 +1,11 @@
 #include <cstdlib>
 #include <map>
+#include <sstream>
 #include <utility>
 
 #include "catch/catch.hpp"
 #include "creature.h"
+#include "json.h"
 #include "monster.h"
 #include "mtype.h"
 #include "test_statistics.h"
@@ -82,3 +84,16 @@ TEST_CASE( "Check distribution of attacks to body parts for larger attacker." )
     calculate_bodypart_distribution( MS_MEDIUM, MS_SMALL, 1, expected_weights_base[2] );
     calculate_bodypart_distribution( MS_MEDIUM, MS_SMALL, 100, expected_weights_max[2] );
 }
+
+TEST_CASE( "Loading a creature saved without a body keeps its body", "[creature]" )
+{
+    monster zed( mtype_id( "mon_zombie" ) );
+    const size_t num_parts = zed.get_body().size();
+    REQUIRE( num_parts > 0 );
+
+    std::istringstream is( R"({"typeid":"mon_zombie","posx":0,"posy":0,"posz":0})" );
+    JsonIn jsin( is );
+    zed.deserialize( jsin );
+
+    CHECK( zed.get_body().size() == num_parts );
+}
@@ -59,3 +59,21 @@ TEST_CASE( "destroy_bus_before_subscriber", "[event]" )
                   character_id( 5 ), mtype_id( "zombie" ) ) );
     CHECK( sub.events.size() == 1 );
 }
+
+struct kills_only_subscriber : public test_subscriber {
+    bool wants( const event_type type ) const override {
+        return type == event_type::character_kills_monster;
+    }
+};
+
+TEST_CASE( "subscriber_receives_only_wanted_event_types", "[event]" )
+{
+    event_bus bus;
+    kills_only_subscriber sub;
+    bus.subscribe( &sub );
+
+    bus.send<event_type::character_kills_monster>( character_id( 5 ), mtype_id( "zombie" ) );
+    bus.send<event_type::game_start>( character_id( 5 ) );
+    REQUIRE( sub.events.size() == 1 );
+    CHECK( sub.events[0].type() == event_type::character_kills_monster );
+}
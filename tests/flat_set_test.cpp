@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <set>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -140,3 +142,60 @@ TEST_CASE( "flat_set_transparent_lookup", "[flat_set]" )
     CHECK( s.upper_bound( 0 ) == s.end() );
     CHECK( s.equal_range( 0 ) == std::make_pair( s.begin(), s.end() ) );
 }
+
+// Flags and other small id sets hold tens of elements; lookups dominate.
+TEST_CASE( "flat_set_benchmark", "[.][flat_set][benchmark]" )
+{
+    constexpr int size = 50;
+    std::vector<int> values;
+    for( int i = 0; i < size; i++ ) {
+        values.push_back( ( i * 7919 ) % 1000 );
+    }
+
+    BENCHMARK( "flat_set insert" ) {
+        cata::flat_set<int> s;
+        for( int v : values ) {
+            s.insert( v );
+        }
+        return s.size();
+    };
+    BENCHMARK( "set insert" ) {
+        std::set<int> s;
+        for( int v : values ) {
+            s.insert( v );
+        }
+        return s.size();
+    };
+    BENCHMARK( "unordered_set insert" ) {
+        std::unordered_set<int> s;
+        for( int v : values ) {
+            s.insert( v );
+        }
+        return s.size();
+    };
+
+    const cata::flat_set<int> flat( values.begin(), values.end() );
+    const std::set<int> tree( values.begin(), values.end() );
+    const std::unordered_set<int> hashed( values.begin(), values.end() );
+    BENCHMARK( "flat_set lookup" ) {
+        int found = 0;
+        for( int i = 0; i < 1000; i += 3 ) {
+            found += flat.count( i );
+        }
+        return found;
+    };
+    BENCHMARK( "set lookup" ) {
+        int found = 0;
+        for( int i = 0; i < 1000; i += 3 ) {
+            found += tree.count( i );
+        }
+        return found;
+    };
+    BENCHMARK( "unordered_set lookup" ) {
+        int found = 0;
+        for( int i = 0; i < 1000; i += 3 ) {
+            found += hashed.count( i );
+        }
+        return found;
+    };
+}
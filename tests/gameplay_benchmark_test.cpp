@@ -0,0 +1,101 @@
+#include <functional>
+#include <string>
+
+#include "calendar.h"
+#include "catch/catch.hpp"
+#include "field_type.h"
+#include "game.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "monster.h"
+#include "npc.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "profiler.h"
+#include "rng.h"
+#include "string_formatter.h"
+
+// Creatures that keep acting on the same turn past this are assumed to be stuck.
+static constexpr int max_actions_per_turn = 10;
+
+static void move_monsters()
+{
+    profiler::scoped_zone zone( "monsters" );
+    for( monster &critter : g->all_monsters() ) {
+        critter.mod_moves( critter.get_speed() );
+        for( int i = 0; i < max_actions_per_turn && critter.moves > 0 && !critter.is_dead(); i++ ) {
+            critter.move();
+        }
+    }
+    g->cleanup_dead();
+}
+
+static void move_npcs()
+{
+    profiler::scoped_zone zone( "npcs" );
+    for( npc &guy : g->all_npcs() ) {
+        guy.mod_moves( guy.get_speed() );
+        for( int i = 0; i < max_actions_per_turn && guy.moves > 0 && !guy.is_dead(); i++ ) {
+            guy.move();
+        }
+    }
+}
+
+// Plays @p turns turns of the scenario set up by @p setup with a fixed seed and prints the
+// time spent in each subsystem. The player is kept out of the way on a lower z-level.
+static void run_scenario( const std::string &name, const std::function<void()> &setup,
+                          const int turns )
+{
+    clear_map_and_put_player_underground();
+    set_time( calendar::turn_zero + 12_hours );
+    rng_set_engine_seed( 4242 );
+    setup();
+
+    profiler::set_enabled( true );
+    for( int turn = 0; turn < turns; turn++ ) {
+        calendar::turn += 1_turns;
+        move_monsters();
+        move_npcs();
+        g->m.process_fields();
+        g->m.process_items();
+    }
+    cata_printf( "%s: %d turns\n", name, turns );
+    for( const profiler::zone_stats &zone : profiler::collected() ) {
+        cata_printf( "  %s\t%d calls\t%lld us\t%d allocations\n", zone.name, zone.calls,
+                     static_cast<long long>( zone.total.count() / 1000 ), zone.allocations );
+    }
+    profiler::set_enabled( false );
+    clear_map();
+}
+
+// Hidden; run with the [benchmark] tag to compare subsystem costs between builds.
+TEST_CASE( "gameplay_benchmark", "[.][benchmark]" )
+{
+    const tripoint target( 60, 60, 0 );
+
+    run_scenario( "horde siege", [&]() {
+        for( int i = 0; i < 100; i++ ) {
+            const tripoint p( 20 + i % 10 * 2, 20 + i / 10 * 2, 0 );
+            monster &zombie = spawn_test_monster( "mon_zombie", p );
+            zombie.anger = 100;
+            zombie.set_dest( target );
+        }
+    }, 100 );
+
+    run_scenario( "big fire", [&]() {
+        for( const tripoint &p : g->m.points_in_radius( target, 10 ) ) {
+            g->m.add_item( p, item( "2x4", calendar::turn ) );
+            if( p.x % 3 == 0 && p.y % 3 == 0 ) {
+                g->m.add_field( p, fd_fire, 3 );
+            }
+        }
+    }, 100 );
+
+    run_scenario( "camp with 15 npcs", [&]() {
+        for( int i = 0; i < 15; i++ ) {
+            spawn_npc( target.xy() + point( i % 5 * 2, i / 5 * 2 ), "test_talker" );
+        }
+    }, 100 );
+}
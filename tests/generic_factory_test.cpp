@@ -1,8 +1,13 @@
+#include <sstream>
 #include <unordered_set>
 #include "catch/catch.hpp"
 
+#include "cata_utility.h"
 #include "colony_list_test_helpers.h"
+#include "filesystem.h"
 #include "flag.h"
+#include "fstream_utils.h"
+#include "game.h"
 #include "generic_factory.h"
 
 #ifdef _MSC_VER
@@ -19,6 +24,24 @@ struct test_obj {
     test_obj_id id;
     std::string value;
 };
+
+struct lazy_test_obj;
+using lazy_test_obj_id = string_id<lazy_test_obj>;
+
+struct lazy_test_obj {
+    lazy_test_obj_id id;
+    bool was_loaded = false;
+    std::string value;
+
+    static int load_count;
+
+    void load( const JsonObject &jo, const std::string & ) {
+        ++load_count;
+        value = jo.get_string( "value" );
+    }
+};
+
+int lazy_test_obj::load_count = 0;
 } // namespace
 
 TEST_CASE( "generic_factory_insert_convert_valid", "[generic_factory]" )
@@ -203,6 +226,11 @@ TEST_CASE( "generic_factory_lookup_benchmark", "[.][generic_factory][benchmark]"
     BENCHMARK( "single lookup" ) {
         return test_factory.obj( id_200 ).value;
     };
+
+    const int_id<test_obj> int_id_200 = test_factory.convert( id_200, int_id<test_obj>() );
+    BENCHMARK( "single int_id lookup" ) {
+        return test_factory.obj( int_id_200 ).value;
+    };
 }
 
 TEST_CASE( "string_id_compare_benchmark", "[.][generic_factory][string_id][benchmark]" )
@@ -248,3 +276,60 @@ TEST_CASE( "string_id_compare_benchmark", "[.][generic_factory][string_id][bench
         return id_200 == id_300;
     };
 }
+
+TEST_CASE( "string_id_creation_benchmark", "[.][generic_factory][string_id][benchmark]" )
+{
+    const std::string existing = "id_200";
+    test_obj_id id_200( existing );
+
+    CHECK( test_obj_id( existing ) == id_200 );
+    BENCHMARK( "id from interned string" ) {
+        return test_obj_id( existing );
+    };
+    BENCHMARK( "id from interned literal" ) {
+        return test_obj_id( "id_200" );
+    };
+}
+
+TEST_CASE( "generic_factory_lazy_loading", "[generic_factory]" )
+{
+    const std::string path = g->get_world_base_save_path() + "/lazy_factory_test_" +
+                             get_pid_string() + ".json";
+    REQUIRE( write_to_file( path, []( std::ostream & s ) {
+        s << R"([ { "type": "test", "id": "lazy_a", "value": "a" },)"
+          << R"( { "type": "test", "id": "lazy_b", "value": "b" },)"
+          << R"( { "type": "test", "id": "lazy_c", "copy-from": "lazy_a", "value": "c" } ])";
+    }, nullptr ) );
+
+    generic_factory<lazy_test_obj> test_factory( "lazy test factory" );
+    test_factory.set_lazy_loading( true );
+    lazy_test_obj::load_count = 0;
+    {
+        std::istringstream iss( read_entire_file( path ) );
+        JsonIn jsin( iss, path );
+        jsin.start_array();
+        while( !jsin.end_array() ) {
+            JsonObject jo = jsin.get_object();
+            test_factory.load( jo, "test" );
+        }
+    }
+    test_factory.finalize();
+
+    // "lazy_c" copies from "lazy_a", so both of them had to be loaded.
+    CHECK( lazy_test_obj::load_count == 2 );
+    CHECK( test_factory.size() == 3 );
+    CHECK( test_factory.is_valid( lazy_test_obj_id( "lazy_b" ) ) );
+    CHECK( lazy_test_obj::load_count == 2 );
+
+    CHECK( test_factory.obj( lazy_test_obj_id( "lazy_a" ) ).value == "a" );
+    CHECK( test_factory.obj( lazy_test_obj_id( "lazy_b" ) ).value == "b" );
+    CHECK( test_factory.obj( lazy_test_obj_id( "lazy_c" ) ).value == "c" );
+    CHECK( lazy_test_obj::load_count == 3 );
+
+    // Nothing is loaded twice.
+    test_factory.load_all();
+    CHECK( test_factory.get_all().size() == 3 );
+    CHECK( lazy_test_obj::load_count == 3 );
+
+    CHECK( remove_file( path ) );
+}
@@ -5,6 +5,7 @@
 #include "calendar.h"
 #include "catch/catch.hpp"
 #include "enums.h"
+#include "flag.h"
 #include "item.h"
 #include "itype.h"
 #include "ret_val.h"
@@ -31,6 +32,19 @@ TEST_CASE( "item_volume", "[item]" )
     }
 }
 
+TEST_CASE( "item_flag_lookup_by_id", "[item][flag]" )
+{
+    item backpack( "backpack" );
+    backpack.set_flag( "FILTHY" );
+    for( const json_flag &f : json_flag::get_all() ) {
+        CAPTURE( f.id.str() );
+        CHECK( backpack.type->has_flag( f.id ) == backpack.type->has_flag( f.id.str() ) );
+        CHECK( backpack.has_flag( f.id ) == backpack.has_flag( f.id.str() ) );
+    }
+    CHECK( backpack.has_flag( flag_str_id( "FILTHY" ) ) );
+    CHECK_FALSE( backpack.has_flag( flag_str_id( "not_a_flag" ) ) );
+}
+
 TEST_CASE( "simple_item_layers", "[item]" )
 {
     CHECK( item( "arm_warmers" ).get_layer() == UNDERWEAR_LAYER );
@@ -452,3 +452,22 @@ TEST_CASE( "jsonin_get_string", "[json]" )
             R"(       ar")" "\n" ),
         R"("foo\nbar")", 5 );
 }
+
+TEST_CASE( "jsonin_skip_values_and_trailing_whitespace", "[json]" )
+{
+    std::istringstream iss( R"( [ "plain", "esc\"aped\\", "…", 12.5e3, true, null, { "a": [ 1 ] } ] )"
+                            "\n\t " );
+    JsonIn jsin( iss );
+    jsin.start_array();
+    jsin.skip_value();
+    CHECK( jsin.get_string() == "esc\"aped\\" );
+    jsin.skip_value();
+    jsin.skip_value();
+    jsin.skip_value();
+    jsin.skip_value();
+    jsin.skip_value();
+    CHECK( jsin.end_array() );
+    // Only whitespace is left, which must leave the stream at its end.
+    jsin.eat_whitespace();
+    CHECK_FALSE( jsin.good() );
+}
@@ -0,0 +1,44 @@
+#include "catch/catch.hpp"
+#include "lru_cache.h"
+#include "point.h"
+
+TEST_CASE( "lru_cache_evicts_least_recently_used", "[lru_cache]" )
+{
+    lru_cache<tripoint, int> cache;
+    cache.insert( 2, tripoint( 1, 0, 0 ), 1 );
+    cache.insert( 2, tripoint( 2, 0, 0 ), 2 );
+    // Reinserting moves the entry to the back, where the most recently used ones are.
+    cache.insert( 2, tripoint( 1, 0, 0 ), 3 );
+    cache.insert( 2, tripoint( 3, 0, 0 ), 4 );
+
+    CHECK( cache.get( tripoint( 1, 0, 0 ), -1 ) == 3 );
+    CHECK( cache.get( tripoint( 2, 0, 0 ), -1 ) == -1 );
+    CHECK( cache.get( tripoint( 3, 0, 0 ), -1 ) == 4 );
+    CHECK( cache.list().size() == 2 );
+}
+
+// npc::searched_tiles holds a few hundred tiles; most lookups in it hit.
+TEST_CASE( "lru_cache_benchmark", "[.][lru_cache][benchmark]" )
+{
+    constexpr int limit = 500;
+
+    BENCHMARK( "insert over the limit" ) {
+        lru_cache<tripoint, int> cache;
+        for( int i = 0; i < limit * 2; i++ ) {
+            cache.insert( limit, tripoint( i % 60, i / 60, 0 ), i );
+        }
+        return cache.list().size();
+    };
+
+    lru_cache<tripoint, int> full;
+    for( int i = 0; i < limit; i++ ) {
+        full.insert( limit, tripoint( i % 60, i / 60, 0 ), i );
+    }
+    BENCHMARK( "lookup" ) {
+        int sum = 0;
+        for( int i = 0; i < limit; i += 2 ) {
+            sum += full.get( tripoint( i % 60, i / 60, 0 ), 0 );
+        }
+        return sum;
+    };
+}
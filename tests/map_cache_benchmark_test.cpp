@@ -0,0 +1,72 @@
+#include "avatar.h"
+#include "cached_options.h"
+#include "calendar.h"
+#include "catch/catch.hpp"
+#include "game.h"
+#include "game_constants.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "point.h"
+#include "type_id.h"
+
+// Fills the reality bubble with a grid of 8x8 rooms: brick walls with a window in each, a
+// roof above and a utility light in every other room. Combined with night time this gives
+// the transparency, lightmap and seen caches a realistic amount of work.
+static void build_town_fixture()
+{
+    const ter_id t_brick_wall( "t_brick_wall" );
+    const ter_id t_window_frame( "t_window_frame" );
+    const ter_id t_floor( "t_floor" );
+    const ter_id t_utility_light( "t_utility_light" );
+    const ter_id t_flat_roof( "t_flat_roof" );
+
+    clear_map();
+    map &here = get_map();
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            const tripoint p( x, y, 0 );
+            const point in_room( x % 8, y % 8 );
+            const point room( x / 8, y / 8 );
+            ter_id ter = t_floor;
+            if( in_room.x == 0 || in_room.y == 0 ) {
+                ter = in_room.x == 4 || in_room.y == 4 ? t_window_frame : t_brick_wall;
+            } else if( in_room == point( 4, 4 ) && ( room.x + room.y ) % 2 == 0 ) {
+                ter = t_utility_light;
+            }
+            here.ter_set( p, ter );
+            here.ter_set( p + tripoint_above, t_flat_roof );
+        }
+    }
+    g->u.setpos( tripoint( MAPSIZE_X / 2 + 2, MAPSIZE_Y / 2 + 2, 0 ) );
+    set_time( calendar::turn_zero + 1_days );
+}
+
+// Hidden; rebuilds the whole map cache of the fixture from scratch on each run.
+TEST_CASE( "map_cache_benchmark", "[.][map][benchmark]" )
+{
+    build_town_fixture();
+    map &here = get_map();
+    const bool old_fov_3d = fov_3d;
+
+    fov_3d = false;
+    BENCHMARK( "build_map_cache 2D" ) {
+        here.invalidate_map_cache( 0 );
+        here.build_map_cache( 0 );
+        return here.access_cache( 0 ).seen_cache[MAPSIZE_X / 2][MAPSIZE_Y / 2];
+    };
+    BENCHMARK( "build_map_cache 2D, no lightmap" ) {
+        here.invalidate_map_cache( 0 );
+        here.build_map_cache( 0, true );
+        return here.access_cache( 0 ).seen_cache[MAPSIZE_X / 2][MAPSIZE_Y / 2];
+    };
+
+    fov_3d = true;
+    BENCHMARK( "build_map_cache 3D" ) {
+        here.invalidate_map_cache( 0 );
+        here.build_map_cache( 0 );
+        return here.access_cache( 0 ).seen_cache[MAPSIZE_X / 2][MAPSIZE_Y / 2];
+    };
+
+    fov_3d = old_fov_3d;
+    clear_map();
+}
@@ -67,6 +67,29 @@ TEST_CASE( "map_memory_overwrites", "[map_memory]" )
     CHECK( memory.get_symbol( p2 ) == 3 );
 }
 
+TEST_CASE( "map_memory_tiles_survive_overwrites", "[map_memory]" )
+{
+    map_memory memory;
+    memory.prepare_region( p1, p2 );
+    memory.memorize_tile( p1, "t_floor", 0, 0 );
+    memory.memorize_tile( p2, "t_floor", 1, 2 );
+    // Overwrite one square with many distinct tiles to force palette compaction
+    for( int i = 0; i < SEEX * SEEY * 3; i++ ) {
+        memory.memorize_tile( p2, string_format( "t_dummy_%d", i ), 0, 0 );
+    }
+    memory.memorize_tile( p2, "t_wall", 3, 1 );
+    const memorized_terrain_tile &t1 = memory.get_tile( p1 );
+    CHECK( t1.tile == "t_floor" );
+    CHECK( t1.subtile == 0 );
+    CHECK( t1.rotation == 0 );
+    const memorized_terrain_tile &t2 = memory.get_tile( p2 );
+    CHECK( t2.tile == "t_wall" );
+    CHECK( t2.subtile == 3 );
+    CHECK( t2.rotation == 1 );
+    memory.clear_memorized_tile( p1 );
+    CHECK( memory.get_tile( p1 ).tile.empty() );
+}
+
 // TODO: map memory save / load
 
 #include <chrono>
@@ -8,6 +8,7 @@
 #include "game_constants.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "pathfinding.h"
 #include "point.h"
 #include "type_id.h"
 
@@ -88,3 +89,78 @@ TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
     g->place_player( tripoint_zero );
     CHECK( g->m.check_submap_active_item_consistency().empty() );
 }
+
+TEST_CASE( "pathfinding_cache_tracks_changes_per_submap" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint wall_pos( 60, 60, 0 );
+    const tripoint trap_pos( 73, 60, 0 );
+
+    REQUIRE( !( here.get_pathfinding_cache_ref( 0 ).special[wall_pos.x][wall_pos.y] & PF_WALL ) );
+    REQUIRE( !( here.get_pathfinding_cache_ref( 0 ).special[trap_pos.x][trap_pos.y] & PF_TRAP ) );
+
+    here.ter_set( wall_pos, ter_id( "t_wall" ) );
+    here.trap_set( trap_pos, trap_str_id( "tr_beartrap" ) );
+    const pathfinding_cache &cache = here.get_pathfinding_cache_ref( 0 );
+    CHECK( cache.dirty_submaps.none() );
+    CHECK( cache.special[wall_pos.x][wall_pos.y] & PF_WALL );
+    CHECK( cache.special[trap_pos.x][trap_pos.y] & PF_TRAP );
+
+    here.ter_set( wall_pos, ter_id( "t_floor" ) );
+    here.remove_trap( trap_pos );
+    CHECK( cache.dirty_submaps.count() == 2 );
+    here.get_pathfinding_cache_ref( 0 );
+    CHECK( !( cache.special[wall_pos.x][wall_pos.y] & PF_WALL ) );
+    CHECK( !( cache.special[trap_pos.x][trap_pos.y] & PF_TRAP ) );
+}
+
+TEST_CASE( "route_cache_reuses_remainder_of_known_routes" )
+{
+    route_cache cache;
+    pathfinding_settings settings( 0, 30, 60, 0, false, false, true, false, false );
+    const tripoint from( 10, 10, 0 );
+    const tripoint to( 13, 11, 0 );
+    const std::vector<tripoint> route = { { 11, 10, 0 }, { 12, 11, 0 }, to };
+    cache.add( from, to, settings, route );
+
+    std::vector<tripoint> result;
+    REQUIRE( cache.find( from, to, settings, result ) );
+    CHECK( result == route );
+    REQUIRE( cache.find( tripoint( 12, 11, 0 ), to, settings, result ) );
+    CHECK( result == std::vector<tripoint> { to } );
+
+    // Different destination, settings or a start off the route
+    CHECK_FALSE( cache.find( from, tripoint( 12, 11, 0 ), settings, result ) );
+    CHECK_FALSE( cache.find( tripoint( 10, 11, 0 ), to, settings, result ) );
+    settings.avoid_traps = true;
+    CHECK_FALSE( cache.find( from, to, settings, result ) );
+}
+
+TEST_CASE( "routes_to_a_shared_destination_go_around_walls" )
+{
+    clear_map();
+    map &here = get_map();
+    const ter_id t_wall( "t_wall" );
+    const tripoint target( 60, 60, 0 );
+    // A wall between the starts and the target, with a gap at its southern end
+    for( int y = 50; y < 65; ++y ) {
+        here.ter_set( tripoint( 57, y, 0 ), t_wall );
+    }
+    const pathfinding_settings settings( 0, 30, 120, 0, false, false, false, false, false );
+
+    // Enough searches to the same destination for later ones to use a flow field
+    for( int y = 52; y < 60; ++y ) {
+        const tripoint start( 50, y, 0 );
+        CAPTURE( start );
+        const std::vector<tripoint> route = here.route( start, target, settings );
+        REQUIRE( !route.empty() );
+        CHECK( route.back() == target );
+        tripoint prev = start;
+        for( const tripoint &p : route ) {
+            CHECK( square_dist( prev, p ) == 1 );
+            CHECK( here.passable( p ) );
+            prev = p;
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include <memory>
+#include <string>
+
+#include "catch/catch.hpp"
+#include "coordinate_conversions.h"
+#include "filesystem.h"
+#include "game.h"
+#include "mapbuffer.h"
+#include "mapdata.h"
+#include "options_helpers.h"
+#include "point.h"
+#include "string_formatter.h"
+#include "submap.h"
+#include "trap.h"
+#include "type_id.h"
+
+// The first submap of a quad far outside of the reality bubble, which save() lets go of.
+static const tripoint distant_sm( 1000, 1000, 0 );
+
+static const point changed_tile( 3, 5 );
+
+/**
+ * Removes the file of the distant quad when created and again when destroyed, so that
+ * neither an earlier run nor another test can leave anything behind for a test to find.
+ */
+class distant_quad_file
+{
+    public:
+        distant_quad_file() {
+            remove();
+        }
+        ~distant_quad_file() {
+            remove();
+        }
+    private:
+        static void remove() {
+            const tripoint om_addr = sm_to_omt_copy( distant_sm );
+            const tripoint seg = omt_to_seg_copy( om_addr );
+            const std::string dirname = string_format( "%s/maps/%d.%d.%d",
+                                        g->get_world_base_save_path(), seg.x, seg.y, seg.z );
+            remove_file( string_format( "%s/%d.%d.%d.map", dirname, om_addr.x, om_addr.y,
+                                        om_addr.z ) );
+            // Only goes away if nothing else was saved in that segment.
+            remove_directory( dirname );
+        }
+};
+
+static void add_distant_quad( mapbuffer &buffer )
+{
+    for( const point &offset : {
+             point_zero, point_east, point_south, point_south_east
+         } ) {
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        sm->set_all_ter( ter_str_id( "t_dirt" ).id() );
+        REQUIRE( buffer.add_submap( distant_sm + offset, sm ) );
+    }
+}
+
+static void change_distant_quad( mapbuffer &buffer )
+{
+    submap *const sm = buffer.lookup_submap( distant_sm );
+    REQUIRE( sm != nullptr );
+    sm->set_ter( changed_tile, ter_str_id( "t_floor" ).id() );
+    sm->set_furn( changed_tile, furn_str_id( "f_chair" ).id() );
+    sm->set_trap( changed_tile, trap_str_id( "tr_beartrap" ).id() );
+}
+
+static void check_distant_quad( mapbuffer &buffer )
+{
+    REQUIRE_FALSE( buffer.is_submap_loaded( distant_sm ) );
+    const submap *const sm = buffer.lookup_submap( distant_sm );
+    REQUIRE( sm != nullptr );
+    CHECK( sm->get_ter( changed_tile ) == ter_str_id( "t_floor" ).id() );
+    CHECK( sm->get_furn( changed_tile ) == furn_str_id( "f_chair" ).id() );
+    CHECK( sm->get_trap( changed_tile ) == trap_str_id( "tr_beartrap" ).id() );
+    CHECK( sm->get_ter( point_zero ) == ter_str_id( "t_dirt" ).id() );
+    CHECK( sm->get_furn( point_zero ) == furn_str_id( "f_null" ).id() );
+    CHECK( sm->get_trap( point_zero ) == trap_str_id( "tr_null" ).id() );
+}
+
+// Each test uses a buffer of its own, so the global MAPBUFFER and its quads are left alone.
+
+TEST_CASE( "binary_quad_round_trip", "[mapbuffer]" )
+{
+    const distant_quad_file quad_file;
+    override_option format( "MAP_SAVE_FORMAT", "binary" );
+    mapbuffer buffer;
+    add_distant_quad( buffer );
+    change_distant_quad( buffer );
+    buffer.save();
+    buffer.finish_pending_writes();
+    check_distant_quad( buffer );
+}
+
+TEST_CASE( "evicted_quad_reloads_with_changes", "[mapbuffer]" )
+{
+    const distant_quad_file quad_file;
+    mapbuffer buffer;
+    add_distant_quad( buffer );
+    change_distant_quad( buffer );
+    buffer.evict_distant( 0 );
+    check_distant_quad( buffer );
+}
+
+TEST_CASE( "save_writes_evicted_quads", "[mapbuffer]" )
+{
+    const distant_quad_file quad_file;
+    mapbuffer buffer;
+    add_distant_quad( buffer );
+    change_distant_quad( buffer );
+    buffer.evict_distant( 0 );
+    // Only the written file can bring the changes back now.
+    buffer.save();
+    buffer.finish_pending_writes();
+    check_distant_quad( buffer );
+}
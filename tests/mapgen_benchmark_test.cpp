@@ -0,0 +1,97 @@
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "calendar.h"
+#include "catch/catch.hpp"
+#include "colony.h"
+#include "coordinate_conversions.h"
+#include "game_constants.h"
+#include "map.h"
+#include "mapbuffer.h"
+#include "mapgen.h"
+#include "omdata.h"
+#include "overmap.h"
+#include "overmapbuffer.h"
+#include "point.h"
+#include "rng.h"
+#include "string_formatter.h"
+#include "submap.h"
+
+namespace
+{
+
+struct mapgen_timing {
+    int runs = 0;
+    long long microseconds = 0;
+    long long items = 0;
+};
+
+} // namespace
+
+// Items on the submaps of the overmap terrain whose northwest submap is abs_sub.
+static long long count_items( const tripoint &abs_sub )
+{
+    long long items = 0;
+    for( int smx = 0; smx < 2; smx++ ) {
+        for( int smy = 0; smy < 2; smy++ ) {
+            const submap *sm = MAPBUFFER.lookup_submap( abs_sub + point( smx, smy ) );
+            if( sm == nullptr ) {
+                continue;
+            }
+            for( int x = 0; x < SEEX; x++ ) {
+                for( int y = 0; y < SEEY; y++ ) {
+                    items += sm->get_items( point( x, y ) ).size();
+                }
+            }
+        }
+    }
+    return items;
+}
+
+// Generates every overmap terrain that has a mapgen a few times with fixed seeds and prints,
+// for each mapgen id, how often it ran, the total time it took and how many items it spawned.
+TEST_CASE( "mapgen_benchmark", "[.][mapgen][benchmark]" )
+{
+    constexpr int runs_per_terrain = 3;
+
+    overmap &om = overmap_buffer.get( point_zero );
+    std::map<std::string, mapgen_timing> timings;
+    int next_location = 0;
+
+    for( const oter_t &terrain : overmap_terrains::get_all() ) {
+        const std::string mapgen_id = terrain.get_mapgen_id();
+        if( mapgen_id.empty() || !has_mapgen_for( mapgen_id ) ) {
+            continue;
+        }
+        mapgen_timing &timing = timings[mapgen_id];
+        for( int run = 0; run < runs_per_terrain && next_location < OMAPX * OMAPY; ) {
+            // The overmap at the origin has local coordinates equal to the global ones.
+            const tripoint omt( next_location % OMAPX, next_location / OMAPX, 0 );
+            next_location++;
+            if( om.is_omt_generated( omt ) ) {
+                continue;
+            }
+            om.ter_set( omt, terrain.id.id() );
+            rng_set_engine_seed( 1234 + run );
+
+            const tripoint abs_sub = omt_to_sm_copy( omt );
+            const auto start = std::chrono::steady_clock::now();
+            tinymap tm;
+            tm.generate( abs_sub, calendar::turn );
+            const auto end = std::chrono::steady_clock::now();
+
+            timing.runs++;
+            timing.microseconds +=
+                std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+            timing.items += count_items( abs_sub );
+            run++;
+        }
+    }
+
+    cata_printf( "mapgen id\truns\tmicroseconds\titems\n" );
+    for( const auto &elem : timings ) {
+        cata_printf( "%s\t%d\t%lld\t%lld\n", elem.first, elem.second.runs,
+                     elem.second.microseconds, elem.second.items );
+    }
+}
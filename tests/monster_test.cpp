@@ -10,6 +10,7 @@
 
 #include "avatar.h"
 #include "catch/catch.hpp"
+#include "creature_tracker.h"
 #include "game.h"
 #include "map.h"
 #include "map_helpers.h"
@@ -329,3 +330,44 @@ TEST_CASE( "monster_speed_trig", "[speed]" )
     trigdist = true;
     monster_check();
 }
+
+TEST_CASE( "creature_tracker_radius_query", "[monster]" )
+{
+    clear_map_and_put_player_underground();
+    clear_creatures();
+    const tripoint center( 65, 65, 0 );
+    monster &near_mon = spawn_test_monster( "mon_zombie", center + tripoint( 3, -2, 0 ) );
+    // On the far side of a submap boundary, but still in range.
+    monster &edge_mon = spawn_test_monster( "mon_zombie", center + tripoint( -10, 10, 0 ) );
+    monster &far_mon = spawn_test_monster( "mon_zombie", center + tripoint( 30, 0, 0 ) );
+
+    const auto found = [&]( const monster & mon, int radius ) {
+        for( const shared_ptr_fast<monster> &ptr : g->critter_tracker->find_in_radius( center, radius ) ) {
+            if( ptr.get() == &mon ) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    CHECK( g->critter_tracker->find_in_radius( center, 10 ).size() == 2 );
+    CHECK( found( near_mon, 3 ) );
+    CHECK_FALSE( found( near_mon, 2 ) );
+    CHECK( found( edge_mon, 10 ) );
+    CHECK_FALSE( found( far_mon, 29 ) );
+    CHECK( found( far_mon, 30 ) );
+
+    far_mon.setpos( center + tripoint( 1, 1, 0 ) );
+    CHECK( found( far_mon, 1 ) );
+    CHECK( g->critter_tracker->find_in_radius( center, 10 ).size() == 3 );
+
+    g->swap_critters( near_mon, edge_mon );
+    CHECK( found( edge_mon, 3 ) );
+    CHECK_FALSE( found( near_mon, 9 ) );
+    CHECK( found( near_mon, 10 ) );
+
+    near_mon.die( nullptr );
+    CHECK_FALSE( found( near_mon, 10 ) );
+    g->critter_tracker->remove_dead();
+    CHECK( g->critter_tracker->find_in_radius( center, 100 ).size() == 2 );
+}
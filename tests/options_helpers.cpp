@@ -8,11 +8,14 @@ override_option::override_option( const std::string &option, const std::string &
     options_manager::cOpt &opt = get_options().get_option( option_ );
     old_value_ = opt.getValue( true );
     opt.setValue( value );
+    // Some options are read through globals, which are only updated on request.
+    get_options().cache_to_globals();
 }
 
 override_option::~override_option()
 {
     get_options().get_option( option_ ).setValue( old_value_ );
+    get_options().cache_to_globals();
 }
 
 bool try_set_utf8_locale()
@@ -6,6 +6,7 @@
 
 // RAII class to temporarily override a particular option value
 // The previous value will be restored in the destructor
+// Globals caching option values (see options_manager::cache_to_globals) follow along
 class override_option
 {
     public:
@@ -67,3 +67,31 @@ TEST_CASE( "om_noise_layer_lake_export", "[.]" )
     export_raw_noise( "lake-map-raw.pgm", f, OMAPX * 5, OMAPY * 5 );
     export_interpreted_noise( "lake-map-interp.pgm", f, OMAPX * 5, OMAPY * 5, 0.25 );
 }
+
+static float sum_noise( const om_noise::om_noise_layer &noise )
+{
+    float sum = 0.0f;
+    for( int x = 0; x < OMAPX; x++ ) {
+        for( int y = 0; y < OMAPY; y++ ) {
+            sum += noise.noise_at( {x, y} );
+        }
+    }
+    return sum;
+}
+
+TEST_CASE( "om_noise_layer_benchmark", "[.][benchmark]" )
+{
+    const om_noise::om_noise_layer_forest forest( point_zero, 1920237457 );
+    const om_noise::om_noise_layer_floodplain floodplain( point_zero, 1920237457 );
+    const om_noise::om_noise_layer_lake lake( point_zero, 1920237457 );
+
+    BENCHMARK( "forest" ) {
+        return sum_noise( forest );
+    };
+    BENCHMARK( "floodplain" ) {
+        return sum_noise( floodplain );
+    };
+    BENCHMARK( "lake" ) {
+        return sum_noise( lake );
+    };
+}
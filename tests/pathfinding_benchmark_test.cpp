@@ -0,0 +1,133 @@
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "game_constants.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "pathfinding.h"
+#include "point.h"
+#include "type_id.h"
+
+namespace
+{
+
+struct route_case {
+    std::string name;
+    tripoint from;
+    tripoint to;
+    std::function<void( map & )> build;
+};
+
+} // namespace
+
+static const tripoint west_edge( 2, MAPSIZE_Y / 2, 0 );
+static const tripoint east_edge( MAPSIZE_X - 3, MAPSIZE_Y / 2, 0 );
+
+// Buildings of 10x10 with a door and a window on each side, separated by 2 wide streets.
+static void build_city_block( map &here )
+{
+    const ter_id t_brick_wall( "t_brick_wall" );
+    const ter_id t_door_c( "t_door_c" );
+    const ter_id t_window( "t_window" );
+    const ter_id t_floor( "t_floor" );
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
+            const point in_block( x % 12, y % 12 );
+            if( in_block.x >= 10 || in_block.y >= 10 ) {
+                continue;
+            }
+            const bool wall = in_block.x == 0 || in_block.x == 9 ||
+                              in_block.y == 0 || in_block.y == 9;
+            ter_id ter = t_floor;
+            if( wall ) {
+                if( in_block.x == 5 || in_block.y == 5 ) {
+                    ter = t_door_c;
+                } else if( in_block.x == 2 || in_block.y == 2 ) {
+                    ter = t_window;
+                } else {
+                    ter = t_brick_wall;
+                }
+            }
+            here.ter_set( tripoint( x, y, 0 ), ter );
+        }
+    }
+}
+
+// Horizontal walls every third row with the gap alternating between the ends, so the only
+// path snakes through the whole bubble. Every other wall is a chain link fence to climb.
+static void build_maze( map &here )
+{
+    const ter_id t_concrete_wall( "t_concrete_wall" );
+    const ter_id t_chainfence( "t_chainfence" );
+    for( int y = 3; y < MAPSIZE_Y - 3; y += 3 ) {
+        const int row = y / 3;
+        const int gap_x = row % 2 == 0 ? 1 : MAPSIZE_X - 2;
+        for( int x = 0; x < MAPSIZE_X; x++ ) {
+            if( x != gap_x ) {
+                here.ter_set( tripoint( x, y, 0 ), row % 4 == 1 ? t_chainfence : t_concrete_wall );
+            }
+        }
+    }
+}
+
+// The destination is sealed in a box of walls; without bashing the whole bubble is searched.
+static void build_sealed_target( map &here )
+{
+    const ter_id t_concrete_wall( "t_concrete_wall" );
+    for( const tripoint &p : here.points_in_radius( east_edge, 1 ) ) {
+        if( p != east_edge ) {
+            here.ter_set( p, t_concrete_wall );
+        }
+    }
+}
+
+static void build_trapped_field( map &here )
+{
+    const trap_id tr_beartrap( "tr_beartrap" );
+    for( int x = 5; x < MAPSIZE_X - 5; x += 4 ) {
+        for( int y = 0; y < MAPSIZE_Y; y += 2 ) {
+            here.trap_set( tripoint( x, y, 0 ), tr_beartrap );
+        }
+    }
+}
+
+// Hidden; run with the [benchmark] tag. Each fixture is routed with several settings.
+TEST_CASE( "pathfinding_benchmark", "[.][pathfinding][benchmark]" )
+{
+    const std::vector<route_case> cases = {
+        { "open field", west_edge, east_edge, []( map & ) {} },
+        { "trapped field", west_edge, east_edge, build_trapped_field },
+        { "city block", west_edge, east_edge, build_city_block },
+        { "maze", tripoint( 1, 1, 0 ), tripoint( 1, MAPSIZE_Y - 2, 0 ), build_maze },
+        { "no path", west_edge, east_edge, build_sealed_target },
+    };
+
+    pathfinding_settings walk( 0, 1000, 1000, 0, false, false, true, false, false );
+    pathfinding_settings doors = walk;
+    doors.allow_open_doors = true;
+    pathfinding_settings bash = walk;
+    bash.bash_strength = 40;
+    pathfinding_settings climb = walk;
+    climb.climb_cost = 4;
+    pathfinding_settings traps = walk;
+    traps.avoid_traps = true;
+    const std::vector<std::pair<std::string, pathfinding_settings>> settings = {
+        { "walk", walk }, { "open doors", doors }, { "bash", bash }, { "climb", climb },
+        { "avoid traps", traps }
+    };
+
+    map &here = get_map();
+    for( const route_case &c : cases ) {
+        clear_map();
+        c.build( here );
+        for( const auto &s : settings ) {
+            BENCHMARK( c.name + ", " + s.first ) {
+                return here.route( c.from, c.to, s.second ).size();
+            };
+        }
+    }
+    clear_map();
+}
@@ -427,3 +427,19 @@ TEST_CASE( "Water hypothermia check.", "[.][bodytemp]" )
         hypothermia_check( dummy, units::celsius_to_fahrenheit( 0 ), 5_minutes, BODYTEMP_FREEZING );
     }
 }
+
+TEST_CASE( "Batched clothing lookups match the per part ones.", "[bodytemp]" )
+{
+    clear_avatar();
+    player &dummy = get_avatar();
+    equip_clothing( dummy, arctic_clothing );
+    dummy.drench( 50, body_part_set::all(), true );
+
+    const std::array<int, num_bp> warmth = dummy.warmth_all();
+    const std::array<int, num_bp> wind_resistance = dummy.get_wind_resistance_all();
+    for( const bodypart_id &bp : dummy.get_all_body_parts() ) {
+        CAPTURE( bp.id().str() );
+        CHECK( warmth[bp->token] == dummy.warmth( bp ) );
+        CHECK( wind_resistance[bp->token] == dummy.get_wind_resistance( bp ) );
+    }
+}
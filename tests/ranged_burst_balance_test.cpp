@@ -1,9 +1,12 @@
 #include <vector>
 
 #include "catch/catch.hpp"
+#include "map.h"
+#include "map_helpers.h"
 #include "npc.h"
 #include "item.h"
 #include "ranged.h"
+#include "type_id.h"
 
 static constexpr tripoint shooter_pos( 60, 60, 0 );
 static const std::string flag_BIPOD( "BIPOD" );
@@ -109,3 +112,22 @@ TEST_CASE( "average_burst_modded", "[ranged] [balance]" )
     check_burst_penalty( shooter, "ak47", {"adjustable_stock", "suppressor", "pistol_grip"}, 170 );
     check_burst_penalty( shooter, "m2browning", {"suppressor"}, 375 );
 }
+
+// Hidden; measures full bursts from a machine gun into a rock face, the common case of
+// turrets and NPCs firing at things that are not there anymore.
+TEST_CASE( "burst_fire_benchmark", "[.][ranged][benchmark]" )
+{
+    clear_map();
+    const tripoint target = shooter_pos + tripoint( 12, 3, 0 );
+    get_map().ter_set( target, ter_id( "t_rock" ) );
+    standard_npc shooter( "Shooter", shooter_pos, {}, 5, 10, 8, 8, 8 );
+    item gun( "m249" );
+    const int shots = gun.gun_current_mode().qty;
+
+    BENCHMARK( "m249 burst" ) {
+        gun.ammo_set( gun.ammo_default(), -1 );
+        shooter.recoil = 0;
+        return shooter.fire_gun( target, shots, gun );
+    };
+    clear_map();
+}
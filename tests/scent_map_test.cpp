@@ -0,0 +1,42 @@
+#include "catch/catch.hpp"
+#include "game.h"
+#include "game_constants.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "point.h"
+#include "scent_map.h"
+
+static const tripoint scent_center( MAPSIZE_X / 2, MAPSIZE_Y / 2, 0 );
+
+TEST_CASE( "scent_diffuses_to_open_neighbors", "[scent]" )
+{
+    clear_map();
+    scent_map scent( *g );
+    scent.set( scent_center, 1000 );
+
+    scent.update( scent_center, g->m );
+
+    // an open square keeps a tenth of its scent per neighbor, itself included
+    CHECK( scent.get( scent_center ) == 200 );
+    CHECK( scent.get( scent_center + tripoint_north ) == 100 );
+    CHECK( scent.get( scent_center + tripoint_south_east ) == 100 );
+    CHECK( scent.get( scent_center + tripoint( 2, 0, 0 ) ) == 0 );
+}
+
+TEST_CASE( "scent_update_benchmark", "[.][scent][benchmark]" )
+{
+    clear_map();
+    scent_map scent( *g );
+    // matches the radius scent_map::update works on
+    const int radius = 40;
+    for( int x = -radius; x <= radius; x += 3 ) {
+        for( int y = -radius; y <= radius; y += 3 ) {
+            scent.set( scent_center + tripoint( x, y, 0 ), 1000 );
+        }
+    }
+
+    BENCHMARK( "update" ) {
+        scent.update( scent_center, g->m );
+        return scent.get( scent_center );
+    };
+}
@@ -638,6 +638,19 @@ TEST_CASE( "shadowcasting_float_quad_performance", "[.]" )
     shadowcasting_float_quad( 1000000, 100 );
 }
 
+TEST_CASE( "four_quadrants_elementwise_operations", "[shadowcasting]" )
+{
+    four_quadrants l;
+    l.values = {{ 1.0f, 4.0f, 0.5f, 2.0f }};
+    four_quadrants r;
+    r.values = {{ 3.0f, 2.0f, 0.25f, 2.0f }};
+
+    CHECK( l.max() == 4.0f );
+    CHECK( ( l * r ).values == std::array<float, 4> { { 3.0f, 8.0f, 0.125f, 4.0f } } );
+    CHECK( elementwise_max( l, r ).values == std::array<float, 4> { { 3.0f, 4.0f, 0.5f, 2.0f } } );
+    CHECK( elementwise_max( l, 1.5f ).values == std::array<float, 4> { { 1.5f, 4.0f, 1.5f, 2.0f } } );
+}
+
 // I'm not sure this will ever work.
 TEST_CASE( "bresenham_vs_shadowcasting", "[.]" )
 {
@@ -376,6 +376,9 @@ TEST_CASE( "stats_tracker_watchers", "[stats]" )
         CHECK( crouched_watcher.value == cata_variant() );
         CHECK( swam_watcher.value == cata_variant() );
         CHECK( swam_underwater_watcher.value == cata_variant() );
+        // Watched statistics are answered from the incrementally updated values.
+        CHECK( s.value_of( stat_moves ) == cata_variant( 3 ) );
+        CHECK( s.value_of( stat_ran ) == cata_variant( 1 ) );
 
         b.send( crouch );
 
@@ -1,8 +1,16 @@
+#include <sstream>
+#include <string>
+
+#include "calendar.h"
 #include "catch/catch.hpp"
-#include "submap.h"
+#include "colony.h"
+#include "game.h"
 #include "game_constants.h"
 #include "int_id.h"
+#include "item.h"
+#include "json.h"
 #include "point.h"
+#include "submap.h"
 #include "type_id.h"
 
 TEST_CASE( "submap rotation", "[submap]" )
@@ -88,3 +96,68 @@ TEST_CASE( "submap rotation", "[submap]" )
         }
     }
 }
+
+TEST_CASE( "submap items survive a save round trip", "[submap]" )
+{
+    submap sm;
+    for( int i = 0; i < 5; i++ ) {
+        sm.get_items( point_zero ).insert( item( "rag", calendar::turn_zero ) );
+    }
+    sm.get_items( point_zero ).insert( item( "2x4", calendar::turn_zero ) );
+    sm.get_items( point_zero ).insert( item( "rag", calendar::turn_zero ) );
+    sm.get_items( point_east ).insert( item( "rag", calendar::turn_zero ) );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    sm.store_contents( jsout );
+    jsout.end_object();
+
+    // the run of identical rags is written only once
+    const std::string saved = os.str();
+    CHECK( saved.find( "[5," ) != std::string::npos );
+
+    std::istringstream is( saved );
+    JsonIn jsin( is );
+    submap loaded;
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string name = jsin.get_member_name();
+        loaded.load( jsin, name, savegame_version );
+    }
+
+    const cata::colony<item> &tile = loaded.get_items( point_zero );
+    REQUIRE( tile.size() == 7 );
+    int rags = 0;
+    for( const item &it : tile ) {
+        if( it.typeId() == itype_id( "rag" ) ) {
+            rags++;
+        }
+    }
+    CHECK( rags == 6 );
+    CHECK( loaded.get_items( point_east ).size() == 1 );
+}
+
+TEST_CASE( "submap field tiles are visited in scan order", "[submap]" )
+{
+    submap sm;
+    CHECK( sm.next_field_tile( 0 ) == SEEX * SEEY );
+
+    const point first( 0, 3 );
+    const point second( 5, 0 );
+    const point last( SEEX - 1, SEEY - 1 );
+    sm.mark_field_tile( last );
+    sm.mark_field_tile( second );
+    sm.mark_field_tile( first );
+
+    const int first_index = sm.next_field_tile( 0 );
+    CHECK( first_index == first.x * SEEY + first.y );
+    const int second_index = sm.next_field_tile( first_index + 1 );
+    CHECK( second_index == second.x * SEEY + second.y );
+    const int last_index = sm.next_field_tile( second_index + 1 );
+    CHECK( last_index == last.x * SEEY + last.y );
+    CHECK( sm.next_field_tile( last_index + 1 ) == SEEX * SEEY );
+
+    sm.unmark_field_tile( second );
+    CHECK( sm.next_field_tile( first_index + 1 ) == last_index );
+}
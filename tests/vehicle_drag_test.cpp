@@ -220,6 +220,20 @@ TEST_CASE( "vehicle_drag_calc_baseline", "[.]" )
     }
 }
 
+// Times a refresh followed by recalculating all three drag coefficients, which is what
+// happens whenever a vehicle changes its parts.
+TEST_CASE( "vehicle_drag_benchmark", "[.][benchmark]" )
+{
+    vehicle *veh_ptr = setup_drag_test( vproto_id( "semi_truck" ) );
+    REQUIRE( veh_ptr != nullptr );
+
+    BENCHMARK( "refresh and drag coefficients" ) {
+        veh_ptr->enable_refresh();
+        return veh_ptr->coeff_air_drag() + veh_ptr->coeff_rolling_drag() +
+               veh_ptr->coeff_water_drag();
+    };
+}
+
 // format is vehicle, coeff_air_drag, coeff_rolling_drag, coeff_water_drag, safe speed, max speed
 // coeffs are dimensionless, speeds are 100ths of mph, so 6101 is 61.01 mph
 TEST_CASE( "vehicle_drag", "[vehicle] [engine]" )
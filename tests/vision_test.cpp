@@ -620,3 +620,40 @@ TEST_CASE( "vision_player_opaque_neighbors_still_visible_night", "[shadowcasting
 
     t.test_all();
 }
+
+TEST_CASE( "vision_incremental_seen_cache_matches_full_recast", "[shadowcasting][vision]" )
+{
+    const ter_id t_brick_wall( "t_brick_wall" );
+    const bool old_fov_3d = fov_3d;
+    fov_3d = false;
+
+    Character &player_character = get_player_character();
+    g->place_player( tripoint( 60, 60, 0 ) );
+    clear_avatar();
+    clear_map();
+    map &here = get_map();
+    const tripoint origin = player_character.pos();
+    here.build_map_cache( origin.z );
+
+    // Walls in view of the player but only on one side, so only some octants get recast.
+    for( const point &offset : {
+             point( 3, -1 ), point( 5, -2 ), point( 4, 0 )
+         } ) {
+        here.ter_set( origin + offset, t_brick_wall );
+    }
+    here.build_map_cache( origin.z );
+    const level_cache &cache = here.access_cache( origin.z );
+    std::vector<float> incremental( &cache.seen_cache[0][0],
+                                    &cache.seen_cache[0][0] + MAPSIZE_X * MAPSIZE_Y );
+
+    // Stepping away and back forces a full recast from the same origin.
+    g->place_player( origin + point_south );
+    here.build_map_cache( origin.z );
+    g->place_player( origin );
+    here.build_map_cache( origin.z );
+    std::vector<float> full( &cache.seen_cache[0][0],
+                             &cache.seen_cache[0][0] + MAPSIZE_X * MAPSIZE_Y );
+
+    CHECK( incremental == full );
+    fov_3d = old_fov_3d;
+}